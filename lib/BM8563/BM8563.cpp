@@ -3,23 +3,25 @@
 BM8563::BM8563(uint8_t sda_pin, uint8_t scl_pin) {
     _sda_pin = sda_pin;
     _scl_pin = scl_pin;
+    _ctrl2 = 0;
+    _ctrl2Valid = false;
 }
 
 bool BM8563::begin() {
-    Wire.begin(_sda_pin, _scl_pin);
+    I2CBus::begin(_sda_pin, _scl_pin);
     
     // 检查芯片是否响应
-    Wire.beginTransmission(BM8563_I2C_ADDR);
-    if (Wire.endTransmission() != 0) {
+    if (!I2CBus::probe(BM8563_I2C_ADDR)) {
         return false;
     }
     
-    // 初始化控制寄存器
-    uint8_t ctrl1 = 0x00;  // 普通模式，时钟运行
-    uint8_t ctrl2 = BM8563_TI_TP;  // 设置TI/TP=1，使用脉冲模式
+    // 初始化控制寄存器（两个寄存器地址连续，一次写入）
+    uint8_t ctrl[2];
+    ctrl[0] = 0x00;          // 普通模式，时钟运行
+    ctrl[1] = BM8563_TI_TP;  // 设置TI/TP=1，使用脉冲模式，清除标志并禁用中断
     
-    writeRegister(BM8563_CTRL_STATUS1, ctrl1);
-    writeRegister(BM8563_CTRL_STATUS2, ctrl2);
+    _ctrl2Valid = writeRegisters(BM8563_CTRL_STATUS1, ctrl, 2);
+    _ctrl2 = BM8563_TI_TP;
     
     return true;
 }
@@ -101,36 +103,38 @@ bool BM8563::getAlarmFlag() {
     if (!readRegister(BM8563_CTRL_STATUS2, &value)) {
         return false;
     }
+    _ctrl2 = value & BM8563_CTRL2_CONTROL;
+    _ctrl2Valid = true;
     return (value & BM8563_AF) != 0;
 }
 
 void BM8563::clearAlarmFlag() {
-    uint8_t value;
-    readRegister(BM8563_CTRL_STATUS2, &value);
-    value &= ~BM8563_AF;
-    writeRegister(BM8563_CTRL_STATUS2, value);
+    if (loadControl2()) {
+        writeControl2(BM8563_AF);
+    }
 }
 
 void BM8563::enableAlarmInterrupt(bool enable) {
-    uint8_t value;
-    readRegister(BM8563_CTRL_STATUS2, &value);
+    if (!loadControl2()) {
+        return;
+    }
     
     if (enable) {
-        value |= BM8563_AIE;
+        _ctrl2 |= BM8563_AIE;
     } else {
-        value &= ~BM8563_AIE;
+        _ctrl2 &= ~BM8563_AIE;
     }
     
-    writeRegister(BM8563_CTRL_STATUS2, value);
+    writeControl2(0);
 }
 
 bool BM8563::setTimer(uint8_t timer_value, uint8_t timer_freq) {
-    // 设置定时器控制寄存器
-    uint8_t timer_ctrl = BM8563_TE | (timer_freq & 0x03);
-    writeRegister(BM8563_TIMER_CTRL, timer_ctrl);
+    // 定时器控制寄存器和定时器值地址连续，一次写入
+    uint8_t timer[2];
+    timer[0] = BM8563_TE | (timer_freq & 0x03);
+    timer[1] = timer_value;
     
-    // 设置定时器值
-    return writeRegister(BM8563_TIMER, timer_value);
+    return writeRegisters(BM8563_TIMER_CTRL, timer, 2);
 }
 
 bool BM8563::clearTimer() {
@@ -149,49 +153,76 @@ bool BM8563::getTimerFlag() {
     if (!readRegister(BM8563_CTRL_STATUS2, &value)) {
         return false;
     }
+    _ctrl2 = value & BM8563_CTRL2_CONTROL;
+    _ctrl2Valid = true;
     return (value & BM8563_TF) != 0;
 }
 
 void BM8563::clearTimerFlag() {
-    uint8_t value;
-    readRegister(BM8563_CTRL_STATUS2, &value);
-    value &= ~BM8563_TF;
-    writeRegister(BM8563_CTRL_STATUS2, value);
+    if (loadControl2()) {
+        writeControl2(BM8563_TF);
+    }
 }
 
 void BM8563::enableTimerInterrupt(bool enable) {
-    uint8_t value;
-    readRegister(BM8563_CTRL_STATUS2, &value);
+    if (!loadControl2()) {
+        return;
+    }
     
     if (enable) {
-        value |= BM8563_TIE;
+        _ctrl2 |= BM8563_TIE;
     } else {
-        value &= ~BM8563_TIE;
+        _ctrl2 &= ~BM8563_TIE;
     }
     
-    writeRegister(BM8563_CTRL_STATUS2, value);
+    writeControl2(0);
 }
 
 /**
  * @brief 重置所有中断标志和禁用中断
- * @note 用于清除可能导致 INT 引脚拉低的状态
+ * @note 用于清除可能导致 INT 引脚拉低的状态，只写一次控制状态寄存器2
  */
 void BM8563::resetInterrupts() {
-    clearTimerFlag();
-    clearAlarmFlag();
-    enableTimerInterrupt(false);
-    enableAlarmInterrupt(false);
+    if (!loadControl2()) {
+        return;
+    }
+    
+    _ctrl2 &= ~(BM8563_TIE | BM8563_AIE);
+    writeControl2(BM8563_CTRL2_FLAGS);
 }
 
 /**
  * @brief 配置深度睡眠唤醒定时器
  * @param seconds 睡眠时间（秒）
- * @note 自动清除中断标志并设置定时器
+ * @note 先写入定时器（一次连续写入），再一次性清除中断标志、禁用闹钟中断并启用定时器中断
  */
 void BM8563::setupWakeupTimer(uint16_t seconds) {
-    resetInterrupts();
+    if (!loadControl2()) {
+        return;
+    }
+    
     setTimer(seconds, BM8563_TIMER_1HZ);
-    enableTimerInterrupt(true);
+    
+    _ctrl2 = (_ctrl2 & ~BM8563_AIE) | BM8563_TIE;
+    writeControl2(BM8563_CTRL2_FLAGS);
+}
+
+/**
+ * @brief 配置长时间睡眠的分钟唤醒定时器
+ * @param minutes 睡眠时间（分钟，1/60Hz 定时器，最长 255 分钟）
+ * @note 与 setupWakeupTimer 相同只启用定时器中断，INT 保持脉冲模式（TI/TP=1），
+ *       唤醒后无需清除标志 INT 即释放。不使用闹钟：闹钟标志会一直拉低 INT，
+ *       ESP8266 的 RST 被拉住时无法启动去清除它
+ */
+void BM8563::setupMinuteWakeupTimer(uint8_t minutes) {
+    if (!loadControl2()) {
+        return;
+    }
+    
+    setTimer(minutes, BM8563_TIMER_1_60HZ);
+    
+    _ctrl2 = (_ctrl2 & ~BM8563_AIE) | BM8563_TIE;
+    writeControl2(BM8563_CTRL2_FLAGS);
 }
 
 void BM8563::setCLKOUTFrequency(uint8_t freq) {
@@ -247,55 +278,42 @@ uint8_t BM8563::decToBcd(uint8_t dec) {
     return ((dec / 10) << 4) | (dec % 10);
 }
 
-bool BM8563::readRegister(uint8_t reg, uint8_t *value) {
-    Wire.beginTransmission(BM8563_I2C_ADDR);
-    Wire.write(reg);
-    if (Wire.endTransmission() != 0) {
-        return false;
+bool BM8563::loadControl2() {
+    if (_ctrl2Valid) {
+        return true;
     }
     
-    Wire.requestFrom(BM8563_I2C_ADDR, (uint8_t)1);
-    if (Wire.available() != 1) {
+    uint8_t value;
+    if (!readRegister(BM8563_CTRL_STATUS2, &value)) {
+        return false;
+    }
+    _ctrl2 = value & BM8563_CTRL2_CONTROL;
+    _ctrl2Valid = true;
+    return true;
+}
+
+bool BM8563::writeControl2(uint8_t clearFlags) {
+    uint8_t value = (_ctrl2 & BM8563_CTRL2_CONTROL) | (BM8563_CTRL2_FLAGS & ~clearFlags);
+    if (!writeRegister(BM8563_CTRL_STATUS2, value)) {
+        // 写入失败时芯片状态未知，下次重新读取
+        _ctrl2Valid = false;
         return false;
     }
-    
-    *value = Wire.read();
     return true;
 }
 
+bool BM8563::readRegister(uint8_t reg, uint8_t *value) {
+    return I2CBus::readRegisters(BM8563_I2C_ADDR, reg, value, 1);
+}
+
 bool BM8563::writeRegister(uint8_t reg, uint8_t value) {
-    Wire.beginTransmission(BM8563_I2C_ADDR);
-    Wire.write(reg);
-    Wire.write(value);
-    return Wire.endTransmission() == 0;
+    return I2CBus::writeRegisters(BM8563_I2C_ADDR, reg, &value, 1);
 }
 
 bool BM8563::readRegisters(uint8_t reg, uint8_t *buffer, uint8_t len) {
-    Wire.beginTransmission(BM8563_I2C_ADDR);
-    Wire.write(reg);
-    if (Wire.endTransmission() != 0) {
-        return false;
-    }
-    
-    Wire.requestFrom(BM8563_I2C_ADDR, len);
-    if (Wire.available() != len) {
-        return false;
-    }
-    
-    for (uint8_t i = 0; i < len; i++) {
-        buffer[i] = Wire.read();
-    }
-    
-    return true;
+    return I2CBus::readRegisters(BM8563_I2C_ADDR, reg, buffer, len);
 }
 
-bool BM8563::writeRegisters(uint8_t reg, uint8_t *buffer, uint8_t len) {
-    Wire.beginTransmission(BM8563_I2C_ADDR);
-    Wire.write(reg);
-    
-    for (uint8_t i = 0; i < len; i++) {
-        Wire.write(buffer[i]);
-    }
-    
-    return Wire.endTransmission() == 0;
-}
\ No newline at end of file
+bool BM8563::writeRegisters(uint8_t reg, const uint8_t *buffer, uint8_t len) {
+    return I2CBus::writeRegisters(BM8563_I2C_ADDR, reg, buffer, len);
+}
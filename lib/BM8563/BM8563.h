@@ -2,7 +2,7 @@
 #define BM8563_H
 
 #include <Arduino.h>
-#include <Wire.h>
+#include "../I2CBus/I2CBus.h"
 
 // BM8563 I2C地址
 #define BM8563_I2C_ADDR 0x51  // 0xA2 >> 1
@@ -37,6 +37,10 @@
 #define BM8563_AIE     0x02
 #define BM8563_TIE     0x01
 
+// 控制状态寄存器2中的控制位和标志位（标志位写 0 清除、写 1 保持不变）
+#define BM8563_CTRL2_CONTROL  (BM8563_TI_TP | BM8563_AIE | BM8563_TIE)
+#define BM8563_CTRL2_FLAGS    (BM8563_AF | BM8563_TF)
+
 // 秒寄存器位定义
 #define BM8563_VL      0x80
 
@@ -101,9 +105,10 @@ public:
     void clearTimerFlag();
     void enableTimerInterrupt(bool enable);
     
-    // 辅助方法（用于简化常用操作）
+    // 辅助方法（用于简化常用操作，每个方法只写一次控制状态寄存器2）
     void resetInterrupts();
     void setupWakeupTimer(uint16_t seconds);
+    void setupMinuteWakeupTimer(uint8_t minutes);
     
     // CLKOUT功能
     void setCLKOUTFrequency(uint8_t freq);
@@ -117,13 +122,23 @@ private:
     uint8_t _sda_pin;
     uint8_t _scl_pin;
     
+    // 控制状态寄存器2控制位的影子副本，修改控制位时无需先读取寄存器
+    uint8_t _ctrl2;
+    bool _ctrl2Valid;
+    
+    // 影子副本无效时从芯片读取
+    bool loadControl2();
+    
+    // 按影子副本写入控制位，clearFlags 中的标志位被清除，其余标志位保持不变
+    bool writeControl2(uint8_t clearFlags);
+    
     // 内部辅助函数
     uint8_t bcdToDec(uint8_t bcd);
     uint8_t decToBcd(uint8_t dec);
     bool readRegister(uint8_t reg, uint8_t *value);
     bool writeRegister(uint8_t reg, uint8_t value);
     bool readRegisters(uint8_t reg, uint8_t *buffer, uint8_t len);
-    bool writeRegisters(uint8_t reg, uint8_t *buffer, uint8_t len);
+    bool writeRegisters(uint8_t reg, const uint8_t *buffer, uint8_t len);
 };
 
 #endif // BM8563_H
\ No newline at end of file
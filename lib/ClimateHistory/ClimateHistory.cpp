@@ -0,0 +1,385 @@
+#include "ClimateHistory.h"
+#include "../LogManager/LogManager.h"
+#include "../Metrics/Metrics.h"
+
+ClimateHistory::ClimateHistory(int address)
+  : _address(address) {
+  _flashAddress = ((uint32_t)&_EEPROM_start - 0x40200000) + address;
+  memset(&_pending, 0, sizeof(_pending));
+}
+
+void ClimateHistory::begin() {
+  if (_address + STORAGE_SIZE > EEPROM_TOTAL_SIZE) {
+    LOG_ERROR("ClimateHistory storage exceeds EEPROM size");
+  }
+
+  // 冷启动或 RTC 数据损坏时从空批次开始
+  if (!RTCMemory::read(RTC_BLOCK_CLIMATE_HISTORY, _pending) || _pending.count > CLIMATE_FLUSH_BATCH) {
+    memset(&_pending, 0, sizeof(_pending));
+    LOG_INFO("ClimateHistory: no pending samples in RTC memory");
+  } else {
+    LOG_INFO_F("ClimateHistory: %d pending samples restored", _pending.count);
+  }
+}
+
+bool ClimateHistory::addSample(uint32_t time, float temperature, float humidity, float battery) {
+  // 同一时间槽内只记录一次
+  uint32_t slot = time / CLIMATE_SAMPLE_INTERVAL;
+  if (_pending.lastSlot == slot) {
+    return false;
+  }
+
+  if (_pending.count >= CLIMATE_FLUSH_BATCH && !flush()) {
+    // Flash 写入失败时丢弃最旧的样本，保证 RTC 批次不溢出
+    memmove(&_pending.samples[0], &_pending.samples[1], sizeof(ClimateSample) * (CLIMATE_FLUSH_BATCH - 1));
+    _pending.count = CLIMATE_FLUSH_BATCH - 1;
+  }
+
+  ClimateSample& sample = _pending.samples[_pending.count++];
+  sample.time = time;
+  sample.values[CLIMATE_TEMPERATURE] = toFixed(temperature);
+  sample.values[CLIMATE_HUMIDITY] = toFixed(humidity);
+  sample.values[CLIMATE_BATTERY] = toFixed(battery);
+  _pending.lastSlot = slot;
+
+  LOG_DEBUG_F("ClimateHistory: sample recorded (%d/%d pending)", _pending.count, CLIMATE_FLUSH_BATCH);
+
+  if (_pending.count >= CLIMATE_FLUSH_BATCH) {
+    flush();
+  }
+
+  saveState();
+  return true;
+}
+
+bool ClimateHistory::flush() {
+  if (_pending.count == 0) {
+    return true;
+  }
+
+  LOG_INFO_F("ClimateHistory: flushing %d samples to flash", _pending.count);
+
+  // EEPROM.begin() 在堆上分配整个 EEPROM 大小的 RAM 副本，提交后释放，
+  // 避免之后的 TLS 连接因堆不足失败；其他模块已打开 EEPROM 时保留给它们使用
+  bool opened = EEPROM.length() == 0;
+  EEPROM.begin(EEPROM_TOTAL_SIZE);
+
+  Header header;
+  EEPROM.get(_address, header);
+
+  // 首次使用或格式变化时清空整个历史区域
+  if (header.magic != MAGIC) {
+    for (uint32_t i = 0; i < STORAGE_SIZE; i++) {
+      EEPROM.write(_address + i, 0);
+    }
+    header.magic = MAGIC;
+    header.sampleHead = 0;
+    header.sampleCount = 0;
+  }
+
+  for (uint8_t i = 0; i < _pending.count; i++) {
+    const ClimateSample& sample = _pending.samples[i];
+
+    // 写入原始样本环形缓冲区
+    EEPROM.put(_address + SAMPLES_OFFSET + header.sampleHead * sizeof(ClimateSample), sample);
+    header.sampleHead = (header.sampleHead + 1) % CLIMATE_HISTORY_SAMPLES;
+    if (header.sampleCount < CLIMATE_HISTORY_SAMPLES) {
+      header.sampleCount++;
+    }
+
+    // 更新预聚合桶
+    updateBucket(HOURLY_OFFSET, CLIMATE_HOURLY_BUCKETS, sample.time / 3600, sample);
+    updateBucket(DAILY_OFFSET, CLIMATE_DAILY_BUCKETS, sample.time / 86400, sample);
+  }
+
+  EEPROM.put(_address, header);
+
+  bool committed = EEPROM.commit();
+  Metrics::increment(METRIC_FLASH_COMMITS);
+  if (opened) {
+    EEPROM.end();
+  }
+  if (!committed) {
+    LOG_ERROR("ClimateHistory: failed to commit samples");
+    return false;
+  }
+
+  _pending.count = 0;
+  saveState();
+  LOG_INFO("ClimateHistory: samples flushed");
+  return true;
+}
+
+template <typename Visitor>
+void ClimateHistory::forEachSample(Visitor visit) {
+  // 按时间顺序分批读取 Flash 中的原始样本
+  Header header;
+  if (readFlash(0, &header, sizeof(header)) && header.magic == MAGIC && header.sampleCount <= CLIMATE_HISTORY_SAMPLES) {
+    const uint16_t batchSize = 12;
+    ClimateSample batch[batchSize];
+    uint16_t first = (header.sampleHead + CLIMATE_HISTORY_SAMPLES - header.sampleCount) % CLIMATE_HISTORY_SAMPLES;
+
+    uint16_t done = 0;
+    while (done < header.sampleCount) {
+      uint16_t index = (first + done) % CLIMATE_HISTORY_SAMPLES;
+      uint16_t count = header.sampleCount - done;
+      if (count > batchSize) {
+        count = batchSize;
+      }
+      if (count > CLIMATE_HISTORY_SAMPLES - index) {
+        count = CLIMATE_HISTORY_SAMPLES - index;
+      }
+
+      if (!readFlash(SAMPLES_OFFSET + index * sizeof(ClimateSample), batch, count * sizeof(ClimateSample))) {
+        break;
+      }
+
+      for (uint16_t i = 0; i < count; i++) {
+        visit(batch[i]);
+      }
+      done += count;
+    }
+  }
+
+  // RTC 内存中尚未写入 Flash 的样本
+  for (uint8_t i = 0; i < _pending.count; i++) {
+    visit(_pending.samples[i]);
+  }
+}
+
+bool ClimateHistory::getStats(ClimateWindow window, ClimateChannel channel, uint32_t now, ClimateStats& stats) {
+  stats.count = 0;
+  stats.minValue = 0;
+  stats.maxValue = 0;
+  stats.average = 0;
+  int32_t sum = 0;
+
+  // 最近60分钟不对齐小时桶，直接合并窗口 (now - 3600, now] 内的原始样本
+  if (window == CLIMATE_LAST_HOUR) {
+    uint32_t start = now >= 3600 ? now - 3600 : 0;
+    forEachSample([&](const ClimateSample& sample) {
+      if (sample.time > start && sample.time <= now) {
+        mergeValue(sample.values[channel], stats, sum);
+      }
+    });
+  } else {
+    mergeBuckets(window, channel, now, stats, sum);
+  }
+
+  if (stats.count == 0) {
+    return false;
+  }
+
+  stats.average = sum / 100.0f / stats.count;
+  return true;
+}
+
+void ClimateHistory::mergeBuckets(ClimateWindow window, ClimateChannel channel, uint32_t now, ClimateStats& stats, int32_t& sum) {
+  // 根据窗口确定要合并的桶
+  uint32_t offset = HOURLY_OFFSET;
+  uint8_t bucketCount = CLIMATE_HOURLY_BUCKETS;
+  uint32_t bucketSeconds = 3600;
+  if (window == CLIMATE_LAST_WEEK) {
+    offset = DAILY_OFFSET;
+    bucketCount = CLIMATE_DAILY_BUCKETS;
+    bucketSeconds = 86400;
+  }
+
+  uint32_t lastIndex = now / bucketSeconds;
+  uint32_t firstIndex = lastIndex >= (uint32_t)(bucketCount - 1) ? lastIndex - (bucketCount - 1) : 0;
+  uint8_t ringSize = (offset == HOURLY_OFFSET) ? CLIMATE_HOURLY_BUCKETS : CLIMATE_DAILY_BUCKETS;
+
+  Header header;
+  if (readFlash(0, &header, sizeof(header)) && header.magic == MAGIC) {
+    for (uint32_t index = firstIndex; index <= lastIndex; index++) {
+      ClimateBucket bucket;
+      uint32_t bucketOffset = offset + (index % ringSize) * sizeof(ClimateBucket);
+      if (readFlash(bucketOffset, &bucket, sizeof(bucket)) && bucket.index == index) {
+        mergeBucket(bucket, channel, stats, sum);
+      }
+    }
+  }
+
+  // 合并 RTC 内存中尚未写入 Flash 的样本
+  for (uint8_t i = 0; i < _pending.count; i++) {
+    uint32_t index = _pending.samples[i].time / bucketSeconds;
+    if (index >= firstIndex && index <= lastIndex) {
+      mergeValue(_pending.samples[i].values[channel], stats, sum);
+    }
+  }
+}
+
+bool ClimateHistory::getSeries(ClimateChannel channel, uint32_t now, uint32_t span, uint8_t columns, ClimateSeries& series) {
+  if (columns > CLIMATE_SERIES_MAX_COLUMNS) {
+    columns = CLIMATE_SERIES_MAX_COLUMNS;
+  }
+
+  series.columns = columns;
+  for (uint8_t i = 0; i < columns; i++) {
+    series.minValue[i] = CLIMATE_INVALID_VALUE;
+    series.maxValue[i] = CLIMATE_INVALID_VALUE;
+  }
+
+  if (columns == 0 || span == 0) {
+    return false;
+  }
+
+  uint32_t start = now >= span ? now - span : 0;
+  bool hasData = false;
+  forEachSample([&](const ClimateSample& sample) {
+    hasData |= addToSeries(sample, channel, start, span, series);
+  });
+  return hasData;
+}
+
+void ClimateHistory::clear() {
+  memset(&_pending, 0, sizeof(_pending));
+  saveState();
+
+  bool opened = EEPROM.length() == 0;
+  EEPROM.begin(EEPROM_TOTAL_SIZE);
+  Header header = {MAGIC, 0, 0};
+  for (uint32_t i = 0; i < STORAGE_SIZE; i++) {
+    EEPROM.write(_address + i, 0);
+  }
+  EEPROM.put(_address, header);
+  EEPROM.commit();
+  if (opened) {
+    EEPROM.end();
+  }
+
+  LOG_INFO("ClimateHistory cleared");
+}
+
+uint8_t ClimateHistory::getPendingCount() const {
+  return _pending.count;
+}
+
+bool ClimateHistory::readFlash(uint32_t offset, void* data, size_t length) {
+  // SPI Flash 只支持32位对齐读取，按块读入对齐缓冲区后再截取
+  uint32_t words[16];
+  uint32_t address = _flashAddress + offset;
+  uint8_t* dest = (uint8_t*)data;
+
+  while (length > 0) {
+    uint32_t aligned = address & ~3UL;
+    size_t skip = address - aligned;
+    size_t chunk = sizeof(words) - skip;
+    if (chunk > length) {
+      chunk = length;
+    }
+
+    if (!ESP.flashRead(aligned, words, (skip + chunk + 3) & ~3UL)) {
+      return false;
+    }
+
+    memcpy(dest, (uint8_t*)words + skip, chunk);
+    dest += chunk;
+    address += chunk;
+    length -= chunk;
+  }
+
+  return true;
+}
+
+void ClimateHistory::saveState() {
+  if (!RTCMemory::write(RTC_BLOCK_CLIMATE_HISTORY, _pending)) {
+    LOG_WARN("ClimateHistory: failed to save pending samples to RTC memory");
+  }
+}
+
+void ClimateHistory::updateBucket(uint32_t offset, uint8_t bucketCount, uint32_t index, const ClimateSample& sample) {
+  uint32_t address = _address + offset + (index % bucketCount) * sizeof(ClimateBucket);
+
+  ClimateBucket bucket;
+  EEPROM.get(address, bucket);
+
+  // 桶属于更早的周期时重新开始
+  if (bucket.index != index) {
+    memset(&bucket, 0, sizeof(bucket));
+    bucket.index = index;
+  }
+
+  for (uint8_t channel = 0; channel < CLIMATE_CHANNEL_COUNT; channel++) {
+    int16_t value = sample.values[channel];
+    if (value == CLIMATE_INVALID_VALUE) {
+      continue;
+    }
+
+    if (bucket.count[channel] == 0 || value < bucket.minValue[channel]) {
+      bucket.minValue[channel] = value;
+    }
+    if (bucket.count[channel] == 0 || value > bucket.maxValue[channel]) {
+      bucket.maxValue[channel] = value;
+    }
+    bucket.sum[channel] += value;
+    bucket.count[channel]++;
+  }
+
+  EEPROM.put(address, bucket);
+}
+
+void ClimateHistory::mergeBucket(const ClimateBucket& bucket, ClimateChannel channel, ClimateStats& stats, int32_t& sum) {
+  uint16_t count = bucket.count[channel];
+  if (count == 0) {
+    return;
+  }
+
+  float minValue = bucket.minValue[channel] / 100.0f;
+  float maxValue = bucket.maxValue[channel] / 100.0f;
+  if (stats.count == 0 || minValue < stats.minValue) {
+    stats.minValue = minValue;
+  }
+  if (stats.count == 0 || maxValue > stats.maxValue) {
+    stats.maxValue = maxValue;
+  }
+  sum += bucket.sum[channel];
+  stats.count += count;
+}
+
+void ClimateHistory::mergeValue(int16_t value, ClimateStats& stats, int32_t& sum) {
+  if (value == CLIMATE_INVALID_VALUE) {
+    return;
+  }
+
+  float floatValue = value / 100.0f;
+  if (stats.count == 0 || floatValue < stats.minValue) {
+    stats.minValue = floatValue;
+  }
+  if (stats.count == 0 || floatValue > stats.maxValue) {
+    stats.maxValue = floatValue;
+  }
+  sum += value;
+  stats.count++;
+}
+
+bool ClimateHistory::addToSeries(const ClimateSample& sample, ClimateChannel channel, uint32_t start, uint32_t span, ClimateSeries& series) {
+  int16_t value = sample.values[channel];
+  if (value == CLIMATE_INVALID_VALUE || sample.time < start || sample.time - start >= span) {
+    return false;
+  }
+
+  uint8_t column = (sample.time - start) * series.columns / span;
+  if (series.minValue[column] == CLIMATE_INVALID_VALUE || value < series.minValue[column]) {
+    series.minValue[column] = value;
+  }
+  if (series.maxValue[column] == CLIMATE_INVALID_VALUE || value > series.maxValue[column]) {
+    series.maxValue[column] = value;
+  }
+  return true;
+}
+
+int16_t ClimateHistory::toFixed(float value) {
+  if (isnan(value)) {
+    return CLIMATE_INVALID_VALUE;
+  }
+
+  float scaled = value * 100.0f;
+  if (scaled >= 32767.0f) {
+    return 32767;
+  }
+  if (scaled <= -32767.0f) {
+    return -32767;
+  }
+  return (int16_t)lroundf(scaled);
+}
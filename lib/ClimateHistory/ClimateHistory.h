@@ -0,0 +1,180 @@
+#ifndef CLIMATE_HISTORY_H
+#define CLIMATE_HISTORY_H
+
+#include <Arduino.h>
+#include "../ConfigManager/ConfigManager.h"
+#include "../RTCMemory/RTCMemory.h"
+
+// 历史记录在 EEPROM 扇区中的起始地址（配置数据之后）
+#define CLIMATE_HISTORY_ADDRESS 512
+
+// 采样间隔（秒），同一时间槽内的多次唤醒只记录一次
+#define CLIMATE_SAMPLE_INTERVAL 600
+
+// RTC 内存中累积的样本数，达到后批量写入 Flash（受 RTC 用户内存容量限制）
+#define CLIMATE_FLUSH_BATCH 6
+
+// Flash 中保留的原始样本数（24小时 × 每小时6个）
+#define CLIMATE_HISTORY_SAMPLES 144
+
+// 预聚合桶数量
+#define CLIMATE_HOURLY_BUCKETS 24
+#define CLIMATE_DAILY_BUCKETS 7
+
+// 无效值（传感器读取失败）
+#define CLIMATE_INVALID_VALUE INT16_MIN
+
+// 抽样序列的最大列数
+#define CLIMATE_SERIES_MAX_COLUMNS 96
+
+// 数据通道
+enum ClimateChannel {
+  CLIMATE_TEMPERATURE = 0,  // 温度（0.01°C）
+  CLIMATE_HUMIDITY = 1,     // 湿度（0.01%RH）
+  CLIMATE_BATTERY = 2,      // 电池电量（0.01%）
+  CLIMATE_CHANNEL_COUNT = 3
+};
+
+// 统计窗口
+enum ClimateWindow {
+  CLIMATE_LAST_HOUR,  // 最近60分钟（原始样本）
+  CLIMATE_LAST_DAY,   // 最近24个小时桶
+  CLIMATE_LAST_WEEK   // 最近7个天桶
+};
+
+// 单个样本（16位定点数）
+struct __attribute__((packed)) ClimateSample {
+  uint32_t time;                               // 采样时间（TimeManager::toEpochSeconds）
+  int16_t values[CLIMATE_CHANNEL_COUNT];       // 各通道定点值
+};
+
+// 预聚合桶（按小时或按天）
+struct __attribute__((packed)) ClimateBucket {
+  uint32_t index;                              // 小时序号或天序号
+  uint16_t count[CLIMATE_CHANNEL_COUNT];       // 各通道有效样本数
+  int16_t minValue[CLIMATE_CHANNEL_COUNT];     // 最小值
+  int16_t maxValue[CLIMATE_CHANNEL_COUNT];     // 最大值
+  int32_t sum[CLIMATE_CHANNEL_COUNT];          // 累加和（用于计算平均值）
+};
+
+// 按列抽样的序列（每列保留最小/最大值，无数据的列为 CLIMATE_INVALID_VALUE）
+struct ClimateSeries {
+  uint8_t columns;                                   // 列数
+  int16_t minValue[CLIMATE_SERIES_MAX_COLUMNS];      // 每列最小值
+  int16_t maxValue[CLIMATE_SERIES_MAX_COLUMNS];      // 每列最大值
+};
+
+// 统计结果
+struct ClimateStats {
+  uint16_t count;    // 有效样本数
+  float minValue;    // 最小值
+  float maxValue;    // 最大值
+  float average;     // 平均值
+};
+
+/**
+ * 室内气候历史记录
+ * 每次唤醒的温湿度和电量样本先累积在 RTC 内存中，达到批次后一次性写入 Flash，
+ * 同时更新按小时/按天的预聚合桶，查询最小/最大/平均值时无需扫描原始样本
+ */
+class ClimateHistory {
+public:
+  /**
+   * 构造函数
+   * @param address 历史记录在 EEPROM 扇区中的起始地址
+   */
+  ClimateHistory(int address = CLIMATE_HISTORY_ADDRESS);
+
+  /**
+   * 初始化，从 RTC 内存恢复待写入的样本
+   */
+  void begin();
+
+  /**
+   * 添加样本
+   * 同一采样时间槽内只记录一次，批次满后自动写入 Flash
+   * @param time 采样时间（TimeManager::toEpochSeconds）
+   * @param temperature 温度（°C），NAN 表示无效
+   * @param humidity 湿度（%RH），NAN 表示无效
+   * @param battery 电池电量（%），NAN 表示无效
+   * @return 是否记录了新样本
+   */
+  bool addSample(uint32_t time, float temperature, float humidity, float battery);
+
+  /**
+   * 将 RTC 内存中的样本写入 Flash
+   * @return 是否写入成功
+   */
+  bool flush();
+
+  /**
+   * 查询统计数据（包含尚未写入 Flash 的样本）
+   * @param window 统计窗口
+   * @param channel 数据通道
+   * @param now 当前时间（TimeManager::toEpochSeconds）
+   * @param stats 输出参数，统计结果
+   * @return 窗口内是否有有效样本
+   */
+  bool getStats(ClimateWindow window, ClimateChannel channel, uint32_t now, ClimateStats& stats);
+
+  /**
+   * 将最近一段时间的原始样本抽样到指定列数（每列取最小/最大值）
+   * 用于按像素宽度绘制趋势图，列数通常等于绘图区域宽度
+   * @param channel 数据通道
+   * @param now 当前时间（TimeManager::toEpochSeconds）
+   * @param span 时间跨度（秒），最多为 Flash 中保留的 24 小时
+   * @param columns 列数（不超过 CLIMATE_SERIES_MAX_COLUMNS）
+   * @param series 输出参数，抽样结果
+   * @return 是否有任意一列包含有效数据
+   */
+  bool getSeries(ClimateChannel channel, uint32_t now, uint32_t span, uint8_t columns, ClimateSeries& series);
+
+  /**
+   * 清除所有历史记录
+   */
+  void clear();
+
+  /**
+   * 获取 RTC 内存中待写入的样本数
+   */
+  uint8_t getPendingCount() const;
+
+private:
+  // Flash 中的历史记录头
+  struct __attribute__((packed)) Header {
+    uint32_t magic;        // 格式标识
+    uint16_t sampleHead;   // 下一个样本写入位置
+    uint16_t sampleCount;  // 已存储的样本数
+  };
+
+  // RTC 内存中的待写入批次
+  struct PendingBatch {
+    uint32_t lastSlot;     // 最近一次采样的时间槽
+    uint8_t count;         // 待写入样本数
+    uint8_t reserved[3];
+    ClimateSample samples[CLIMATE_FLUSH_BATCH];
+  };
+
+  static const uint32_t MAGIC = 0x43484931;  // "CHI1"
+  static const uint32_t SAMPLES_OFFSET = sizeof(Header);
+  static const uint32_t HOURLY_OFFSET = SAMPLES_OFFSET + CLIMATE_HISTORY_SAMPLES * sizeof(ClimateSample);
+  static const uint32_t DAILY_OFFSET = HOURLY_OFFSET + CLIMATE_HOURLY_BUCKETS * sizeof(ClimateBucket);
+  static const uint32_t STORAGE_SIZE = DAILY_OFFSET + CLIMATE_DAILY_BUCKETS * sizeof(ClimateBucket);
+
+  int _address;
+  uint32_t _flashAddress;
+  PendingBatch _pending;
+
+  // 内部辅助函数
+  bool readFlash(uint32_t offset, void* data, size_t length);
+  template <typename Visitor> void forEachSample(Visitor visit);
+  void saveState();
+  void updateBucket(uint32_t offset, uint8_t bucketCount, uint32_t index, const ClimateSample& sample);
+  void mergeBuckets(ClimateWindow window, ClimateChannel channel, uint32_t now, ClimateStats& stats, int32_t& sum);
+  void mergeBucket(const ClimateBucket& bucket, ClimateChannel channel, ClimateStats& stats, int32_t& sum);
+  void mergeValue(int16_t value, ClimateStats& stats, int32_t& sum);
+  bool addToSeries(const ClimateSample& sample, ClimateChannel channel, uint32_t start, uint32_t span, ClimateSeries& series);
+  static int16_t toFixed(float value);
+};
+
+#endif // CLIMATE_HISTORY_H
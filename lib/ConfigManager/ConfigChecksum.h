@@ -0,0 +1,25 @@
+#ifndef CONFIG_CHECKSUM_H
+#define CONFIG_CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * 配置记录的校验和：逐字节异或（包括结构体的填充字节）
+ * 不依赖 Arduino，可在主机上编译测试（test/test_microbench）
+ */
+class ConfigChecksum {
+public:
+  static uint8_t compute(const void* data, size_t size) {
+    uint8_t checksum = 0;
+    const uint8_t* ptr = (const uint8_t*)data;
+
+    for (size_t i = 0; i < size; i++) {
+      checksum ^= ptr[i];
+    }
+
+    return checksum;
+  }
+};
+
+#endif // CONFIG_CHECKSUM_H
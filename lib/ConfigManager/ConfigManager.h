@@ -4,6 +4,17 @@
 #include <Arduino.h>
 #include <EEPROM.h>
 #include "../LogManager/LogManager.h"
+#include "../Metrics/Metrics.h"
+#include "ConfigChecksum.h"
+
+// EEPROM 模拟区总大小（字节）
+// 配置数据（地址0）与室内气候历史（地址512）共用同一扇区，
+// 所有 EEPROM.begin() 调用必须使用相同大小，否则 commit 会截断其他数据
+#define EEPROM_TOTAL_SIZE 3072
+
+// EEPROM 模拟扇区的起始地址（由链接脚本提供，位于 0x40200000 映射基址之后）
+extern "C" uint32_t _EEPROM_start;
+
 // 统一配置数据结构体（用于EEPROM存储）
 struct ConfigData {
   // 天气配置
@@ -31,6 +42,9 @@ struct ConfigData {
  * 通用配置管理器类
  * 提供EEPROM配置存储功能，支持任意数据类型的配置存储和读取
  * 包含校验和验证机制确保配置数据完整性
+ *
+ * 未调用 begin() 时，读取直接从 Flash 扇区进行（不分配 EEPROM 的 RAM 副本）；
+ * 只有写入/清除时才会初始化 EEPROM 类
  */
 template<typename T>
 class ConfigManager {
@@ -40,11 +54,11 @@ public:
    * @param address EEPROM起始地址
    * @param eepromSize EEPROM总大小（用于初始化）
    */
-  ConfigManager(int address = 0, int eepromSize = 512);
+  ConfigManager(int address = 0, int eepromSize = EEPROM_TOTAL_SIZE);
   
   /**
    * 初始化配置管理器
-   * 必须在使用前调用
+   * 分配 EEPROM 的 RAM 副本，仅写入配置时需要；只读访问无需调用
    */
   void begin();
   
@@ -55,6 +69,14 @@ public:
    */
   bool read(T& data);
   
+  /**
+   * 读取配置数据，不输出日志
+   * 用于日志输出目标确定之前（如读取日志设置本身）
+   * @param data 输出参数，读取的配置数据
+   * @return 是否成功读取（校验和验证通过）
+   */
+  bool readQuiet(T& data);
+  
   /**
    * 写入配置数据
    * @param data 要写入的配置数据
@@ -109,6 +131,14 @@ private:
    * @return 校验和在EEPROM中的地址
    */
   int getChecksumAddress() const;
+  
+  /**
+   * 直接从 Flash 读取配置记录并验证校验和，不输出日志
+   * 使用32位对齐读取到栈上的缓冲区再拷贝到调用方的结构体中，不分配 EEPROM 的 RAM 副本
+   * @param data 输出参数，读取的配置数据
+   * @return 读取成功且校验和匹配
+   */
+  bool readFromFlash(T& data);
 };
 
 // 模板实现必须在头文件中
@@ -128,11 +158,22 @@ void ConfigManager<T>::begin() {
 
 template<typename T>
 bool ConfigManager<T>::read(T& data) {
-  if (!_initialized) {
-    LOG_WARN("ConfigManager not initialized");
+  if (!readQuiet(data)) {
+    LOG_ERROR("Config data checksum mismatch");
     return false;
   }
   
+  LOG_INFO("Config data read successfully");
+  return true;
+}
+
+template<typename T>
+bool ConfigManager<T>::readQuiet(T& data) {
+  if (!_initialized) {
+    // 只读路径：直接从 Flash 读取，避免 EEPROM.begin() 的 RAM 副本和整扇区拷贝
+    return readFromFlash(data);
+  }
+  
   // 从EEPROM读取配置数据
   EEPROM.get(_address, data);
   
@@ -143,21 +184,13 @@ bool ConfigManager<T>::read(T& data) {
   byte calculatedChecksum = calculateChecksum(data);
   
   // 验证校验和
-  if (storedChecksum != calculatedChecksum) {
-    LOG_ERROR("Config data checksum mismatch");
-    return false;
-  }
-  
-  LOG_INFO("Config data read successfully");
-  return true;
+  return storedChecksum == calculatedChecksum;
 }
 
 template<typename T>
 bool ConfigManager<T>::write(const T& data) {
-  if (!_initialized) {
-    LOG_WARN("ConfigManager not initialized");
-    return false;
-  }
+  // 写入需要 EEPROM 的 RAM 副本，按需初始化
+  begin();
   
   // 写入配置数据到EEPROM
   EEPROM.put(_address, data);
@@ -168,6 +201,7 @@ bool ConfigManager<T>::write(const T& data) {
   
   // 提交更改
   bool success = EEPROM.commit();
+  Metrics::increment(METRIC_FLASH_COMMITS);
   
   if (success) {
     LOG_INFO("Config data written successfully");
@@ -179,10 +213,8 @@ bool ConfigManager<T>::write(const T& data) {
 }
 template<typename T>
 void ConfigManager<T>::clear() {
-  if (!_initialized) {
-    LOG_WARN("ConfigManager not initialized");
-    return;
-  }
+  // 清除需要 EEPROM 的 RAM 副本，按需初始化
+  begin();
   
   // 创建零值配置数据
   T emptyData = {};
@@ -196,17 +228,18 @@ void ConfigManager<T>::clear() {
   
   // 提交更改
   EEPROM.commit();
+  Metrics::increment(METRIC_FLASH_COMMITS);
   
   LOG_INFO("Config data cleared");
 }
 template<typename T>
 bool ConfigManager<T>::isValid() {
+  // 读取配置数据
+  T data;
   if (!_initialized) {
-    return false;
+    return readFromFlash(data);
   }
   
-  // 读取配置数据
-  T data;
   EEPROM.get(_address, data);
   
   // 读取存储的校验和
@@ -236,14 +269,7 @@ size_t ConfigManager<T>::getStorageSize() const {
 
 template<typename T>
 byte ConfigManager<T>::calculateChecksum(const T& data) {
-  byte checksum = 0;
-  const byte* ptr = (const byte*)&data;
-  
-  for (size_t i = 0; i < sizeof(T); i++) {
-    checksum ^= ptr[i];
-  }
-  
-  return checksum;
+  return ConfigChecksum::compute(&data, sizeof(T));
 }
 
 template<typename T>
@@ -251,4 +277,22 @@ int ConfigManager<T>::getChecksumAddress() const {
   return _address + sizeof(T);
 }
 
+template<typename T>
+bool ConfigManager<T>::readFromFlash(T& data) {
+  // 配置数据与其后紧跟的校验和；地址未对齐时从前一个对齐地址开始多读最多3字节
+  uint32_t words[(sizeof(T) + sizeof(byte) + 3 + 3) / 4];
+  
+  // EEPROM 扇区位于 4MB Flash 末端，超出缓存映射的 1MB 窗口，
+  // 因此通过 SPI Flash 按字读取，而不是解引用映射地址
+  uint32_t flashAddress = ((uint32_t)&_EEPROM_start - 0x40200000) + _address;
+  uint32_t aligned = flashAddress & ~3UL;
+  if (!ESP.flashRead(aligned, words, sizeof(words))) {
+    return false;
+  }
+  
+  const uint8_t* record = (const uint8_t*)words + (flashAddress - aligned);
+  memcpy(&data, record, sizeof(T));
+  return record[sizeof(T)] == calculateChecksum(data);
+}
+
 #endif // CONFIG_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include "DeviceSettings.h"
+#include "../QuietHours/QuietHours.h"
+
+// 设置记录（含校验和）不能与静默时段或气候历史重叠
+static_assert(QUIET_HOURS_CONFIG_ADDRESS + sizeof(QuietHoursConfig) + 1 <= DEVICE_SETTINGS_ADDRESS, "Device settings overlap quiet hours");
+static_assert(DEVICE_SETTINGS_ADDRESS % 4 == 0, "Device settings must be word aligned for flash reads");
+static_assert(DEVICE_SETTINGS_ADDRESS + sizeof(DeviceSettingsData) + 1 <= 512, "Device settings overlap climate history");
+
+DeviceSettings::DeviceSettings(int address)
+  : _store(address) {
+  memset(&_data, 0, sizeof(_data));
+}
+
+void DeviceSettings::begin(const char* defaultLogOutput, const char* defaultUpdatePassword) {
+  // EEPROM 中的设置优先；日志输出目标由这里的设置决定，读取时不输出日志
+  DeviceSettingsData stored;
+  if (_store.readQuiet(stored)) {
+    _data = stored;
+  } else {
+    memset(&_data, 0, sizeof(_data));
+  }
+
+  // 未设置日志输出时使用默认值，仍保留配置模式超时记录和固件更新密码
+  if (!_data.configured || _data.logOutput > LOG_OUTPUT_NONE) {
+    _data.configured = 0;
+    LogOutput output = LOG_OUTPUT_SERIAL;
+    parseLogOutput(defaultLogOutput != nullptr ? defaultLogOutput : "", output);
+    _data.logOutput = output;
+  }
+
+  // 未设置密码时使用默认值，默认值无效时禁用固件更新
+  _data.updatePassword[UPDATE_PASSWORD_SIZE - 1] = '\0';
+  if (!_data.updatePasswordSet || (_data.updatePassword[0] != '\0' && !isValidUpdatePassword(_data.updatePassword))) {
+    _data.updatePasswordSet = 0;
+    _data.updatePassword[0] = '\0';
+    if (defaultUpdatePassword != nullptr && isValidUpdatePassword(defaultUpdatePassword)) {
+      strlcpy(_data.updatePassword, defaultUpdatePassword, UPDATE_PASSWORD_SIZE);
+    }
+  }
+}
+
+LogOutput DeviceSettings::getLogOutput() const {
+  return (LogOutput)_data.logOutput;
+}
+
+bool DeviceSettings::setLogOutput(const String& spec) {
+  LogOutput output;
+  if (!parseLogOutput(spec, output)) {
+    return false;
+  }
+
+  DeviceSettingsData data = _data;
+  data.configured = 1;
+  data.logOutput = output;
+  if (!_store.write(data)) {
+    return false;
+  }
+
+  _data = data;
+  LOG_INFO_F("Log output set to %s", formatLogOutput(output));
+  return true;
+}
+
+bool DeviceSettings::isConfigModeSuppressed() const {
+  return _data.configTimedOut != 0;
+}
+
+bool DeviceSettings::setConfigModeSuppressed(bool suppressed) {
+  if (isConfigModeSuppressed() == suppressed) {
+    return true;
+  }
+
+  DeviceSettingsData data = _data;
+  data.configTimedOut = suppressed ? 1 : 0;
+  if (!_store.write(data)) {
+    return false;
+  }
+
+  _data = data;
+  return true;
+}
+
+const char* DeviceSettings::getUpdatePassword() const {
+  return _data.updatePassword;
+}
+
+bool DeviceSettings::isUpdateEnabled() const {
+  return _data.updatePassword[0] != '\0';
+}
+
+bool DeviceSettings::setUpdatePassword(const String& password) {
+  String value = password;
+  value.trim();
+
+  DeviceSettingsData data = _data;
+  data.updatePasswordSet = 1;
+  if (value.equalsIgnoreCase("off")) {
+    data.updatePassword[0] = '\0';
+  } else if (isValidUpdatePassword(value.c_str())) {
+    strlcpy(data.updatePassword, value.c_str(), UPDATE_PASSWORD_SIZE);
+  } else {
+    return false;
+  }
+  if (!_store.write(data)) {
+    return false;
+  }
+
+  // 不记录密码本身
+  _data = data;
+  if (isUpdateEnabled()) {
+    LOG_INFO("Firmware update password set");
+  } else {
+    LOG_INFO("Firmware update disabled");
+  }
+  return true;
+}
+
+bool DeviceSettings::isValidUpdatePassword(const char* password) {
+  size_t length = strlen(password);
+  if (length < UPDATE_PASSWORD_MIN_LENGTH || length >= UPDATE_PASSWORD_SIZE) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    if (password[i] <= ' ' || password[i] > '~') {
+      return false;
+    }
+  }
+  return true;
+}
+
+const char* DeviceSettings::formatLogOutput(LogOutput output) {
+  switch (output) {
+    case LOG_OUTPUT_RTC:  return "rtc";
+    case LOG_OUTPUT_NONE: return "off";
+    default:              return "serial";
+  }
+}
+
+bool DeviceSettings::parseLogOutput(const String& spec, LogOutput& output) {
+  String value = spec;
+  value.trim();
+  value.toLowerCase();
+  if (value == "serial") {
+    output = LOG_OUTPUT_SERIAL;
+  } else if (value == "rtc") {
+    output = LOG_OUTPUT_RTC;
+  } else if (value == "off") {
+    output = LOG_OUTPUT_NONE;
+  } else {
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,87 @@
+#ifndef DEVICE_SETTINGS_H
+#define DEVICE_SETTINGS_H
+
+#include <Arduino.h>
+#include "../ConfigManager/ConfigManager.h"
+#include "../LogManager/LogManager.h"
+
+// 设备运行设置在 EEPROM 中的地址：静默时段记录之后的独立记录，不修改 ConfigData 的布局
+#define DEVICE_SETTINGS_ADDRESS 272
+
+// 固件更新密码的长度范围（缓冲区含结尾的 '\0'）
+#define UPDATE_PASSWORD_MIN_LENGTH 8
+#define UPDATE_PASSWORD_SIZE 32
+
+// 设备运行设置（EEPROM 存储）
+struct DeviceSettingsData {
+  uint8_t configured;   // 是否通过串口设置过（否则使用 config.h 中的默认值）
+  uint8_t logOutput;    // 正常唤醒的日志输出目标（LogOutput）
+  uint8_t configTimedOut; // 配置模式空闲超时后 RXD 仍被拉低，不再进入配置模式（与 configured 无关）
+  uint8_t updatePasswordSet; // 是否通过串口设置过固件更新密码（否则使用 config.h 中的默认值）
+  uint8_t reserved[4];
+  char updatePassword[UPDATE_PASSWORD_SIZE]; // 固件更新（/update）密码，空字符串表示禁用固件更新
+};
+
+/**
+ * 设备运行设置
+ * 保存可在配置模式下修改、正常唤醒时在初始化串口之前就需要的设置。
+ * 读取直接访问 Flash，不初始化 EEPROM 缓冲区
+ */
+class DeviceSettings {
+public:
+  DeviceSettings(int address = DEVICE_SETTINGS_ADDRESS);
+
+  /**
+   * 读取设置
+   * @param defaultLogOutput EEPROM 中没有设置时使用的日志输出（如 config.h 中的 DEFAULT_LOG_OUTPUT）
+   * @param defaultUpdatePassword EEPROM 中没有设置时使用的固件更新密码（如 config.h 中的 DEFAULT_UPDATE_PASSWORD），空或无效时禁用固件更新
+   */
+  void begin(const char* defaultLogOutput = "serial", const char* defaultUpdatePassword = "");
+
+  // 正常唤醒的日志输出目标
+  LogOutput getLogOutput() const;
+
+  /**
+   * 解析并保存日志输出目标
+   * @param spec "serial"、"rtc" 或 "off"
+   * @return 格式有效且保存成功
+   */
+  bool setLogOutput(const String& spec);
+
+  // 日志输出目标的名称
+  static const char* formatLogOutput(LogOutput output);
+
+  // 配置模式是否因空闲超时被抑制（RXD 恢复高电平前不再进入配置模式）
+  bool isConfigModeSuppressed() const;
+
+  /**
+   * 设置或清除配置模式抑制，状态不变时不写 Flash
+   * @return 保存成功
+   */
+  bool setConfigModeSuppressed(bool suppressed);
+
+  // 固件更新密码，空字符串表示禁用固件更新
+  const char* getUpdatePassword() const;
+
+  // 是否允许固件更新（设置了密码）
+  bool isUpdateEnabled() const;
+
+  /**
+   * 设置并保存固件更新密码
+   * @param password 8-31 个可打印 ASCII 字符（不含空格），"off" 禁用固件更新
+   * @return 格式有效且保存成功
+   */
+  bool setUpdatePassword(const String& password);
+
+  // 检查固件更新密码格式
+  static bool isValidUpdatePassword(const char* password);
+
+  // 解析日志输出目标，无效时返回 false
+  static bool parseLogOutput(const String& spec, LogOutput& output);
+
+private:
+  ConfigManager<DeviceSettingsData> _store;
+  DeviceSettingsData _data;
+};
+
+#endif // DEVICE_SETTINGS_H
@@ -0,0 +1,207 @@
+// 由 scripts/subset_fonts.py 根据 lib/Fonts/DSEG7Modern_Bold28pt7b.h 生成，请勿手动修改
+// 包含字符：0123456789:
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t DSEG7Modern_Bold28pt7bBitmaps[] PROGMEM = {
+  0x7F, 0xFF, 0xFF, 0xFE, 0x5F, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF,
+  0xDF, 0x3F, 0xFF, 0xFF, 0xF7, 0xE3, 0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xFF,
+  0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+  0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x31, 0xE0, 0x00, 0x00, 0x0E, 0x98,
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+  0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0,
+  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
+  0xFD, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xBF, 0xFF, 0xFF,
+  0x8F, 0xDF, 0xFF, 0xFF, 0xF9, 0xE7, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF,
+  0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0x31, 0xC7, 0x3C, 0xF7, 0xDF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+  0x1C, 0x33, 0x0E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xC1, 0x7F, 0xFF, 0xFF,
+  0xFE, 0x5F, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xDC, 0x3F, 0xFF,
+  0xFF, 0xF7, 0x03, 0xFF, 0xFF, 0xFB, 0xC0, 0x7F, 0xFF, 0xFC, 0xF0, 0x07,
+  0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+  0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0xF1, 0xC0, 0x3F, 0xFF, 0xFE, 0x30,
+  0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x83, 0xFF, 0xFF, 0xF0,
+  0x39, 0xFF, 0xFF, 0xF8, 0x0F, 0x1F, 0xFF, 0xFE, 0x03, 0xF0, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00,
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+  0xC0, 0x3E, 0xFF, 0xFF, 0xFC, 0x0F, 0xBF, 0xFF, 0xFF, 0x83, 0xDF, 0xFF,
+  0xFF, 0xF8, 0xE7, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xDF,
+  0xFF, 0xFF, 0xFE, 0xE3, 0xFF, 0xFF, 0xFF, 0x70, 0x7F, 0xFF, 0xFF, 0x78,
+  0x1F, 0xFF, 0xFF, 0x3C, 0x03, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
+  0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
+  0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xFF, 0xFF, 0xE3, 0x80, 0xFF,
+  0xFF, 0xF8, 0xC0, 0xFF, 0xFF, 0xFD, 0x80, 0x7F, 0xFF, 0xFC, 0xE0, 0x7F,
+  0xFF, 0xFE, 0xF8, 0x7F, 0xFF, 0xFE, 0xFC, 0x0F, 0xFF, 0xFF, 0x7E, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8,
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
+  0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xFF, 0xFF,
+  0x9F, 0x83, 0xFF, 0xFF, 0xF3, 0xC1, 0xFF, 0xFF, 0xFC, 0x61, 0xFF, 0xFF,
+  0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xFE,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F,
+  0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0xF1,
+  0xFF, 0x3F, 0xFF, 0xFE, 0x3F, 0xDF, 0xFF, 0xFF, 0xB1, 0xE7, 0xFF, 0xFF,
+  0xCE, 0x1B, 0xFF, 0xFF, 0xF7, 0xC1, 0xFF, 0xFF, 0xFB, 0xF0, 0x1F, 0xFF,
+  0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xC3, 0x3F, 0xFF, 0xFF, 0xF0,
+  0xE3, 0xFF, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xFC, 0x0F, 0xE7, 0xFF, 0xFF,
+  0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
+  0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+  0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+  0x00, 0xFE, 0xFF, 0xFF, 0xF0, 0x3F, 0x3F, 0xFF, 0xFE, 0x0F, 0xDF, 0xFF,
+  0xFF, 0xB1, 0xE7, 0xFF, 0xFF, 0xCE, 0x1B, 0xFF, 0xFF, 0xF7, 0xC1, 0xFF,
+  0xFF, 0xFB, 0xF0, 0x1F, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0xFF, 0xCF, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xF0, 0x3F, 0xFF, 0xFF, 0x8C, 0x1F, 0xFF, 0xFF, 0xF9,
+  0x07, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+  0xFF, 0xC3, 0x3F, 0xFF, 0xFF, 0xF0, 0xE3, 0xFF, 0xFF, 0xF8, 0x3E, 0x7F,
+  0xFF, 0xFC, 0x0F, 0xE7, 0xFF, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0,
+  0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF0, 0x3F,
+  0x3F, 0xFF, 0xFE, 0x0F, 0xDF, 0xFF, 0xFF, 0xB1, 0xE7, 0xFF, 0xFF, 0xCE,
+  0x9B, 0xFF, 0xFF, 0xF7, 0xF9, 0xFF, 0xFF, 0xFB, 0xFF, 0x1F, 0xFF, 0xFE,
+  0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x3F, 0xFD, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xBF, 0xFF,
+  0xFF, 0x8F, 0xDF, 0xFF, 0xFF, 0xF9, 0xE7, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x5F,
+  0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xDF, 0x3F, 0xFF, 0xFF, 0xF7,
+  0xE3, 0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF,
+  0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+  0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x00, 0x31, 0xE0, 0x00, 0x00, 0x0E, 0x18, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
+  0x7F, 0xFF, 0xFF, 0xFE, 0x5F, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF,
+  0xDF, 0x3F, 0xFF, 0xFF, 0xF7, 0xE3, 0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xFF,
+  0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+  0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F,
+  0xFF, 0xFE, 0x3F, 0xDF, 0xFF, 0xFF, 0xB1, 0xE7, 0xFF, 0xFF, 0xCE, 0x9B,
+  0xFF, 0xFF, 0xF7, 0xF9, 0xFF, 0xFF, 0xFB, 0xFF, 0x1F, 0xFF, 0xFE, 0xFF,
+  0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+  0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0,
+  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
+  0xFD, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xBF, 0xFF, 0xFF,
+  0x8F, 0xDF, 0xFF, 0xFF, 0xF9, 0xE7, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF,
+  0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xDF, 0x3F, 0xFF, 0xFF, 0xF7, 0xE3,
+  0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0x7F,
+  0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
+  0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0,
+  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+  0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
+  0xFE, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F, 0xFF, 0xFE, 0x3F, 0xDF, 0xFF, 0xFF,
+  0xB1, 0xE7, 0xFF, 0xFF, 0xCE, 0x1B, 0xFF, 0xFF, 0xF7, 0xC1, 0xFF, 0xFF,
+  0xFB, 0xF0, 0x1F, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+  0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF,
+  0xFF, 0xFC, 0xF0, 0x3F, 0xFF, 0xFF, 0x8C, 0x1F, 0xFF, 0xFF, 0xF9, 0x07,
+  0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x7D, 0xFF, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x3E, 0xFF, 0xFF, 0xFB,
+  0xE3, 0x80,
+};
+
+const GFXglyph DSEG7Modern_Bold28pt7bGlyphs[] PROGMEM = {
+  {     0,  34,  55,  45,    5,  -54 },   // 0x30 '0'
+  {   234,   6,  52,  45,   33,  -54 },   // 0x31 '1'
+  {   273,  34,  55,  45,    5,  -54 },   // 0x32 '2'
+  {   507,  33,  55,  45,    6,  -54 },   // 0x33 '3'
+  {   734,  34,  52,  45,    5,  -54 },   // 0x34 '4'
+  {   955,  34,  55,  45,    5,  -54 },   // 0x35 '5'
+  {  1189,  34,  55,  45,    5,  -54 },   // 0x36 '6'
+  {  1423,  34,  52,  45,    5,  -54 },   // 0x37 '7'
+  {  1644,  34,  55,  45,    5,  -54 },   // 0x38 '8'
+  {  1878,  34,  55,  45,    5,  -54 },   // 0x39 '9'
+  {  2112,   7,  29,  11,    2,  -40 },   // 0x3A ':'
+};
+
+const GFXfont DSEG7Modern_Bold28pt7b PROGMEM = {
+  (uint8_t  *)DSEG7Modern_Bold28pt7bBitmaps,
+  (GFXglyph *)DSEG7Modern_Bold28pt7bGlyphs,
+  0x30, 0x3A, 60 };
+
+// Approx. 2238 bytes
@@ -0,0 +1,46 @@
+// 由 scripts/subset_fonts.py 根据 lib/Fonts/Weather_Symbols_Regular9pt7b.h 生成，请勿手动修改
+// 包含字符：acdefhklmnop
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t Weather_Symbols_Regular9pt7bBitmaps[] PROGMEM = {
+  0x1C, 0x08, 0xC2, 0x0B, 0x01, 0x80, 0x60, 0x17, 0xF8, 0x60, 0x18, 0x07,
+  0x00, 0x80, 0x40, 0x58, 0x05, 0x4C, 0x1F, 0xB1, 0xF0, 0xE4, 0x80, 0x98,
+  0x04, 0x80, 0x24, 0x03, 0x1F, 0xF0, 0x08, 0x2E, 0xB2, 0xAD, 0x69, 0xC8,
+  0xE3, 0xAF, 0x95, 0x5D, 0x04, 0x00, 0x72, 0x94, 0xA5, 0x39, 0xDD, 0xFD,
+  0xDC, 0x1F, 0xC0, 0xF8, 0x87, 0xE1, 0x82, 0x01, 0xF8, 0x05, 0xE0, 0x17,
+  0xFF, 0x80, 0x72, 0x9C, 0xE7, 0x3B, 0xBB, 0xDB, 0x80, 0x1C, 0x08, 0xC2,
+  0x0B, 0x01, 0x80, 0x60, 0x17, 0xF9, 0x64, 0x59, 0x17, 0x40, 0x80, 0x40,
+  0x3E, 0x10, 0xC4, 0x0A, 0x01, 0x80, 0x60, 0x37, 0xF8, 0x00, 0x2A, 0x05,
+  0x00, 0x80, 0x1E, 0x08, 0x42, 0x0B, 0x01, 0x80, 0x60, 0x17, 0xF8, 0x00,
+  0x2A, 0x0A, 0x80, 0x14, 0x83, 0xA1, 0x93, 0x97, 0xCF, 0xF6, 0x3E, 0x0B,
+  0xB2, 0x8B, 0x1D, 0x82, 0xA0, 0x0B, 0x83, 0x66, 0x23, 0x96, 0x0D, 0x80,
+  0x68, 0x04, 0x80, 0x48, 0x08, 0x7F, 0x80, 0x1E, 0x08, 0x46, 0x0A, 0x01,
+  0x80, 0x60, 0x17, 0xF8,
+};
+
+const GFXglyph Weather_Symbols_Regular9pt7bGlyphs[] PROGMEM = {
+  {     0,  10,  12,  12,    1,  -11 },   // 0x61 'a'
+  {    15,   0,   0,   8,    0,    0 },   // 0x62 'b'
+  {    15,  13,   9,  14,    0,  -10 },   // 0x63 'c'
+  {    30,   9,  10,  10,    1,  -10 },   // 0x64 'd'
+  {    42,   5,  11,   5,    0,  -11 },   // 0x65 'e'
+  {    49,  14,   7,  15,    0,   -9 },   // 0x66 'f'
+  {    62,   0,   0,  12,    0,    0 },   // 0x67 'g'
+  {    62,   5,  10,   5,    0,  -11 },   // 0x68 'h'
+  {    69,   0,   0,  10,    0,    0 },   // 0x69 'i'
+  {    69,   0,   0,  11,    0,    0 },   // 0x6A 'j'
+  {    69,  10,  12,  12,    1,  -11 },   // 0x6B 'k'
+  {    84,  10,  11,  12,    1,  -11 },   // 0x6C 'l'
+  {    98,  10,  10,  12,    1,  -10 },   // 0x6D 'm'
+  {   111,  11,  10,  12,    0,  -10 },   // 0x6E 'n'
+  {   125,  12,   9,  14,    1,  -10 },   // 0x6F 'o'
+  {   139,  10,   7,  12,    1,   -9 },   // 0x70 'p'
+};
+
+const GFXfont Weather_Symbols_Regular9pt7b PROGMEM = {
+  (uint8_t  *)Weather_Symbols_Regular9pt7bBitmaps,
+  (GFXglyph *)Weather_Symbols_Regular9pt7bGlyphs,
+  0x61, 0x70, 18 };
+
+// Approx. 288 bytes
@@ -0,0 +1,161 @@
+#include "FrameCapture.h"
+#include "../LogManager/LogManager.h"
+
+// 测试矩阵中的一帧
+struct FrameCase {
+  const char* name;
+  uint8_t hour;
+  uint8_t minute;
+  char symbol;              // 天气符号：n 晴, d 雪, m 雨, l 雾, c 阴, o 多云, k 雷雨
+  float temperature;        // 室内温度，NaN 表示传感器读取失败
+  float humidity;           // 室内湿度
+  float battery;            // 电量（%），NaN 表示未接电池
+  DisplayLayoutId layout;
+  bool sparkline;           // 是否绘制合成的趋势图
+};
+
+// 覆盖各天气符号、时间位数变化、传感器失败、电量边界和各布局
+static const FrameCase FRAME_CASES[] = {
+  {"standard-sunny",        12, 34, 'n', 23.4f, 45.0f,  87.0f, LAYOUT_STANDARD,    true},
+  {"standard-midnight-snow", 0,  0, 'd', -5.2f, 80.0f,  50.0f, LAYOUT_STANDARD,    true},
+  {"standard-rain-full",    23, 59, 'm', 18.0f, 99.0f, 100.0f, LAYOUT_STANDARD,    false},
+  {"standard-fog-no-sensor", 8,  8, 'l',   NAN,   NAN,  60.0f, LAYOUT_STANDARD,    true},
+  {"standard-overcast",     10, 10, 'c', 19.5f, 62.0f,  25.0f, LAYOUT_STANDARD,    true},
+  {"standard-no-battery",   11, 11, 'o', 21.0f, 55.0f,    NAN, LAYOUT_STANDARD,    true},
+  {"standard-thunder-low",  19, 45, 'k', 26.0f, 70.0f,   5.0f, LAYOUT_STANDARD,    true},
+  {"large-clock",            7, 30, 'c', 20.0f, 50.0f,  75.0f, LAYOUT_LARGE_CLOCK, false},
+  {"large-clock-no-sensor", 20, 48, 'n',   NAN,   NAN,    NAN, LAYOUT_LARGE_CLOCK, false},
+  {"low-battery",           18,  5, 'm', 22.0f, 40.0f,   5.0f, LAYOUT_LOW_BATTERY, false},
+};
+
+#define FRAME_CASE_COUNT (sizeof(FRAME_CASES) / sizeof(FRAME_CASES[0]))
+
+// 合成的24小时温度曲线：三角形起伏，中间留一段无数据的列
+static void buildSyntheticSeries(ClimateSeries& series) {
+  int half = SPARKLINE_WIDTH / 2;
+  series.columns = SPARKLINE_WIDTH;
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) {
+    if (i >= 20 && i < 26) {
+      series.minValue[i] = CLIMATE_INVALID_VALUE;
+      series.maxValue[i] = CLIMATE_INVALID_VALUE;
+      continue;
+    }
+    int16_t value = 2100 + 400 * (half - abs(i - half)) / half;
+    series.minValue[i] = value - 15;
+    series.maxValue[i] = value + 15;
+  }
+}
+
+// 固定的天气数据，风向和风速也固定，保证每次输出一致
+static void buildWeather(WeatherInfo& weather) {
+  weather.Temperature = 24.0f;
+  weather.Humidity = 65;
+  weather.Symbol = 'n';
+  weather.WindDirection = "东北";
+  weather.WindSpeed = "≤3";
+  weather.Weather = "";
+}
+
+FrameCapture::FrameCapture(GDEY029T94* display)
+  : _display(display) {
+}
+
+int FrameCapture::getCaseCount() {
+  return FRAME_CASE_COUNT;
+}
+
+void FrameCapture::captureCurrent(Print& out) {
+  out.println(F(FRAME_CAPTURE_BEGIN));
+  writeFrame(out, "current", 0);
+  out.println(F(FRAME_CAPTURE_END));
+}
+
+int FrameCapture::captureMatrix(Print& out, const String& filter) {
+  DisplayLayoutId savedLayout = _display->getLayout();
+
+  ClimateSeries series;
+  WeatherInfo weather;
+  buildSyntheticSeries(series);
+  buildWeather(weather);
+
+  int captured = 0;
+  out.println(F(FRAME_CAPTURE_BEGIN));
+  for (size_t i = 0; i < FRAME_CASE_COUNT; i++) {
+    const FrameCase& frame = FRAME_CASES[i];
+    if (filter.length() > 0 && strstr(frame.name, filter.c_str()) == nullptr) {
+      continue;
+    }
+
+    unsigned long renderStart = micros();
+    renderCase(i, series, weather);
+    unsigned long renderMicros = micros() - renderStart;
+
+    writeFrame(out, frame.name, renderMicros);
+    captured++;
+  }
+  out.println(F(FRAME_CAPTURE_END));
+
+  _display->setLayout(savedLayout);
+  LOG_INFO_F("FrameCapture: %d frames exported", captured);
+  return captured;
+}
+
+void FrameCapture::writeFrame(Print& out, const char* name, unsigned long renderMicros) {
+  out.print(F("FRAME "));
+  out.print(name);
+  out.print(F(" render_us="));
+  out.println(renderMicros);
+  _display->exportFrame(out);
+  out.println(F("END"));
+}
+
+void FrameCapture::renderCase(size_t index, const ClimateSeries& series, WeatherInfo& weather) {
+  const FrameCase& frame = FRAME_CASES[index];
+  DateTime time = {25, 6, 15, frame.hour, frame.minute, 0};
+  weather.Symbol = frame.symbol;
+  _display->setLayout(frame.layout);
+  _display->renderTimeDisplay(time, weather, frame.temperature, frame.humidity, frame.battery, frame.sparkline ? &series : nullptr);
+}
+
+bool FrameCapture::benchmark(Print& out, int iterations) {
+  if (iterations < 1) {
+    iterations = 1;
+  }
+
+  DisplayLayoutId savedLayout = _display->getLayout();
+  ClimateSeries series;
+  WeatherInfo weather;
+  buildSyntheticSeries(series);
+  buildWeather(weather);
+
+  bool allMatch = true;
+  unsigned long totals[2] = {0, 0};
+  out.printf("Render benchmark (%d iterations, us per frame)\n", iterations);
+  out.printf("%-24s %8s %8s %6s\n", "frame", "gfx", "fast", "match");
+  for (size_t i = 0; i < FRAME_CASE_COUNT; i++) {
+    unsigned long elapsed[2];
+    uint32_t checksum[2];
+
+    // 0 = GFX 逐像素路径，1 = 快速路径
+    for (int path = 0; path < 2; path++) {
+      _display->setFastRaster(path == 1);
+      unsigned long start = micros();
+      for (int n = 0; n < iterations; n++) {
+        renderCase(i, series, weather);
+      }
+      elapsed[path] = (micros() - start) / iterations;
+      checksum[path] = _display->getFrameChecksum();
+      totals[path] += elapsed[path];
+      yield();
+    }
+
+    bool match = checksum[0] == checksum[1];
+    allMatch = allMatch && match;
+    out.printf("%-24s %8lu %8lu %6s\n", FRAME_CASES[i].name, elapsed[0], elapsed[1], match ? "yes" : "NO");
+  }
+  out.printf("%-24s %8lu %8lu %6s\n", "total", totals[0], totals[1], allMatch ? "yes" : "NO");
+
+  _display->setFastRaster(true);
+  _display->setLayout(savedLayout);
+  return allMatch;
+}
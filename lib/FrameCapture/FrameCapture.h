@@ -0,0 +1,45 @@
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <Arduino.h>
+#include "../GDEY029T94/GDEY029T94.h"
+#include "../WeatherManager/WeatherManager.h"
+#include "../ClimateHistory/ClimateHistory.h"
+
+// 帧导出的起止标记，scripts/golden_frames.py 按这些标记解析串口输出
+#define FRAME_CAPTURE_BEGIN "FRAMES BEGIN"
+#define FRAME_CAPTURE_END "FRAMES END"
+
+/**
+ * 渲染帧导出
+ * 按固定的测试矩阵（时间、天气符号、传感器 NaN、电量、布局、趋势图）逐帧渲染到
+ * GDEY029T94 的帧缓冲，不刷新屏幕，将每帧以 PBM 十六进制行和渲染耗时输出到串口，
+ * 由 scripts/golden_frames.py 与基准图像逐像素比较并检查渲染耗时
+ */
+class FrameCapture {
+public:
+  FrameCapture(GDEY029T94* display);
+
+  // 输出帧缓冲中的当前画面
+  void captureCurrent(Print& out);
+
+  // 渲染并输出测试矩阵，filter 不为空时只输出名称包含 filter 的帧
+  int captureMatrix(Print& out, const String& filter = "");
+
+  // 分别用 GFX 逐像素路径和帧缓冲快速路径渲染测试矩阵，输出每帧平均耗时并检查两者结果一致
+  bool benchmark(Print& out, int iterations = 10);
+
+  // 测试矩阵中的帧数
+  static int getCaseCount();
+
+private:
+  // 输出一帧：FRAME 行、PBM 数据、END
+  void writeFrame(Print& out, const char* name, unsigned long renderMicros);
+
+  // 渲染测试矩阵中的一帧
+  void renderCase(size_t index, const ClimateSeries& series, WeatherInfo& weather);
+
+  GDEY029T94* _display;
+};
+
+#endif // FRAME_CAPTURE_H
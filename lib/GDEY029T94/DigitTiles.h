@@ -0,0 +1,534 @@
+// 由 scripts/generate_digit_tiles.py 根据 lib/Fonts/subset/DSEG7Modern_Bold28pt7b.h 生成，请勿手动修改
+#pragma once
+#include <Arduino.h>
+
+// 生成瓦片时使用的时间基线（逻辑坐标 y）
+#define DIGIT_TILE_BASELINE 85
+
+// 瓦片在原生坐标中的起始列（8 像素对齐）和每行字节数
+#define DIGIT_TILE_NATIVE_X 40
+#define DIGIT_TILE_ROW_BYTES 8
+
+// 源字体特征，用于确认当前时间字体与瓦片一致
+#define DIGIT_TILE_FONT_Y_ADVANCE 60
+#define DIGIT_TILE_FONT_ZERO_OFFSET 0
+#define DIGIT_TILE_FONT_ZERO_WIDTH 34
+#define DIGIT_TILE_FONT_ZERO_HEIGHT 55
+
+// 单个字符瓦片：rows 为原生行数（即逻辑宽度），data 为空表示全白
+struct DigitTile {
+  char ch;
+  uint8_t rows;
+  const uint8_t* data;
+};
+
+static const uint8_t DigitTile0[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFF,
+  0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x7F,
+  0xE0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x7F,
+  0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0C, 0x7F,
+  0xCC, 0x00, 0x00, 0x30, 0x00, 0x00, 0x08, 0x7F,
+  0xC3, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x7F,
+  0xC0, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xC1, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x70, 0x7F,
+  0xC3, 0x00, 0x00, 0x07, 0x80, 0x00, 0x18, 0x7F,
+  0xC2, 0x00, 0x00, 0x01, 0x80, 0x00, 0x06, 0x7F,
+  0xC6, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xC4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xC8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile1[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xFF,
+  0xFF, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF,
+  0xFE, 0x00, 0x00, 0x01, 0x80, 0x00, 0x07, 0xFF,
+  0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xF8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile2[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x7F,
+  0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x7F,
+  0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F,
+  0xCC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC3, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC0, 0xC0, 0x00, 0x67, 0xFF, 0xFF, 0xF0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC1, 0xFF, 0xFF, 0xFC, 0xC0, 0x00, 0x70, 0x7F,
+  0xC3, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x18, 0x7F,
+  0xC3, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0x7F,
+  0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+  0xC7, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF,
+  0xCF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile3[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC3, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC1, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x70, 0x7F,
+  0xC3, 0x00, 0x00, 0x07, 0x80, 0x00, 0x18, 0x7F,
+  0xC2, 0x00, 0x00, 0x01, 0x80, 0x00, 0x06, 0x7F,
+  0xC6, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xC4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xC8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile4[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x7F, 0xFF,
+  0xFF, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF,
+  0xFE, 0x00, 0x00, 0x01, 0x80, 0x00, 0x07, 0xFF,
+  0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xF8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile5[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0C, 0x7F,
+  0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0x7F,
+  0xC3, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x18, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x10, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC1, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF0, 0x7F,
+  0xC3, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC2, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F,
+  0xC6, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile6[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFF,
+  0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x7F,
+  0xE0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x7F,
+  0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0C, 0x7F,
+  0xCC, 0x00, 0x00, 0x30, 0x00, 0x00, 0x08, 0x7F,
+  0xC3, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x18, 0x7F,
+  0xC0, 0xC0, 0x00, 0x67, 0x00, 0x00, 0x10, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC1, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF0, 0x7F,
+  0xC3, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xC2, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F,
+  0xC6, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile7[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0C, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x18, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x10, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+  0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x70, 0x7F,
+  0xFF, 0x00, 0x00, 0x07, 0x80, 0x00, 0x18, 0x7F,
+  0xFE, 0x00, 0x00, 0x01, 0x80, 0x00, 0x06, 0x7F,
+  0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xF8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile8[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFF,
+  0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x7F,
+  0xE0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x7F,
+  0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0C, 0x7F,
+  0xCC, 0x00, 0x00, 0x30, 0x00, 0x00, 0x08, 0x7F,
+  0xC3, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x18, 0x7F,
+  0xC0, 0xC0, 0x00, 0x67, 0x00, 0x00, 0x10, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC1, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x70, 0x7F,
+  0xC3, 0x00, 0x00, 0x07, 0x80, 0x00, 0x18, 0x7F,
+  0xC2, 0x00, 0x00, 0x01, 0x80, 0x00, 0x06, 0x7F,
+  0xC6, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xC4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xC8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTile9[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0C, 0x7F,
+  0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0x7F,
+  0xC3, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x18, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x10, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x7F,
+  0xC1, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x70, 0x7F,
+  0xC3, 0x00, 0x00, 0x07, 0x80, 0x00, 0x18, 0x7F,
+  0xC2, 0x00, 0x00, 0x01, 0x80, 0x00, 0x06, 0x7F,
+  0xC6, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
+  0xC4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF,
+  0xC8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t DigitTileColon[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const DigitTile DIGIT_TILES[] = {
+  {'0', 45, DigitTile0},
+  {'1', 45, DigitTile1},
+  {'2', 45, DigitTile2},
+  {'3', 45, DigitTile3},
+  {'4', 45, DigitTile4},
+  {'5', 45, DigitTile5},
+  {'6', 45, DigitTile6},
+  {'7', 45, DigitTile7},
+  {'8', 45, DigitTile8},
+  {'9', 45, DigitTile9},
+  {':', 11, DigitTileColon},
+  {' ', 45, nullptr},
+};
+
+#define DIGIT_TILE_COUNT (sizeof(DIGIT_TILES) / sizeof(DIGIT_TILES[0]))
@@ -0,0 +1,240 @@
+#ifndef DISPLAY_LAYOUT_H
+#define DISPLAY_LAYOUT_H
+
+#include <Arduino.h>
+#include "FontMetrics.h"
+#include "../TimeManager/Calendar.h"
+
+// ==================== 布局基础参数 ====================
+// 逻辑屏幕尺寸（旋转 1，横屏）
+#define LAYOUT_SCREEN_WIDTH 296
+#define LAYOUT_SCREEN_HEIGHT 128
+
+// 左右边距（8 像素对齐）
+#define LAYOUT_MARGIN 8
+
+// 顶部分隔线位置，以及时间与上下分隔线的间距
+// scripts/generate_digit_tiles.py 读取这两个值计算数字瓦片的基线
+#define LAYOUT_TOP_LINE_Y 20
+#define LAYOUT_TIME_GAP 10
+
+// 右侧温湿度栏的分隔线位置
+#define LAYOUT_DIVIDER_X 232
+
+// 布局编号
+enum DisplayLayoutId {
+  LAYOUT_STANDARD = 0,     // 标准布局：天气、时间、日期、温湿度、趋势图
+  LAYOUT_LARGE_CLOCK = 1,  // 大时钟：日期、电池和大号时间
+  LAYOUT_LOW_BATTERY = 2,  // 低电量：只保留时间、日期和电池提示
+  LAYOUT_COUNT = 3
+};
+
+// 文字对齐方式
+enum LayoutAlign : uint8_t {
+  ALIGN_LEFT,
+  ALIGN_CENTER,
+  ALIGN_RIGHT
+};
+
+// 时间字体
+enum LayoutClockFont : uint8_t {
+  CLOCK_FONT_NORMAL,  // setTimeFont() 设置的字体（DSEG7Modern_Bold28pt7b）
+  CLOCK_FONT_LARGE    // setLargeTimeFont() 设置的字体（DSEG7Modern_Bold42pt7b）
+};
+
+// 矩形区域（逻辑坐标），宽或高为 0 表示该区域不显示
+struct LayoutRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  constexpr bool visible() const { return w > 0 && h > 0; }
+  constexpr int16_t right() const { return x + w; }
+  constexpr int16_t bottom() const { return y + h; }
+  constexpr bool intersects(const LayoutRect& other) const {
+    return visible() && other.visible() && x < other.right() && other.x < right() && y < other.bottom() && other.y < bottom();
+  }
+};
+
+// 文字区域：外接矩形、基线和对齐方式
+struct TextSlot {
+  LayoutRect rect;
+  int16_t baseline;
+  LayoutAlign align;
+};
+
+// 字体度量（FontMetrics、*_FONT_METRICS）由 scripts/generate_digit_tiles.py
+// 根据字形表生成，见 FontMetrics.h
+
+// 一套完整的界面布局，渲染和局部刷新窗口共用同一组矩形
+struct DisplayLayout {
+  const char* name;
+  TextSlot weather;         // 天气文字
+  LayoutRect symbol;        // 天气符号（在区域内右对齐）
+  TextSlot status;          // 状态提示
+  int16_t topLineY;         // 顶部分隔线（<0 不画）
+  LayoutClockFont clockFont;
+  LayoutRect time;          // 时间（x 为光标位置）
+  int16_t timeBaseline;
+  int16_t bottomLineY;      // 底部分隔线（<0 不画）
+  TextSlot date;            // 日期
+  TextSlot temperature;     // 室内温度
+  TextSlot humidity;        // 室内湿度
+  int16_t dividerX;         // 温湿度栏分隔线（<0 不画）
+  LayoutRect battery;       // 电池图标
+  LayoutRect sparkline;     // 温度趋势图
+};
+
+// ==================== 布局推导 ====================
+
+constexpr int16_t layoutAlign8(int16_t x) {
+  return (x / 8) * 8;
+}
+
+// "00:00" 的墨迹宽度
+constexpr int16_t clockInkWidth(const FontMetrics& font) {
+  return 4 * font.advance + font.colonAdvance - font.inkLeft - font.inkRight;
+}
+
+// "00:00" 的光标宽度
+constexpr int16_t clockCellWidth(const FontMetrics& font) {
+  return 4 * font.advance + font.colonAdvance;
+}
+
+// 在 [0, areaWidth) 内居中时间的光标位置
+constexpr int16_t clockX(const FontMetrics& font, int16_t areaWidth) {
+  return layoutAlign8((areaWidth - clockInkWidth(font)) / 2);
+}
+
+// 时间外接矩形
+constexpr LayoutRect clockRect(const FontMetrics& font, int16_t x, int16_t baseline) {
+  return LayoutRect{x, (int16_t)(baseline - font.ascent), clockCellWidth(font), (int16_t)(font.ascent + font.descent + 1)};
+}
+
+// 小字体单行文字区域
+constexpr TextSlot textSlot(int16_t x, int16_t w, int16_t baseline, LayoutAlign align) {
+  return TextSlot{LayoutRect{x, (int16_t)(baseline - SMALL_FONT_METRICS.ascent), w, (int16_t)(SMALL_FONT_METRICS.ascent + SMALL_FONT_METRICS.descent + 1)}, baseline, align};
+}
+
+constexpr TextSlot NO_TEXT = {LayoutRect{0, 0, 0, 0}, 0, ALIGN_LEFT};
+constexpr LayoutRect NO_RECT = {0, 0, 0, 0};
+
+// 小字体行距
+constexpr int16_t LAYOUT_ROW_PITCH = 20;
+
+// 各行基线：小字体行的下沿紧贴其下方的分隔线，分隔线下的第一行与屏幕顶部的第一行同高
+constexpr int16_t LAYOUT_TOP_BASELINE = LAYOUT_TOP_LINE_Y - SMALL_FONT_METRICS.descent - 1;
+constexpr int16_t LAYOUT_CLOCK_BASELINE = LAYOUT_TOP_LINE_Y + CLOCK_FONT_METRICS.ascent + 1 + LAYOUT_TIME_GAP;
+constexpr int16_t LAYOUT_BOTTOM_LINE_Y = LAYOUT_CLOCK_BASELINE + LAYOUT_TIME_GAP;
+constexpr int16_t LAYOUT_DATE_BASELINE = LAYOUT_BOTTOM_LINE_Y + LAYOUT_ROW_PITCH;
+constexpr int16_t LAYOUT_TEMPERATURE_BASELINE = LAYOUT_TOP_LINE_Y + LAYOUT_TOP_BASELINE;
+constexpr int16_t LAYOUT_HUMIDITY_BASELINE = LAYOUT_TEMPERATURE_BASELINE + LAYOUT_ROW_PITCH;
+
+// 右侧栏（天气符号、温湿度）的右边界
+constexpr int16_t LAYOUT_RIGHT_EDGE = LAYOUT_SCREEN_WIDTH - LAYOUT_MARGIN - 2;
+
+// 天气符号区域：最宽的符号右对齐后的 8 像素对齐位置，天气文字在其左侧留出一个边距
+constexpr int16_t LAYOUT_SYMBOL_X = layoutAlign8(LAYOUT_RIGHT_EDGE - SYMBOL_FONT_METRICS.advance);
+
+// 日期区域按 TimeManager::getFormattedDate() 最长的输出计算："YYYY/MM/DD " + 星期名称
+constexpr int16_t LAYOUT_DATE_MAX_CHARS = 11 + CALENDAR_DAY_NAME_MAX_LENGTH;
+constexpr int16_t LAYOUT_DATE_WIDTH = LAYOUT_DATE_MAX_CHARS * SMALL_FONT_METRICS.advance;
+
+// 温湿度栏文字区域
+constexpr int16_t LAYOUT_CLIMATE_X = LAYOUT_DIVIDER_X + LAYOUT_MARGIN;
+constexpr int16_t LAYOUT_CLIMATE_WIDTH = LAYOUT_RIGHT_EDGE - LAYOUT_CLIMATE_X;
+
+// 趋势图区域（温湿度栏中湿度下方，与上下相邻内容各留 3 像素，宽度即抽样列数）
+constexpr int16_t SPARKLINE_X = LAYOUT_CLIMATE_X;
+constexpr int16_t SPARKLINE_Y = LAYOUT_HUMIDITY_BASELINE + SMALL_FONT_METRICS.descent + 1 + 3;
+constexpr int16_t SPARKLINE_WIDTH = LAYOUT_CLIMATE_WIDTH;
+constexpr int16_t SPARKLINE_HEIGHT = LAYOUT_BOTTOM_LINE_Y - 3 - SPARKLINE_Y;
+
+// 电池图标区域（含左侧正极帽）
+constexpr int16_t LAYOUT_BATTERY_WIDTH = 27;
+constexpr int16_t LAYOUT_BATTERY_HEIGHT = 12;
+constexpr LayoutRect batteryRect(int16_t baseline) {
+  return LayoutRect{(int16_t)(layoutAlign8(LAYOUT_SCREEN_WIDTH - 25) - 3), (int16_t)(baseline - LAYOUT_BATTERY_HEIGHT + 2), LAYOUT_BATTERY_WIDTH, LAYOUT_BATTERY_HEIGHT};
+}
+
+// 大时钟：时间在顶部分隔线以下的区域内垂直居中
+constexpr int16_t LAYOUT_LARGE_CLOCK_BASELINE = LAYOUT_TOP_LINE_Y + (LAYOUT_SCREEN_HEIGHT - LAYOUT_TOP_LINE_Y - (LARGE_CLOCK_FONT_METRICS.ascent + 1)) / 2 + LARGE_CLOCK_FONT_METRICS.ascent;
+
+// ==================== 布局定义 ====================
+
+constexpr DisplayLayout DISPLAY_LAYOUTS[LAYOUT_COUNT] = {
+  // 标准布局
+  {
+    "standard",
+    textSlot(LAYOUT_MARGIN, LAYOUT_SYMBOL_X - 2 * LAYOUT_MARGIN, LAYOUT_TOP_BASELINE, ALIGN_LEFT),
+    LayoutRect{LAYOUT_SYMBOL_X, 0, LAYOUT_RIGHT_EDGE - LAYOUT_SYMBOL_X, LAYOUT_TOP_LINE_Y - 1},
+    NO_TEXT,
+    LAYOUT_TOP_LINE_Y,
+    CLOCK_FONT_NORMAL,
+    clockRect(CLOCK_FONT_METRICS, clockX(CLOCK_FONT_METRICS, LAYOUT_DIVIDER_X), LAYOUT_CLOCK_BASELINE),
+    LAYOUT_CLOCK_BASELINE,
+    LAYOUT_BOTTOM_LINE_Y,
+    textSlot(LAYOUT_MARGIN, LAYOUT_DATE_WIDTH, LAYOUT_DATE_BASELINE, ALIGN_LEFT),
+    textSlot(LAYOUT_CLIMATE_X, LAYOUT_CLIMATE_WIDTH, LAYOUT_TEMPERATURE_BASELINE, ALIGN_RIGHT),
+    textSlot(LAYOUT_CLIMATE_X, LAYOUT_CLIMATE_WIDTH, LAYOUT_HUMIDITY_BASELINE, ALIGN_RIGHT),
+    LAYOUT_DIVIDER_X,
+    batteryRect(LAYOUT_DATE_BASELINE),
+    LayoutRect{SPARKLINE_X, SPARKLINE_Y, SPARKLINE_WIDTH, SPARKLINE_HEIGHT}
+  },
+  // 大时钟布局
+  {
+    "large-clock",
+    NO_TEXT,
+    NO_RECT,
+    NO_TEXT,
+    LAYOUT_TOP_LINE_Y,
+    CLOCK_FONT_LARGE,
+    clockRect(LARGE_CLOCK_FONT_METRICS, clockX(LARGE_CLOCK_FONT_METRICS, LAYOUT_SCREEN_WIDTH), LAYOUT_LARGE_CLOCK_BASELINE),
+    LAYOUT_LARGE_CLOCK_BASELINE,
+    -1,
+    textSlot(LAYOUT_MARGIN, LAYOUT_DATE_WIDTH, LAYOUT_TOP_BASELINE, ALIGN_LEFT),
+    NO_TEXT,
+    NO_TEXT,
+    -1,
+    batteryRect(LAYOUT_TOP_BASELINE),
+    NO_RECT
+  },
+  // 低电量布局
+  {
+    "low-battery",
+    NO_TEXT,
+    NO_RECT,
+    textSlot(LAYOUT_MARGIN, LAYOUT_SCREEN_WIDTH - 2 * LAYOUT_MARGIN, LAYOUT_TOP_BASELINE, ALIGN_LEFT),
+    LAYOUT_TOP_LINE_Y,
+    CLOCK_FONT_NORMAL,
+    clockRect(CLOCK_FONT_METRICS, clockX(CLOCK_FONT_METRICS, LAYOUT_SCREEN_WIDTH), LAYOUT_CLOCK_BASELINE),
+    LAYOUT_CLOCK_BASELINE,
+    LAYOUT_BOTTOM_LINE_Y,
+    textSlot(LAYOUT_MARGIN, LAYOUT_DATE_WIDTH, LAYOUT_DATE_BASELINE, ALIGN_LEFT),
+    NO_TEXT,
+    NO_TEXT,
+    -1,
+    batteryRect(LAYOUT_DATE_BASELINE),
+    NO_RECT
+  }
+};
+
+// 布局不能超出屏幕
+static_assert(DISPLAY_LAYOUTS[LAYOUT_STANDARD].time.right() <= LAYOUT_DIVIDER_X, "clock overlaps the climate column");
+static_assert(DISPLAY_LAYOUTS[LAYOUT_LARGE_CLOCK].time.right() <= LAYOUT_SCREEN_WIDTH, "large clock is wider than the screen");
+static_assert(DISPLAY_LAYOUTS[LAYOUT_LARGE_CLOCK].time.bottom() <= LAYOUT_SCREEN_HEIGHT, "large clock is taller than the screen");
+static_assert(LAYOUT_ROW_PITCH > SMALL_FONT_METRICS.ascent + SMALL_FONT_METRICS.descent, "small text rows overlap");
+static_assert(LAYOUT_TOP_BASELINE - SYMBOL_FONT_METRICS.ascent >= 0, "weather symbol is clipped at the top of the screen");
+static_assert(LAYOUT_TOP_BASELINE + SYMBOL_FONT_METRICS.descent < LAYOUT_TOP_LINE_Y, "weather symbol touches the top line");
+static_assert(DISPLAY_LAYOUTS[LAYOUT_STANDARD].weather.rect.right() < LAYOUT_SYMBOL_X, "weather text overlaps the weather symbol");
+static_assert(DISPLAY_LAYOUTS[LAYOUT_STANDARD].humidity.rect.bottom() <= LAYOUT_BOTTOM_LINE_Y, "humidity overlaps the bottom line");
+static_assert(DISPLAY_LAYOUTS[LAYOUT_STANDARD].date.rect.right() <= DISPLAY_LAYOUTS[LAYOUT_STANDARD].battery.x, "date overlaps the battery icon");
+static_assert(DISPLAY_LAYOUTS[LAYOUT_LARGE_CLOCK].date.rect.right() <= DISPLAY_LAYOUTS[LAYOUT_LARGE_CLOCK].battery.x, "date overlaps the battery icon");
+static_assert(!DISPLAY_LAYOUTS[LAYOUT_STANDARD].sparkline.intersects(DISPLAY_LAYOUTS[LAYOUT_STANDARD].date.rect), "sparkline overlaps the date");
+static_assert(!DISPLAY_LAYOUTS[LAYOUT_STANDARD].sparkline.intersects(DISPLAY_LAYOUTS[LAYOUT_STANDARD].humidity.rect), "sparkline overlaps the humidity");
+static_assert(!DISPLAY_LAYOUTS[LAYOUT_STANDARD].sparkline.intersects(DISPLAY_LAYOUTS[LAYOUT_STANDARD].battery), "sparkline overlaps the battery icon");
+static_assert(SPARKLINE_X > LAYOUT_DIVIDER_X && SPARKLINE_Y + SPARKLINE_HEIGHT < LAYOUT_BOTTOM_LINE_Y, "sparkline crosses the climate column lines");
+static_assert(SPARKLINE_HEIGHT >= 16, "sparkline is too short to show a trend");
+
+#endif // DISPLAY_LAYOUT_H
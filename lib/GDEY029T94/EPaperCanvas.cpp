@@ -0,0 +1,187 @@
+#include "EPaperCanvas.h"
+
+// 字形转置使用 64 位列掩码，高度加上字节内偏移不能超过 64
+#define GLYPH_MAX_HEIGHT 57
+#define GLYPH_MAX_WIDTH 64
+
+EPaperCanvas::EPaperCanvas(uint16_t w, uint16_t h)
+  : GFXcanvas1(w, h),
+    rowBytes((w + 7) / 8),
+    fastPath(true) {
+}
+
+void EPaperCanvas::setFastPath(bool enabled) {
+  fastPath = enabled;
+}
+
+bool EPaperCanvas::isFastPath() const {
+  return fastPath;
+}
+
+bool EPaperCanvas::useFastPath() const {
+  return fastPath && getRotation() == 1 && getBuffer() != nullptr;
+}
+
+void EPaperCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!useFastPath()) {
+    GFXcanvas1::fillRect(x, y, w, h, color);
+    return;
+  }
+
+  // 与 Adafruit_GFX::fillRect 一致，尺寸非正时不绘制
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  // 裁剪到逻辑屏幕
+  int16_t left = max((int16_t)0, x);
+  int16_t right = min((int16_t)(width() - 1), (int16_t)(x + w - 1));
+  int16_t top = max((int16_t)0, y);
+  int16_t bottom = min((int16_t)(height() - 1), (int16_t)(y + h - 1));
+  if (left > right || top > bottom) {
+    return;
+  }
+
+  // 旋转 1：逻辑 (x, y) 对应原生 (WIDTH - 1 - y, x)，逻辑列是一条原生行
+  int16_t first = WIDTH - 1 - bottom;
+  int16_t last = WIDTH - 1 - top;
+  for (int16_t row = left; row <= right; row++) {
+    fillNativeSpan(row, first, last, color);
+  }
+}
+
+void EPaperCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (!useFastPath()) {
+    GFXcanvas1::drawFastHLine(x, y, w, color);
+    return;
+  }
+  // 与 GFXcanvas1 一致，负长度表示向左画
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  fillRect(x, y, w, 1, color);
+}
+
+void EPaperCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (!useFastPath()) {
+    GFXcanvas1::drawFastVLine(x, y, h, color);
+    return;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  fillRect(x, y, 1, h, color);
+}
+
+void EPaperCanvas::fillNativeSpan(int16_t row, int16_t first, int16_t last, uint16_t color) {
+  uint8_t* bytes = getBuffer() + row * rowBytes;
+  int16_t firstByte = first >> 3;
+  int16_t lastByte = last >> 3;
+  uint8_t headMask = 0xFF >> (first & 7);
+  uint8_t tailMask = 0xFF << (7 - (last & 7));
+
+  if (firstByte == lastByte) {
+    uint8_t mask = headMask & tailMask;
+    bytes[firstByte] = color ? (bytes[firstByte] | mask) : (bytes[firstByte] & ~mask);
+    return;
+  }
+
+  bytes[firstByte] = color ? (bytes[firstByte] | headMask) : (bytes[firstByte] & ~headMask);
+  bytes[lastByte] = color ? (bytes[lastByte] | tailMask) : (bytes[lastByte] & ~tailMask);
+
+  // 中间整字节：对齐到 4 字节后按 32 位字写入（全 0 或全 1 与字节序无关）
+  uint8_t fill = color ? 0xFF : 0x00;
+  int16_t i = firstByte + 1;
+  while (i < lastByte && ((uintptr_t)(bytes + i) & 3)) {
+    bytes[i++] = fill;
+  }
+  uint32_t word = color ? 0xFFFFFFFFUL : 0;
+  while (i + 4 <= lastByte) {
+    *(uint32_t*)(bytes + i) = word;
+    i += 4;
+  }
+  while (i < lastByte) {
+    bytes[i++] = fill;
+  }
+}
+
+size_t EPaperCanvas::write(uint8_t c) {
+  // 只接管自定义字体、原始字号、普通字符的情况，其余与 Adafruit_GFX::write 相同
+  if (!useFastPath() || !gfxFont || textsize_x != 1 || textsize_y != 1 || c == '\n' || c == '\r') {
+    return GFXcanvas1::write(c);
+  }
+
+  uint8_t first = pgm_read_byte(&gfxFont->first);
+  if (c < first || c > (uint8_t)pgm_read_byte(&gfxFont->last)) {
+    return 1;
+  }
+
+  GFXglyph glyph;
+  memcpy_P(&glyph, &((GFXglyph*)pgm_read_pointer(&gfxFont->glyph))[c - first], sizeof(glyph));
+  if (glyph.width > 0 && glyph.height > 0) {
+    if (wrap && (cursor_x + glyph.xOffset + glyph.width) > _width) {
+      cursor_x = 0;
+      cursor_y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    }
+    const uint8_t* bitmap = (const uint8_t*)pgm_read_pointer(&gfxFont->bitmap);
+    if (!blitGlyph(cursor_x, cursor_y, glyph, bitmap, textcolor)) {
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, 1);
+    }
+  }
+  cursor_x += glyph.xAdvance;
+  return 1;
+}
+
+bool EPaperCanvas::blitGlyph(int16_t x, int16_t y, const GFXglyph& glyph, const uint8_t* bitmap, uint16_t color) {
+  int16_t w = glyph.width;
+  int16_t h = glyph.height;
+  int16_t left = x + glyph.xOffset;
+  int16_t top = y + glyph.yOffset;
+  if (w > GLYPH_MAX_WIDTH || h > GLYPH_MAX_HEIGHT ||
+      left < 0 || left + w > width() || top < 0 || top + h > height()) {
+    return false;
+  }
+
+  // 字形最底行对应的原生列，以及它在字节内的偏移
+  int16_t firstColumn = WIDTH - top - h;
+  uint8_t shift = firstColumn & 7;
+
+  // 逐行读取字形位图，把每个像素放进所在列的掩码：字形行 gy 对应原生列 firstColumn + (h - 1 - gy)
+  uint64_t columns[GLYPH_MAX_WIDTH];
+  memset(columns, 0, w * sizeof(columns[0]));
+  const uint8_t* src = bitmap + glyph.bitmapOffset;
+  uint8_t bits = 0;
+  uint8_t bit = 0;
+  for (int16_t gy = 0; gy < h; gy++) {
+    uint64_t mask = 1ULL << (63 - shift - (h - 1 - gy));
+    for (int16_t gx = 0; gx < w; gx++) {
+      if (!(bit++ & 7)) {
+        bits = pgm_read_byte(src++);
+      }
+      if (bits & 0x80) {
+        columns[gx] |= mask;
+      }
+      bits <<= 1;
+    }
+  }
+
+  // 每列写入一条原生行
+  uint8_t spanBytes = (shift + h + 7) / 8;
+  uint8_t* base = getBuffer() + left * rowBytes + (firstColumn >> 3);
+  for (int16_t gx = 0; gx < w; gx++) {
+    uint64_t column = columns[gx];
+    if (!column) {
+      continue;
+    }
+    uint8_t* bytes = base + gx * rowBytes;
+    for (uint8_t i = 0; i < spanBytes; i++) {
+      uint8_t mask = column >> (56 - 8 * i);
+      if (mask) {
+        bytes[i] = color ? (bytes[i] | mask) : (bytes[i] & ~mask);
+      }
+    }
+  }
+  return true;
+}
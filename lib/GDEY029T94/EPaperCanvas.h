@@ -0,0 +1,42 @@
+#ifndef EPAPER_CANVAS_H
+#define EPAPER_CANVAS_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+/**
+ * 墨水屏帧缓冲
+ * 在 GFXcanvas1 的基础上为横屏（旋转 1）提供直接操作帧缓冲的快速路径：
+ * - 矩形和线段按原生行整段填充，行内整 32 位字直接写入，首尾不足一字的部分用字节掩码
+ * - 自定义字体的字形按列转置为位掩码后整段写入原生行，不再逐像素调用 drawPixel
+ * 其他旋转方向、放大字号或超出范围的图形回退到 GFXcanvas1 的实现，绘制结果与 GFX 完全一致
+ */
+class EPaperCanvas : public GFXcanvas1 {
+public:
+  EPaperCanvas(uint16_t w, uint16_t h);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  // 开关快速路径（用于与 GFX 实现对比耗时和结果）
+  void setFastPath(bool enabled);
+  bool isFastPath() const;
+
+private:
+  // 旋转 1 且快速路径开启
+  bool useFastPath() const;
+
+  // 填充原生行 row 中 [first, last] 列的连续位
+  void fillNativeSpan(int16_t row, int16_t first, int16_t last, uint16_t color);
+
+  // 将自定义字体字形整列写入帧缓冲，字形超出屏幕或过大时返回 false
+  bool blitGlyph(int16_t x, int16_t y, const GFXglyph& glyph, const uint8_t* bitmap, uint16_t color);
+
+  uint16_t rowBytes;   // 原生每行字节数
+  bool fastPath;
+};
+
+#endif // EPAPER_CANVAS_H
@@ -0,0 +1,25 @@
+// 由 scripts/generate_digit_tiles.py 根据字体字形表生成，请勿手动修改
+#pragma once
+#include <Arduino.h>
+
+// 字体度量（来自字形表）
+struct FontMetrics {
+  int16_t advance;       // 字符（数字）前进宽度
+  int16_t ascent;        // 基线以上的像素行数
+  int16_t descent;       // 基线以下的像素行数
+  int16_t colonAdvance;  // 冒号前进宽度
+  int16_t inkLeft;       // 数字左侧留白
+  int16_t inkRight;      // 数字右侧留白
+};
+
+// FreeMonoBold9pt7b（等宽）
+constexpr FontMetrics SMALL_FONT_METRICS = {11, 12, 4, 11, 0, 0};
+
+// DSEG7Modern_Bold28pt7b 数字和冒号
+constexpr FontMetrics CLOCK_FONT_METRICS = {45, 54, 0, 11, 5, 6};
+
+// DSEG7Modern_Bold42pt7b 数字和冒号
+constexpr FontMetrics LARGE_CLOCK_FONT_METRICS = {67, 81, 0, 16, 8, 8};
+
+// Weather_Symbols_Regular9pt7b（advance 为最宽字形的宽度）
+constexpr FontMetrics SYMBOL_FONT_METRICS = {14, 11, 0, 0, 0, 0};
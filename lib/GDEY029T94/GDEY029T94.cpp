@@ -1,22 +1,99 @@
 #include "GDEY029T94.h"
 #include "../WeatherManager/WeatherManager.h"
+#include "../ClimateHistory/ClimateHistory.h"
 #include "../LogManager/LogManager.h"
+#include "DigitTiles.h"
+#include <coredecls.h>
 
 GDEY029T94::GDEY029T94(uint8_t cs, uint8_t dc, uint8_t rst, uint8_t busy)
   : display(GxEPD2_290_GDEY029T94(cs, dc, rst, busy)), 
+    canvas(GxEPD2_290_GDEY029T94::WIDTH, GxEPD2_290_GDEY029T94::HEIGHT),
     timeFont(nullptr), 
-    weatherSymbolFont(nullptr) {
+    largeTimeFont(nullptr),
+    weatherSymbolFont(nullptr),
+    layoutId(LAYOUT_STANDARD),
+    lowBatteryPercent(0),
+    lastRefreshMode(REFRESH_NONE),
+    panelSynced(false),
+    panelReady(false) {
 }
 
 void GDEY029T94::begin() {
-  display.init();
+  // 画面不变的唤醒无需访问屏幕，控制器的复位和初始化推迟到 initPanel()
+  panelSynced = scheduler.begin();
+  panelReady = false;
+}
+
+void GDEY029T94::initPanel() {
+  if (panelReady) {
+    return;
+  }
+  
+  // 深度睡眠期间屏幕保持供电，控制器显存中仍是上一帧；此时以 initial = false 初始化，
+  // 避免 GxEPD2 清空显存，才能在上一帧基础上局部刷新
+  display.init(0, !panelSynced);
+  panelReady = true;
 }
 
 void GDEY029T94::setRotation(int rotation) {
   display.setRotation(rotation);
+  canvas.setRotation(rotation);
+}
+
+bool GDEY029T94::showTimeDisplay(const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature, float humidity, float batteryPercentage, const ClimateSeries* series) {
+  // 渲染输入与屏幕上的画面一致时，绘制、SPI 传输和屏幕唤醒全部跳过
+  uint32_t fingerprint = contentFingerprint(selectLayout(batteryPercentage), currentTime, currentWeather, temperature, humidity, batteryPercentage, series);
+  if (scheduler.isUnchanged(fingerprint)) {
+    LOG_INFO("Display content unchanged, skipping render and refresh");
+    lastRefreshMode = REFRESH_NONE;
+    return false;
+  }
+  
+  const DisplayLayout& layout = renderTimeDisplay(currentTime, currentWeather, temperature, humidity, batteryPercentage, series);
+  
+  // 根据区域变化和残影积累选择刷新方式
+  RefreshPlan plan = scheduler.plan(layout, canvas, currentTime.hour, currentTime.minute, display.epd2.hasFastPartialUpdate);
+  static const char* const MODE_NAMES[] = {"none", "partial", "full"};
+  LOG_INFO_F("Refresh: %s (%s, regions 0x%02X)", MODE_NAMES[plan.mode], plan.reason, plan.changedRegions);
+  
+  switch (plan.mode) {
+    case REFRESH_NONE:
+      break;
+    case REFRESH_PARTIAL:
+      pushPartial(plan.window);
+      break;
+    case REFRESH_FULL:
+      pushFrame();
+      break;
+  }
+  scheduler.commit(plan, fingerprint);
+  lastRefreshMode = plan.mode;
+  
+  // 在循环外部输出完成信息
+  if (!isnan(temperature) && !isnan(humidity)) {
+    LOG_DEBUG("Temperature and humidity displayed");
+  } else {
+    LOG_WARN("Temperature or humidity is NaN, not displaying");
+  }
+  
+  if (!isnan(batteryPercentage)) {
+    LOG_DEBUG("Battery icon displayed");
+  } else {
+    LOG_WARN("Battery percentage is NaN, not displaying");
+  }
+  
+  return plan.mode != REFRESH_NONE;
 }
 
-void GDEY029T94::showTimeDisplay(const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature, float humidity, float batteryPercentage) {
+RefreshMode GDEY029T94::getLastRefreshMode() const {
+  return lastRefreshMode;
+}
+
+RefreshMode GDEY029T94::predictRefresh(uint8_t hour, uint8_t minute) const {
+  return scheduler.predict(hour, minute, display.epd2.hasFastPartialUpdate);
+}
+
+const DisplayLayout& GDEY029T94::renderTimeDisplay(const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature, float humidity, float batteryPercentage, const ClimateSeries* series) {
   String timeStr = TimeManager::getFormattedTime(currentTime);
   String dateStr = TimeManager::getFormattedDate(currentTime);
   String weatherStr = WeatherManager::getWeatherInfo(currentWeather);
@@ -41,146 +118,163 @@ void GDEY029T94::showTimeDisplay(const DateTime& currentTime, const WeatherInfo&
     LOG_DEBUG_F("Battery percentage: %.1f", batteryPercentage);
   }
   
-  display.setFullWindow();
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    
-    // 显示天气信息（使用小字体，左对齐）
-    display.setFont(&FreeMonoBold9pt7b);
-    int weatherX = alignToPixel8(10); // 左对齐，从左边缘8像素对齐
-    int weatherY = 15; // 顶部位置
-    
-    display.setCursor(weatherX, weatherY);
-    display.print(weatherStr);
-    
-    // 显示天气符号（右对齐）
-    if (weatherSymbolFont) {
-      display.setFont(weatherSymbolFont);
-    } else {
-      display.setFont(&FreeMonoBold9pt7b);
-    }
-    
-    char symbolStr[2] = {WeatherManager::getWeatherSymbol(currentWeather), '\0'};
-    int16_t sbx, sby;
-    uint16_t sbw, sbh;
-    display.getTextBounds(symbolStr, 0, 0, &sbx, &sby, &sbw, &sbh);
-    
-    int symbolX = alignToPixel8(display.width() - sbw - 10); // 右对齐，8像素对齐
-    int symbolY = weatherY; // 与天气信息相同的Y位置
-    
-    display.setCursor(symbolX, symbolY);
-    display.print(symbolStr);
-    
-    // 在天气信息下方画线
-    int topLineY = weatherY + 5;
-    display.drawLine(alignToPixel8(10), topLineY, display.width() - alignToPixel8(10), topLineY, GxEPD_BLACK);
+  const DisplayLayout& layout = selectLayout(batteryPercentage);
+  LOG_DEBUG_F("Using %s layout", layout.name);
+  
+  unsigned long renderStart = micros();
+  renderTimeFrame(layout, timeStr, dateStr, weatherStr, WeatherManager::getWeatherSymbol(currentWeather), temperature, humidity, batteryPercentage, series);
+  LOG_DEBUG_F("Frame rendered in %lu us", micros() - renderStart);
+  return layout;
+}
+
+void GDEY029T94::renderTimeFrame(const DisplayLayout& layout, const String& timeStr, const String& dateStr, const String& weatherStr, char weatherSymbol, float temperature, float humidity, float batteryPercentage, const ClimateSeries* series) {
+  canvas.fillScreen(GxEPD_WHITE);
+  canvas.setTextColor(GxEPD_BLACK);
+  
+  // 显示天气信息（左对齐）
+  drawText(layout.weather, weatherStr.c_str());
+  
+  // 显示状态提示
+  if (layout.status.rect.visible()) {
+    drawText(layout.status, "LOW BATTERY - CHARGE SOON");
+  }
+  
+  // 显示天气符号（在区域内右对齐，8像素对齐）
+  if (layout.symbol.visible()) {
+    const GFXfont* symbolFont = weatherSymbolFont ? weatherSymbolFont : &FreeMonoBold9pt7b;
+    canvas.setFont(symbolFont);
     
-    // 显示时间（使用大字体，居中显示）
-    if (timeFont) {
-      display.setFont(timeFont);
-    } else {
-      display.setFont(&FreeMonoBold9pt7b);
+    int symbolWidth = SMALL_FONT_METRICS.advance;
+    uint8_t first = pgm_read_byte(&symbolFont->first);
+    uint8_t last = pgm_read_byte(&symbolFont->last);
+    if ((uint8_t)weatherSymbol >= first && (uint8_t)weatherSymbol <= last) {
+      const GFXglyph* glyphs = (const GFXglyph*)pgm_read_pointer(&symbolFont->glyph);
+      symbolWidth = pgm_read_byte(&glyphs[(uint8_t)weatherSymbol - first].width);
     }
     
-    // 使用固定的时间字符串"00:00"来计算居中位置，确保位置不变
-    String fixedTimeStr = "00:00";
-    int16_t tbx, tby;
-    uint16_t tbw, tbh;
-    display.getTextBounds(fixedTimeStr, 0, 0, &tbx, &tby, &tbw, &tbh);
-    
-    int timeX = alignToPixel8((display.width() - tbw) / 2 - 30); // 居中对齐，8像素对齐
-    int timeY = topLineY + tbh + 10; // 在顶部线下方（减少间距）
-    
-    display.setCursor(timeX, timeY);
-    display.print(timeStr);
-    
-    // 在时间下方画线
-    int bottomLineY = timeY + 10;
-    display.drawLine(alignToPixel8(10), bottomLineY, display.width() - alignToPixel8(10), bottomLineY, GxEPD_BLACK);
-    
-    // 显示日期（使用小字体，左对齐）
-    display.setFont(&FreeMonoBold9pt7b);
-    int dateX = alignToPixel8(10); // 左对齐，从左边缘8像素对齐
-    int dateY = bottomLineY + 20; // 在线下方20像素处（减少间距）
-    
-    display.setCursor(dateX, dateY);
-    display.print(dateStr);
+    char symbolStr[2] = {weatherSymbol, '\0'};
+    canvas.setCursor(alignToPixel8(layout.symbol.right() - symbolWidth), layout.weather.baseline);
+    canvas.print(symbolStr);
+  }
+  
+  // 顶部分隔线
+  if (layout.topLineY >= 0) {
+    canvas.drawFastHLine(LAYOUT_MARGIN, layout.topLineY, canvas.width() - 2 * LAYOUT_MARGIN + 1, GxEPD_BLACK);
+  }
+  
+  // 显示时间（优先使用预栅格化的数字瓦片，字体或位置不匹配时回退到逐像素绘制）
+  const GFXfont* clockFont = (layout.clockFont == CLOCK_FONT_LARGE) ? largeTimeFont : timeFont;
+  if (!clockFont) {
+    clockFont = &FreeMonoBold9pt7b;
+  }
+  canvas.setFont(clockFont);
+  
+  unsigned long timeStart = micros();
+  bool tiled = (clockFont == timeFont) && drawTimeTiles(layout.time.x, layout.timeBaseline, timeStr);
+  if (!tiled) {
+    canvas.setCursor(layout.time.x, layout.timeBaseline);
+    canvas.print(timeStr);
+  }
+  LOG_DEBUG_F("Time drawn in %lu us (%s)", micros() - timeStart, tiled ? "tiles" : "gfx");
+  
+  // 底部分隔线
+  if (layout.bottomLineY >= 0) {
+    canvas.drawFastHLine(LAYOUT_MARGIN, layout.bottomLineY, canvas.width() - 2 * LAYOUT_MARGIN + 1, GxEPD_BLACK);
+  }
+  
+  // 显示日期（左对齐）
+  drawText(layout.date, dateStr.c_str());
+  
+  // 显示温湿度信息（右侧栏，右对齐）
+  if (!isnan(temperature) && !isnan(humidity) && layout.temperature.rect.visible()) {
+    char tempStr[16];
+    char humStr[16];
+    snprintf(tempStr, sizeof(tempStr), "%.0fC", temperature);
+    snprintf(humStr, sizeof(humStr), "%.0f%%", humidity);
     
-    // 显示温湿度信息（在日期下方，右对齐）
-    if (!isnan(temperature) && !isnan(humidity)) {
-      display.setFont(&FreeMonoBold9pt7b);
-      
-      // 准备温度和湿度字符串
-      char tempStr[16];
-      char humStr[16];
-      snprintf(tempStr, sizeof(tempStr), "%.0fC", temperature);
-      snprintf(humStr, sizeof(humStr), "%.0f%% ", humidity);
-      
-      // 计算温度字符串的宽度和位置（右对齐）
-      int16_t tbx, tby;
-      uint16_t tbw, tbh;
-      display.getTextBounds(tempStr, 0, 0, &tbx, &tby, &tbw, &tbh);
-      int tempX = alignToPixel8(display.width() - tbw - 10); // 右对齐，8像素对齐
-      int tempY = topLineY + 35; // 在线下方40像素处
-      
-      // 计算湿度字符串的宽度和位置（右对齐）
-      int16_t hbx, hby;
-      uint16_t hbw, hbh;
-      display.getTextBounds(humStr, 0, 0, &hbx, &hby, &hbw, &hbh);
-      int humX = alignToPixel8(display.width() - hbw - 10); // 右对齐，8像素对齐
-      int humY = tempY + 20; // 在温度下方20像素处
-      
-      // 显示温度
-      display.setCursor(tempX, tempY);
-      display.print(tempStr);
-      
-      // 在温度左侧画一条竖线，连接上下两条线
-      int verticalLineX = alignToPixel8(tempX - 10); // 在温度左侧10像素处
-      display.drawLine(verticalLineX, topLineY, verticalLineX, bottomLineY, GxEPD_BLACK);
-      
-      // 显示湿度
-      display.setCursor(humX, humY);
-      display.print(humStr);
-    }
+    drawText(layout.temperature, tempStr);
+    drawText(layout.humidity, humStr);
     
-    // 显示电池电量（在右下角，与日期同一行）
-    if (!isnan(batteryPercentage)) {
-      int totalBatteryWidth = 25;
-      int batteryX = alignToPixel8(display.width() - totalBatteryWidth);
-      int batteryY = dateY;
-      drawBatteryIcon(batteryX, batteryY, batteryPercentage);
+    // 温湿度栏左侧竖线，连接上下两条线
+    if (layout.dividerX >= 0) {
+      canvas.drawFastVLine(layout.dividerX, layout.topLineY, layout.bottomLineY - layout.topLineY + 1, GxEPD_BLACK);
     }
-    
-  } while (display.nextPage());
+  }
   
-  // 在循环外部输出完成信息
-  if (!isnan(temperature) && !isnan(humidity)) {
-    LOG_DEBUG_F("Temp position: X=%d, Y=55", alignToPixel8(display.width() - 10));
-    LOG_DEBUG_F("Hum position: X=%d, Y=75", alignToPixel8(display.width() - 10));
-    LOG_DEBUG("Temperature and humidity displayed");
-  } else {
-    LOG_WARN("Temperature or humidity is NaN, not displaying");
+  // 显示电池电量
+  if (!isnan(batteryPercentage) && layout.battery.visible()) {
+    drawBatteryIcon(layout.battery.x + 3, layout.battery.bottom() - 2, batteryPercentage);
   }
   
-  if (!isnan(batteryPercentage)) {
-    LOG_DEBUG("Battery icon displayed");
-  } else {
-    LOG_WARN("Battery percentage is NaN, not displaying");
+  // 显示温度趋势图
+  if (series && layout.sparkline.visible()) {
+    drawSparkline(layout.sparkline.x, layout.sparkline.y, layout.sparkline.w, layout.sparkline.h, *series);
+  }
+}
+
+void GDEY029T94::drawText(const TextSlot& slot, const char* text) {
+  if (!slot.rect.visible() || !text) {
+    return;
   }
   
-  display.hibernate();
+  // 小字体为等宽字体，按字符数计算宽度，无需 getTextBounds
+  int width = strlen(text) * SMALL_FONT_METRICS.advance;
+  int x = slot.rect.x;
+  if (slot.align == ALIGN_RIGHT) {
+    x = alignToPixel8(slot.rect.right() - width);
+  } else if (slot.align == ALIGN_CENTER) {
+    x = alignToPixel8(slot.rect.x + (slot.rect.w - width) / 2);
+  }
+  
+  canvas.setFont(&FreeMonoBold9pt7b);
+  canvas.setCursor(x, slot.baseline);
+  canvas.print(text);
 }
 
 void GDEY029T94::setTimeFont(const GFXfont* font) {
   timeFont = font;
 }
 
+void GDEY029T94::setLargeTimeFont(const GFXfont* font) {
+  largeTimeFont = font;
+}
+
 void GDEY029T94::setWeatherSymbolFont(const GFXfont* font) {
   weatherSymbolFont = font;
 }
 
+void GDEY029T94::setLayout(DisplayLayoutId id) {
+  layoutId = (id < LAYOUT_COUNT) ? id : LAYOUT_STANDARD;
+}
+
+void GDEY029T94::setLowBatteryLayout(float percent) {
+  lowBatteryPercent = percent;
+}
+
+DisplayLayoutId GDEY029T94::getLayout() const {
+  return layoutId;
+}
+
+void GDEY029T94::setRefreshPolicy(uint8_t ghostBudget, uint8_t nightStart, uint8_t nightEnd) {
+  scheduler.setGhostBudget(ghostBudget);
+  scheduler.setNightHours(nightStart, nightEnd);
+}
+
+const DisplayLayout& GDEY029T94::selectLayout(float batteryPercentage) const {
+  // 电量过低时切换到精简布局
+  if (!isnan(batteryPercentage) && batteryPercentage < lowBatteryPercent) {
+    return DISPLAY_LAYOUTS[LAYOUT_LOW_BATTERY];
+  }
+  
+  // 大时钟需要单独设置大号字体
+  if (layoutId == LAYOUT_LARGE_CLOCK && !largeTimeFont) {
+    LOG_WARN("Large clock font not set, using standard layout");
+    return DISPLAY_LAYOUTS[LAYOUT_STANDARD];
+  }
+  
+  return DISPLAY_LAYOUTS[layoutId];
+}
+
 int GDEY029T94::alignToPixel8(int x) {
   return (x / 8) * 8;
 }
@@ -198,13 +292,11 @@ void GDEY029T94::drawBatteryIcon(int x, int y, float percentage) {
   
   int capX = x - capWidth;
   int capY = y - batteryHeight/2 - capHeight/2 + 2;
-  display.fillRect(capX, capY, capWidth, capHeight, GxEPD_BLACK);
+  canvas.fillRect(capX, capY, capWidth, capHeight, GxEPD_BLACK);
   
-  display.drawRect(x, y - batteryHeight + 2, batteryWidth, batteryHeight, GxEPD_BLACK);
+  canvas.drawRect(x, y - batteryHeight + 2, batteryWidth, batteryHeight, GxEPD_BLACK);
   
-  int filledBars = (int)((percentage / 100.0) * 10 + 0.5);
-  if (filledBars > 10) filledBars = 10;
-  if (filledBars < 0) filledBars = 0;
+  int filledBars = batteryBars(percentage);
   
   int barY = y - batteryHeight + 2 + topBottomMargin + 1;
   int barHeight = batteryHeight - 2 * borderThickness - 2 * topBottomMargin;
@@ -215,57 +307,394 @@ void GDEY029T94::drawBatteryIcon(int x, int y, float percentage) {
     int barX = rightX - (i + 1) * barWidth;
     
     if (i < filledBars) {
-      display.fillRect(barX, barY, barWidth, barHeight, GxEPD_BLACK);
+      canvas.fillRect(barX, barY, barWidth, barHeight, GxEPD_BLACK);
     } else {
-      display.fillRect(barX, barY, barWidth, barHeight, GxEPD_WHITE);
+      canvas.fillRect(barX, barY, barWidth, barHeight, GxEPD_WHITE);
     }
   }
 }
 
+int GDEY029T94::batteryBars(float percentage) {
+  int filledBars = (int)((percentage / 100.0) * 10 + 0.5);
+  if (filledBars > 10) filledBars = 10;
+  if (filledBars < 0) filledBars = 0;
+  return filledBars;
+}
+
+// FNV-1a 累加
+static uint32_t fingerprintAdd(uint32_t hash, const void* data, size_t length) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+static uint32_t fingerprintAdd(uint32_t hash, const String& text) {
+  // 包含结尾的 0，避免相邻字符串拼接后相同
+  return fingerprintAdd(hash, text.c_str(), text.length() + 1);
+}
+
+uint32_t GDEY029T94::contentFingerprint(const DisplayLayout& layout, const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature, float humidity, float batteryPercentage, const ClimateSeries* series) const {
+  uint32_t hash = 2166136261UL;
+  
+  // 布局和字体决定所有元素的位置和字形
+  uint8_t layoutIndex = &layout - DISPLAY_LAYOUTS;
+  const void* fonts[] = {timeFont, largeTimeFont, weatherSymbolFont};
+  hash = fingerprintAdd(hash, &layoutIndex, sizeof(layoutIndex));
+  hash = fingerprintAdd(hash, fonts, sizeof(fonts));
+  
+  // 与 renderTimeFrame() 相同的格式化结果，数值变化但显示相同时指纹不变
+  hash = fingerprintAdd(hash, TimeManager::getFormattedTime(currentTime));
+  hash = fingerprintAdd(hash, TimeManager::getFormattedDate(currentTime));
+  if (layout.weather.rect.visible()) {
+    hash = fingerprintAdd(hash, WeatherManager::getWeatherInfo(currentWeather));
+  }
+  if (layout.symbol.visible()) {
+    char symbol = WeatherManager::getWeatherSymbol(currentWeather);
+    hash = fingerprintAdd(hash, &symbol, sizeof(symbol));
+  }
+  
+  if (layout.temperature.rect.visible()) {
+    char climateStr[32] = "";
+    if (!isnan(temperature) && !isnan(humidity)) {
+      snprintf(climateStr, sizeof(climateStr), "%.0fC %.0f%%", temperature, humidity);
+    }
+    hash = fingerprintAdd(hash, climateStr, strlen(climateStr) + 1);
+  }
+  
+  if (layout.battery.visible()) {
+    int8_t bars = isnan(batteryPercentage) ? -1 : batteryBars(batteryPercentage);
+    hash = fingerprintAdd(hash, &bars, sizeof(bars));
+  }
+  
+  if (layout.sparkline.visible()) {
+    uint8_t columns = series ? series->columns : 0;
+    hash = fingerprintAdd(hash, &columns, sizeof(columns));
+    if (series) {
+      hash = fingerprintAdd(hash, series->minValue, columns * sizeof(series->minValue[0]));
+      hash = fingerprintAdd(hash, series->maxValue, columns * sizeof(series->maxValue[0]));
+    }
+  }
+  
+  return hash;
+}
+
 void GDEY029T94::showConfigDisplay(const char* apName, const char* apIP) {
   LOG_INFO("Displaying configuration mode screen...");
   
-  display.setFullWindow();
-  display.firstPage();
-  do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setTextColor(GxEPD_BLACK);
-    display.setFont(&FreeMonoBold9pt7b);
-    
-    int y = 20;
-    int lineHeight = 20;
-    
-    // 显示标题
-    display.setCursor(alignToPixel8(10), y);
-    display.print("Config Mode");
-    y += lineHeight;
-    
-    // 画分隔线
-    display.drawLine(alignToPixel8(10), y, display.width() - alignToPixel8(10), y, GxEPD_BLACK);
-    y += lineHeight;
-    
-    // 显示WiFi信息（WIFI: 和名称在同一行）
-    display.setCursor(alignToPixel8(10), y);
-    display.print("WIFI: ");
-    display.print(apName);
-    y += lineHeight;
+  renderConfigDisplay(apName, apIP);
+  pushFrame();
+  
+  // 配置界面不经过刷新调度，下次显示时间时必须全刷
+  scheduler.invalidate();
+  LOG_INFO("Configuration mode screen displayed");
+}
+
+void GDEY029T94::renderConfigDisplay(const char* apName, const char* apIP) {
+  canvas.fillScreen(GxEPD_WHITE);
+  canvas.setTextColor(GxEPD_BLACK);
+  canvas.setFont(&FreeMonoBold9pt7b);
+  
+  int y = 20;
+  int lineHeight = 20;
+  
+  // 显示标题
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("Config Mode");
+  y += lineHeight;
+  
+  // 画分隔线
+  canvas.drawFastHLine(alignToPixel8(10), y, canvas.width() - 2 * alignToPixel8(10) + 1, GxEPD_BLACK);
+  y += lineHeight;
+  
+  // 显示WiFi信息（WIFI: 和名称在同一行）
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("WIFI: ");
+  canvas.print(apName);
+  y += lineHeight;
+  
+  // 显示IP信息（IP: 和地址在同一行）
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("IP: ");
+  canvas.print(apIP);
+  y += lineHeight;
+  
+  // 画分隔线
+  canvas.drawFastHLine(alignToPixel8(10), y, canvas.width() - 2 * alignToPixel8(10) + 1, GxEPD_BLACK);
+  y += lineHeight;
+  
+  // 显示连接提示（不换行）
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("Connect wifi and browse IP");
+}
+
+void GDEY029T94::showConfigTimeoutDisplay(uint16_t idleMinutes) {
+  LOG_INFO("Displaying configuration timeout screen...");
+  
+  renderConfigTimeoutDisplay(idleMinutes);
+  pushFrame();
+  
+  // 超时画面不经过刷新调度，下次显示时间时必须全刷
+  scheduler.invalidate();
+  LOG_INFO("Configuration timeout screen displayed");
+}
+
+void GDEY029T94::renderConfigTimeoutDisplay(uint16_t idleMinutes) {
+  canvas.fillScreen(GxEPD_WHITE);
+  canvas.setTextColor(GxEPD_BLACK);
+  canvas.setFont(&FreeMonoBold9pt7b);
+  
+  int y = 20;
+  int lineHeight = 20;
+  
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("Config timed out");
+  y += lineHeight;
+  
+  canvas.drawFastHLine(alignToPixel8(10), y, canvas.width() - 2 * alignToPixel8(10) + 1, GxEPD_BLACK);
+  y += lineHeight;
+  
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("No activity for ");
+  canvas.print(idleMinutes);
+  canvas.print(" min");
+  y += lineHeight;
+  
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("WiFi AP is off");
+  y += lineHeight;
+  
+  canvas.drawFastHLine(alignToPixel8(10), y, canvas.width() - 2 * alignToPixel8(10) + 1, GxEPD_BLACK);
+  y += lineHeight;
+  
+  // RXD 仍被拉低时需要先释放一次才能重新进入配置模式
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("Release RXD to reconfigure");
+}
+
+void GDEY029T94::showSleepDisplay(uint8_t wakeHour, uint8_t wakeMinute) {
+  char until[6];
+  snprintf(until, sizeof(until), "%02u:%02u", wakeHour, wakeMinute);
+  
+  // 休眠画面整晚不变，后备定时器提前唤醒时画面已在屏幕上，不再刷新
+  uint32_t fingerprint = fingerprintAdd(2166136261UL, "sleep", 6);
+  fingerprint = fingerprintAdd(fingerprint, until, sizeof(until));
+  if (scheduler.isShowing(fingerprint)) {
+    LOG_INFO("Sleep screen already displayed, skipping refresh");
+    return;
+  }
+  
+  renderSleepDisplay(wakeHour, wakeMinute);
+  pushFrame();
+  
+  // 休眠画面不经过刷新调度，恢复显示时间时全刷
+  scheduler.invalidate(fingerprint);
+  LOG_INFO_F("Sleep screen displayed (until %s)", until);
+}
+
+void GDEY029T94::renderSleepDisplay(uint8_t wakeHour, uint8_t wakeMinute) {
+  char until[6];
+  snprintf(until, sizeof(until), "%02u:%02u", wakeHour, wakeMinute);
+  
+  canvas.fillScreen(GxEPD_WHITE);
+  canvas.setTextColor(GxEPD_BLACK);
+  canvas.setFont(&FreeMonoBold9pt7b);
+  
+  int y = 20;
+  canvas.setCursor(alignToPixel8(10), y);
+  canvas.print("Sleeping until");
+  y += 10;
+  canvas.drawFastHLine(alignToPixel8(10), y, canvas.width() - 2 * alignToPixel8(10) + 1, GxEPD_BLACK);
+  
+  // 恢复时间用时钟字体居中显示在分隔线下方（字体子集包含数字和冒号）
+  canvas.setFont(timeFont ? timeFont : &FreeMonoBold9pt7b);
+  int16_t x1, y1;
+  uint16_t w, h;
+  canvas.getTextBounds(until, 0, 0, &x1, &y1, &w, &h);
+  int16_t top = y + (canvas.height() - y - h) / 2;
+  canvas.setCursor((canvas.width() - w) / 2 - x1, top - y1);
+  canvas.print(until);
+}
+
+void GDEY029T94::exportFrame(Print& out) {
+  static const char HEX_DIGITS[] = "0123456789ABCDEF";
+  int16_t width = canvas.width();
+  int16_t height = canvas.height();
+  
+  // PBM 头，后续每行 (width + 7) / 8 字节，行尾不足 8 位补 0
+  out.print(F("P4 "));
+  out.print(width);
+  out.print(' ');
+  out.println(height);
+  
+  char line[(LAYOUT_SCREEN_WIDTH + 7) / 8 * 2 + 1];
+  for (int16_t y = 0; y < height; y++) {
+    int pos = 0;
+    for (int16_t x = 0; x < width && pos + 2 < (int)sizeof(line); x += 8) {
+      uint8_t bits = 0;
+      for (int16_t bit = 0; bit < 8 && x + bit < width; bit++) {
+        // canvas 中 1 = 白色，PBM 中 1 = 黑色
+        if (!canvas.getPixel(x + bit, y)) {
+          bits |= 0x80 >> bit;
+        }
+      }
+      line[pos++] = HEX_DIGITS[bits >> 4];
+      line[pos++] = HEX_DIGITS[bits & 0x0F];
+    }
+    line[pos] = '\0';
+    out.println(line);
+    yield();
+  }
+}
+
+void GDEY029T94::drawSparkline(int x, int y, int w, int h, const ClimateSeries& series) {
+  // 自动量程：取所有有效列的最小/最大值
+  int16_t low = INT16_MAX;
+  int16_t high = INT16_MIN;
+  for (uint8_t i = 0; i < series.columns; i++) {
+    if (series.minValue[i] == CLIMATE_INVALID_VALUE) {
+      continue;
+    }
+    if (series.minValue[i] < low) low = series.minValue[i];
+    if (series.maxValue[i] > high) high = series.maxValue[i];
+  }
+  
+  if (low > high) {
+    LOG_DEBUG("Sparkline has no data");
+    return;
+  }
+  
+  int32_t range = (int32_t)high - low;
+  int32_t bottom = low;
+  if (range < SPARKLINE_MIN_RANGE) {
+    bottom = (int32_t)low - (SPARKLINE_MIN_RANGE - range) / 2;
+    range = SPARKLINE_MIN_RANGE;
+  }
+  
+  // 列数少于区域宽度时右对齐，最新数据始终在最右侧
+  int columns = series.columns < w ? series.columns : w;
+  int left = x + w - columns;
+  int prevTop = -1;
+  int prevBottom = -1;
+  
+  for (int i = 0; i < columns; i++) {
+    if (series.minValue[i] == CLIMATE_INVALID_VALUE) {
+      prevTop = -1;
+      continue;
+    }
     
-    // 显示IP信息（IP: 和地址在同一行）
-    display.setCursor(alignToPixel8(10), y);
-    display.print("IP: ");
-    display.print(apIP);
-    y += lineHeight;
+    int top = y + h - 1 - (int)(((int32_t)series.maxValue[i] - bottom) * (h - 1) / range);
+    int bot = y + h - 1 - (int)(((int32_t)series.minValue[i] - bottom) * (h - 1) / range);
     
-    // 画分隔线
-    display.drawLine(alignToPixel8(10), y, display.width() - alignToPixel8(10), y, GxEPD_BLACK);
-    y += lineHeight;
+    // 与前一列的线段首尾相接，避免阶跃处出现断点
+    if (prevTop >= 0) {
+      if (top > prevBottom) top = prevBottom;
+      if (bot < prevTop) bot = prevTop;
+    }
     
-    // 显示连接提示（不换行）
-    display.setCursor(alignToPixel8(10), y);
-    display.print("Connect wifi and browse IP");
+    // 横屏下竖直线段对应帧缓冲中的一段连续行，由 EPaperCanvas 按字节掩码整段填充
+    canvas.drawFastVLine(left + i, top, bot - top + 1, GxEPD_BLACK);
     
-  } while (display.nextPage());
+    prevTop = top;
+    prevBottom = bot;
+  }
+}
+
+bool GDEY029T94::drawTimeTiles(int x, int y, const String& timeStr) {
+  // 瓦片按旋转 1 的原生方向和固定基线生成
+  if (!timeFont || canvas.getRotation() != 1 || y != DIGIT_TILE_BASELINE) {
+    return false;
+  }
+  
+  // 确认当前时间字体就是生成瓦片的字体
+  GFXglyph zero;
+  const GFXglyph* glyphs = (const GFXglyph*)pgm_read_pointer(&timeFont->glyph);
+  memcpy_P(&zero, &glyphs['0' - pgm_read_byte(&timeFont->first)], sizeof(zero));
+  if (pgm_read_byte(&timeFont->yAdvance) != DIGIT_TILE_FONT_Y_ADVANCE ||
+      zero.bitmapOffset != DIGIT_TILE_FONT_ZERO_OFFSET ||
+      zero.width != DIGIT_TILE_FONT_ZERO_WIDTH ||
+      zero.height != DIGIT_TILE_FONT_ZERO_HEIGHT) {
+    return false;
+  }
+  
+  // 先查找所有字符，任意字符缺少瓦片或超出屏幕时整体回退
+  const DigitTile* tiles[8];
+  size_t count = timeStr.length();
+  if (count > sizeof(tiles) / sizeof(tiles[0])) {
+    return false;
+  }
+  
+  int width = 0;
+  for (size_t i = 0; i < count; i++) {
+    tiles[i] = nullptr;
+    for (size_t t = 0; t < DIGIT_TILE_COUNT; t++) {
+      if (DIGIT_TILES[t].ch == timeStr[i]) {
+        tiles[i] = &DIGIT_TILES[t];
+        break;
+      }
+    }
+    if (!tiles[i]) {
+      return false;
+    }
+    width += tiles[i]->rows;
+  }
+  
+  if (x < 0 || x + width > canvas.width()) {
+    return false;
+  }
+  
+  // 逻辑 x 对应原生行，每个瓦片逐行拷贝整字节
+  const int stride = (GxEPD2_290_GDEY029T94::WIDTH + 7) / 8;
+  uint8_t* dest = canvas.getBuffer() + x * stride + DIGIT_TILE_NATIVE_X / 8;
+  for (size_t i = 0; i < count; i++) {
+    const DigitTile* tile = tiles[i];
+    for (uint8_t row = 0; row < tile->rows; row++) {
+      if (tile->data) {
+        memcpy_P(dest, tile->data + row * DIGIT_TILE_ROW_BYTES, DIGIT_TILE_ROW_BYTES);
+      } else {
+        memset(dest, 0xFF, DIGIT_TILE_ROW_BYTES);
+      }
+      dest += stride;
+    }
+  }
+  
+  return true;
+}
+
+uint32_t GDEY029T94::getFrameChecksum() const {
+  return crc32(canvas.getBuffer(), (GxEPD2_290_GDEY029T94::WIDTH + 7) / 8 * GxEPD2_290_GDEY029T94::HEIGHT);
+}
+
+void GDEY029T94::setFastRaster(bool enabled) {
+  canvas.setFastPath(enabled);
+}
+
+void GDEY029T94::pushFrame() {
+  initPanel();
+  const uint8_t* buffer = canvas.getBuffer();
+  display.epd2.writeImageForFullRefresh(buffer, 0, 0, GxEPD2_290_GDEY029T94::WIDTH, GxEPD2_290_GDEY029T94::HEIGHT);
+  display.epd2.refresh(false);
+  
+  // 同步控制器中的“上一帧”缓冲，供后续局部刷新比较
+  if (display.epd2.hasFastPartialUpdate) {
+    display.epd2.writeImageAgain(buffer, 0, 0, GxEPD2_290_GDEY029T94::WIDTH, GxEPD2_290_GDEY029T94::HEIGHT);
+  }
+  
+  display.hibernate();
+}
+
+void GDEY029T94::pushPartial(const LayoutRect& window) {
+  initPanel();
+  const uint8_t* buffer = canvas.getBuffer();
+  display.epd2.writeImage(buffer, 0, 0, GxEPD2_290_GDEY029T94::WIDTH, GxEPD2_290_GDEY029T94::HEIGHT);
+  
+  // 旋转 1：逻辑 (x, y) 对应原生 (WIDTH - 1 - y, x)，GxEPD2 会将 x 方向扩展到 8 像素对齐
+  int16_t nativeX = GxEPD2_290_GDEY029T94::WIDTH - window.bottom();
+  display.epd2.refresh(nativeX, window.x, window.h, window.w);
+  
+  // 同步“上一帧”缓冲，未刷新的区域内容本就相同
+  display.epd2.writeImageAgain(buffer, 0, 0, GxEPD2_290_GDEY029T94::WIDTH, GxEPD2_290_GDEY029T94::HEIGHT);
   
   display.hibernate();
-  LOG_INFO("Configuration mode screen displayed");
 }
@@ -4,44 +4,144 @@
 #include <Arduino.h>
 #include <GxEPD2_BW.h>
 #include <GxEPD2_3C.h>
+#include <Adafruit_GFX.h>
 #include <Fonts/FreeMonoBold9pt7b.h>
 #include "../TimeManager/TimeManager.h"
+#include "DisplayLayout.h"
+#include "RefreshScheduler.h"
+#include "EPaperCanvas.h"
+
+// 趋势图最小纵向量程（0.01 单位），避免小幅波动被放大成满幅
+#define SPARKLINE_MIN_RANGE 200
 
 // 前向声明 WeatherInfo 结构体（在 WeatherManager.h 中定义）
 struct WeatherInfo;
 
+// 前向声明 ClimateSeries 结构体（在 ClimateHistory.h 中定义）
+struct ClimateSeries;
+
 class GDEY029T94 {
 public:
   // 构造函数
   GDEY029T94(uint8_t cs, uint8_t dc, uint8_t rst, uint8_t busy);
   
-  // 初始化显示
+  // 初始化显示：只恢复刷新调度状态，屏幕控制器在第一次真正刷新时才唤醒
   void begin();
   
   // 设置旋转方向
   void setRotation(int rotation);
   
-  // 显示时间和天气信息
-  void showTimeDisplay(const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature = NAN, float humidity = NAN, float batteryPercentage = NAN);
+  // 显示时间和天气信息，series 不为空时在温湿度栏绘制温度趋势图
+  // 渲染输入与屏幕上的画面一致时跳过绘制和刷新，否则由刷新调度器决定不刷新、局部刷新或全刷
+  // 返回是否实际刷新了屏幕
+  bool showTimeDisplay(const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature = NAN, float humidity = NAN, float batteryPercentage = NAN, const ClimateSeries* series = nullptr);
+  
+  // 上一次 showTimeDisplay() 使用的刷新方式（跳过时为 REFRESH_NONE）
+  RefreshMode getLastRefreshMode() const;
+  
+  // 预测在 hour:minute 显示时间时的刷新方式（局部刷新或全刷）
+  RefreshMode predictRefresh(uint8_t hour, uint8_t minute) const;
+  
+  // 只绘制时间界面到帧缓冲，不刷新屏幕（用于帧导出和渲染基准），返回使用的布局
+  const DisplayLayout& renderTimeDisplay(const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature = NAN, float humidity = NAN, float batteryPercentage = NAN, const ClimateSeries* series = nullptr);
   
   // 显示配置模式信息
   void showConfigDisplay(const char* apName, const char* apIP);
   
+  // 只绘制配置界面到帧缓冲，不刷新屏幕
+  void renderConfigDisplay(const char* apName, const char* apIP);
+  
+  // 显示配置模式空闲超时画面（超时分钟数），之后第一次显示时间时全刷
+  void showConfigTimeoutDisplay(uint16_t idleMinutes);
+  
+  // 只绘制配置超时画面到帧缓冲，不刷新屏幕
+  void renderConfigTimeoutDisplay(uint16_t idleMinutes);
+  
+  // 显示夜间静默时段的休眠画面（恢复刷新的时间），画面已在屏幕上时不刷新
+  void showSleepDisplay(uint8_t wakeHour, uint8_t wakeMinute);
+  
+  // 只绘制休眠画面到帧缓冲，不刷新屏幕
+  void renderSleepDisplay(uint8_t wakeHour, uint8_t wakeMinute);
+  
+  // 以 PBM（P4）十六进制行输出帧缓冲：逻辑方向，每行一个十六进制串，1 = 黑色
+  void exportFrame(Print& out);
+  
+  // 帧缓冲的 CRC32（用于比较不同绘制路径的结果）
+  uint32_t getFrameChecksum() const;
+  
+  // 开关帧缓冲快速绘制路径（关闭时使用 Adafruit GFX 逐像素实现）
+  void setFastRaster(bool enabled);
+  
   // 设置时间字体
   void setTimeFont(const GFXfont* font);
   
+  // 设置大时钟布局使用的时间字体
+  void setLargeTimeFont(const GFXfont* font);
+  
   // 设置天气符号字体
   void setWeatherSymbolFont(const GFXfont* font);
   
+  // 设置界面布局
+  void setLayout(DisplayLayoutId id);
+  
+  // 设置切换到低电量布局的电量阈值（%），0 表示不切换
+  void setLowBatteryLayout(float percent);
+  
+  // 获取当前设置的界面布局
+  DisplayLayoutId getLayout() const;
+  
+  // 设置刷新策略：残影预算（条带数）和夜间时段 [nightStart, nightEnd)
+  void setRefreshPolicy(uint8_t ghostBudget, uint8_t nightStart, uint8_t nightEnd);
+  
   // 8像素对齐辅助函数
   int alignToPixel8(int x);
   
 private:
   // 绘制电池符号
   void drawBatteryIcon(int x, int y, float percentage);
-  GxEPD2_BW<GxEPD2_290_GDEY029T94, GxEPD2_290_GDEY029T94::HEIGHT> display;
+  
+  // 电池图标中点亮的格数（0-10）
+  static int batteryBars(float percentage);
+  
+  // 计算渲染输入的指纹：只包含会影响画面的内容（格式化后的文字、电量格数、趋势图数据、布局和字体）
+  uint32_t contentFingerprint(const DisplayLayout& layout, const DateTime& currentTime, const WeatherInfo& currentWeather, float temperature, float humidity, float batteryPercentage, const ClimateSeries* series) const;
+  
+  // 按需初始化屏幕控制器
+  void initPanel();
+  
+  // 根据设置和电量选择当前布局
+  const DisplayLayout& selectLayout(float batteryPercentage) const;
+  
+  // 在文字区域内按对齐方式绘制小字体文字
+  void drawText(const TextSlot& slot, const char* text);
+  
+  // 将时间界面绘制到帧缓冲
+  void renderTimeFrame(const DisplayLayout& layout, const String& timeStr, const String& dateStr, const String& weatherStr, char weatherSymbol, float temperature, float humidity, float batteryPercentage, const ClimateSeries* series);
+  
+  // 绘制趋势图（每列一条竖直线段，覆盖该列的最小到最大值）
+  void drawSparkline(int x, int y, int w, int h, const ClimateSeries& series);
+  
+  // 使用预栅格化的数字瓦片绘制时间，字体或位置与瓦片不匹配时返回 false
+  bool drawTimeTiles(int x, int y, const String& timeStr);
+  
+  // 将帧缓冲整屏写入控制器并全刷
+  void pushFrame();
+  
+  // 将帧缓冲写入控制器，只局部刷新窗口（逻辑坐标）内的区域
+  void pushPartial(const LayoutRect& window);
+  
+  // 整帧在 canvas 中绘制，GxEPD2 只负责控制器通信，因此分页缓冲保持最小
+  GxEPD2_BW<GxEPD2_290_GDEY029T94, 8> display;
+  EPaperCanvas canvas;
   const GFXfont* timeFont;
+  const GFXfont* largeTimeFont;
   const GFXfont* weatherSymbolFont;
+  DisplayLayoutId layoutId;
+  float lowBatteryPercent;
+  RefreshScheduler scheduler;
+  RefreshMode lastRefreshMode;
+  bool panelSynced;   // 控制器显存中是否保留着上一帧
+  bool panelReady;    // 本次唤醒是否已初始化控制器
   
 };
 
@@ -0,0 +1,252 @@
+#include "RefreshScheduler.h"
+#include "../LogManager/LogManager.h"
+
+// 原生方向（竖屏）每行字节数，旋转 1 时逻辑 y 对应原生 x
+#define REFRESH_NATIVE_ROW_BYTES (LAYOUT_SCREEN_HEIGHT / 8)
+
+RefreshScheduler::RefreshScheduler()
+  : _newLayoutIndex(0),
+    _ghostBudget(REFRESH_DEFAULT_GHOST_BUDGET),
+    _nightStart(REFRESH_DEFAULT_NIGHT_START),
+    _nightEnd(REFRESH_DEFAULT_NIGHT_END) {
+  memset(&_state, 0, sizeof(_state));
+  memset(_newHash, 0, sizeof(_newHash));
+}
+
+bool RefreshScheduler::begin() {
+  // 冷启动或 RTC 数据损坏时控制器内容未知，下次必须全刷
+  if (!RTCMemory::read(RTC_BLOCK_DISPLAY_REFRESH, _state) || _state.layoutIndex >= LAYOUT_COUNT) {
+    memset(&_state, 0, sizeof(_state));
+    LOG_INFO("RefreshScheduler: no refresh state in RTC memory");
+    return false;
+  }
+
+  LOG_DEBUG_F("RefreshScheduler: restored (synced %d, full refreshes %u)", _state.synced, _state.fullCount);
+  return _state.synced != 0;
+}
+
+void RefreshScheduler::setGhostBudget(uint8_t budget) {
+  _ghostBudget = budget;
+}
+
+void RefreshScheduler::setNightHours(uint8_t start, uint8_t end) {
+  _nightStart = start;
+  _nightEnd = end;
+}
+
+bool RefreshScheduler::isUnchanged(uint32_t fingerprint) const {
+  return _state.synced && _state.contentHash == fingerprint;
+}
+
+RefreshPlan RefreshScheduler::plan(const DisplayLayout& layout, const GFXcanvas1& canvas, uint8_t hour, uint8_t minute, bool partialSupported) {
+  RefreshPlan result;
+  memset(&result, 0, sizeof(result));
+  result.mode = REFRESH_FULL;
+
+  _newLayoutIndex = &layout - DISPLAY_LAYOUTS;
+
+  // 计算当前帧的指纹并与上一帧比较
+  uint8_t maxGhost = 0;
+  for (uint8_t region = 0; region < REFRESH_REGION_COUNT; region++) {
+    LayoutRect rect = regionRect(layout, region);
+    if (!rect.visible()) {
+      memset(_newHash[region], 0, sizeof(_newHash[region]));
+      continue;
+    }
+
+    hashRegion(canvas, rect, _newHash[region]);
+    for (uint8_t stripe = 0; stripe < REFRESH_REGION_STRIPES; stripe++) {
+      if (_newHash[region][stripe] != _state.stripeHash[region][stripe]) {
+        result.changedStripes[region]++;
+      }
+    }
+
+    if (result.changedStripes[region] > 0) {
+      result.window = (result.changedRegions == 0) ? rect : unionRect(result.window, rect);
+      result.changedRegions |= 1 << region;
+    }
+    maxGhost = max(maxGhost, _state.ghost[region]);
+  }
+
+  if (!partialSupported || canvas.getRotation() != 1) {
+    result.reason = "partial refresh unsupported";
+    return result;
+  }
+  if (!_state.synced) {
+    result.reason = "panel not synced";
+    return result;
+  }
+  if (_newLayoutIndex != _state.layoutIndex) {
+    result.reason = "layout changed";
+    return result;
+  }
+  if (result.changedRegions == 0) {
+    result.mode = REFRESH_NONE;
+    result.reason = "unchanged";
+    return result;
+  }
+
+  const char* reason = fullRefreshReason(result.changedStripes, maxGhost, hour, minute);
+  if (reason) {
+    result.reason = reason;
+    return result;
+  }
+
+  result.mode = REFRESH_PARTIAL;
+  result.reason = "changed regions";
+  return result;
+}
+
+RefreshMode RefreshScheduler::predict(uint8_t hour, uint8_t minute, bool partialSupported) const {
+  if (!partialSupported || !_state.synced) {
+    return REFRESH_FULL;
+  }
+
+  uint8_t changedStripes[REFRESH_REGION_COUNT] = {0};
+  changedStripes[REGION_TIME] = 1;
+  uint8_t maxGhost = 0;
+  for (uint8_t region = 0; region < REFRESH_REGION_COUNT; region++) {
+    maxGhost = max(maxGhost, _state.ghost[region]);
+  }
+  return fullRefreshReason(changedStripes, maxGhost, hour, minute) ? REFRESH_FULL : REFRESH_PARTIAL;
+}
+
+const char* RefreshScheduler::fullRefreshReason(const uint8_t* changedStripes, uint8_t maxGhost, uint8_t hour, uint8_t minute) const {
+  // 任一变化区域累计改写量超出预算
+  for (uint8_t region = 0; region < REFRESH_REGION_COUNT; region++) {
+    if (changedStripes[region] > 0 && _state.ghost[region] + changedStripes[region] > _ghostBudget) {
+      return "ghost budget";
+    }
+  }
+
+  // 夜间或整点屏幕闪烁不易察觉，残影已积累到一定程度时提前全刷
+  if (isNight(hour) && maxGhost >= _ghostBudget / 4) {
+    return "night";
+  }
+  if (minute == 0 && maxGhost >= _ghostBudget / 2) {
+    return "hour boundary";
+  }
+  return nullptr;
+}
+
+void RefreshScheduler::commit(const RefreshPlan& plan, uint32_t fingerprint) {
+  // 像素未变化时只在指纹不同时更新（例如趋势图数据变化但画面相同）
+  if (plan.mode == REFRESH_NONE) {
+    if (_state.contentHash != fingerprint) {
+      _state.contentHash = fingerprint;
+      RTCMemory::write(RTC_BLOCK_DISPLAY_REFRESH, _state);
+    }
+    return;
+  }
+
+  if (plan.mode == REFRESH_FULL) {
+    memset(_state.partialCount, 0, sizeof(_state.partialCount));
+    memset(_state.ghost, 0, sizeof(_state.ghost));
+    _state.fullCount++;
+  } else {
+    for (uint8_t region = 0; region < REFRESH_REGION_COUNT; region++) {
+      if (plan.changedStripes[region] == 0) {
+        continue;
+      }
+      if (_state.partialCount[region] < UINT8_MAX) {
+        _state.partialCount[region]++;
+      }
+      _state.ghost[region] = min(UINT8_MAX, _state.ghost[region] + plan.changedStripes[region]);
+    }
+  }
+
+  memcpy(_state.stripeHash, _newHash, sizeof(_state.stripeHash));
+  _state.contentHash = fingerprint;
+  _state.layoutIndex = _newLayoutIndex;
+  _state.synced = 1;
+
+  if (!RTCMemory::write(RTC_BLOCK_DISPLAY_REFRESH, _state)) {
+    LOG_WARN("RefreshScheduler: failed to save state to RTC memory");
+  }
+}
+
+void RefreshScheduler::invalidate(uint32_t fingerprint) {
+  _state.synced = 0;
+  _state.contentHash = fingerprint;
+  RTCMemory::write(RTC_BLOCK_DISPLAY_REFRESH, _state);
+}
+
+bool RefreshScheduler::isShowing(uint32_t fingerprint) const {
+  return fingerprint != 0 && _state.contentHash == fingerprint;
+}
+
+LayoutRect RefreshScheduler::regionRect(const DisplayLayout& layout, uint8_t region) {
+  switch (region) {
+    case REGION_WEATHER:
+      if (!layout.symbol.visible()) {
+        return layout.weather.rect;
+      }
+      return layout.weather.rect.visible() ? unionRect(layout.weather.rect, layout.symbol) : layout.symbol;
+    case REGION_TIME:
+      return layout.time;
+    case REGION_DATE:
+      return layout.date.rect;
+    case REGION_CLIMATE: {
+      LayoutRect rect = layout.temperature.rect;
+      if (layout.humidity.rect.visible()) {
+        rect = rect.visible() ? unionRect(rect, layout.humidity.rect) : layout.humidity.rect;
+      }
+      // 竖线只在温湿度都有效时绘制，读数变为 NaN 或恢复时竖线随之变化，必须包含在区域内
+      if (rect.visible() && layout.dividerX >= 0 && layout.topLineY >= 0 && layout.bottomLineY >= layout.topLineY) {
+        LayoutRect divider = {layout.dividerX, layout.topLineY, 1, (int16_t)(layout.bottomLineY - layout.topLineY + 1)};
+        rect = unionRect(rect, divider);
+      }
+      return rect;
+    }
+    case REGION_BATTERY:
+      return layout.battery;
+    case REGION_SPARKLINE:
+      return layout.sparkline;
+    default:
+      return NO_RECT;
+  }
+}
+
+void RefreshScheduler::hashRegion(const GFXcanvas1& canvas, const LayoutRect& rect, uint16_t* hashes) {
+  const uint8_t* buffer = canvas.getBuffer();
+
+  // 逻辑 y 范围对应的原生字节列
+  int16_t top = max((int16_t)0, rect.y);
+  int16_t bottom = min((int16_t)LAYOUT_SCREEN_HEIGHT, rect.bottom());
+  int16_t left = max((int16_t)0, rect.x);
+  int16_t right = min((int16_t)LAYOUT_SCREEN_WIDTH, rect.right());
+  int16_t firstByte = (LAYOUT_SCREEN_HEIGHT - bottom) / 8;
+  int16_t lastByte = (LAYOUT_SCREEN_HEIGHT - 1 - top) / 8;
+
+  for (uint8_t stripe = 0; stripe < REFRESH_REGION_STRIPES; stripe++) {
+    // 逻辑 x 对应原生行，按条带等分
+    int16_t rowStart = left + (right - left) * stripe / REFRESH_REGION_STRIPES;
+    int16_t rowEnd = left + (right - left) * (stripe + 1) / REFRESH_REGION_STRIPES;
+
+    // FNV-1a，折叠为 16 位
+    uint32_t hash = 2166136261UL;
+    for (int16_t row = rowStart; row < rowEnd; row++) {
+      const uint8_t* bytes = buffer + row * REFRESH_NATIVE_ROW_BYTES;
+      for (int16_t column = firstByte; column <= lastByte; column++) {
+        hash = (hash ^ bytes[column]) * 16777619UL;
+      }
+    }
+    hashes[stripe] = (uint16_t)((hash >> 16) ^ hash);
+  }
+}
+
+LayoutRect RefreshScheduler::unionRect(const LayoutRect& a, const LayoutRect& b) {
+  int16_t x = min(a.x, b.x);
+  int16_t y = min(a.y, b.y);
+  return LayoutRect{x, y, (int16_t)(max(a.right(), b.right()) - x), (int16_t)(max(a.bottom(), b.bottom()) - y)};
+}
+
+bool RefreshScheduler::isNight(uint8_t hour) const {
+  if (_nightStart == _nightEnd) {
+    return false;
+  }
+  if (_nightStart < _nightEnd) {
+    return hour >= _nightStart && hour < _nightEnd;
+  }
+  return hour >= _nightStart || hour < _nightEnd;  // 跨午夜
+}
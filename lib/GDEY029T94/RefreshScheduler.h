@@ -0,0 +1,121 @@
+#ifndef REFRESH_SCHEDULER_H
+#define REFRESH_SCHEDULER_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "DisplayLayout.h"
+#include "../RTCMemory/RTCMemory.h"
+
+// 参与比较的区域数和每个区域的条带数（沿逻辑 x 方向等分）
+#define REFRESH_REGION_COUNT 6
+#define REFRESH_REGION_STRIPES 4
+
+// 默认残影预算：单个区域自上次全刷以来累计改写的条带数上限
+// 4 个条带 = 区域整体改写一次，120 约为时间区域连续局部刷新 30 次
+#define REFRESH_DEFAULT_GHOST_BUDGET 120
+
+// 默认夜间时段 [start, end)，此时屏幕闪烁不易被注意，有残影时优先全刷
+#define REFRESH_DEFAULT_NIGHT_START 1
+#define REFRESH_DEFAULT_NIGHT_END 6
+
+// 刷新方式
+enum RefreshMode : uint8_t {
+  REFRESH_NONE,     // 画面未变化，不刷新
+  REFRESH_PARTIAL,  // 只局部刷新变化区域的外接矩形
+  REFRESH_FULL      // 整屏全刷，清除残影
+};
+
+// 参与比较的区域
+enum RefreshRegion : uint8_t {
+  REGION_WEATHER = 0,   // 天气文字和符号
+  REGION_TIME = 1,      // 时间
+  REGION_DATE = 2,      // 日期
+  REGION_CLIMATE = 3,   // 室内温湿度（含左侧竖线）
+  REGION_BATTERY = 4,   // 电池图标
+  REGION_SPARKLINE = 5  // 温度趋势图
+};
+
+// 本次唤醒的刷新计划
+struct RefreshPlan {
+  RefreshMode mode;
+  uint8_t changedRegions;                        // 变化区域位掩码
+  uint8_t changedStripes[REFRESH_REGION_COUNT];  // 各区域变化的条带数
+  LayoutRect window;                             // 局部刷新窗口（逻辑坐标）
+  const char* reason;                            // 决策原因（用于日志）
+};
+
+/**
+ * 墨水屏刷新调度器
+ * 每次唤醒按布局区域计算帧缓冲的条带指纹，与 RTC 内存中上一帧的指纹比较，
+ * 结合各区域自上次全刷以来累计的局部刷新量（残影）决定不刷新、局部刷新或全刷。
+ * 全刷优先安排在夜间和整点，并受残影预算约束
+ */
+class RefreshScheduler {
+public:
+  RefreshScheduler();
+
+  // 从 RTC 内存恢复状态，返回控制器中是否保留着上一帧（可以局部刷新）
+  bool begin();
+
+  // 设置残影预算（条带数）
+  void setGhostBudget(uint8_t budget);
+
+  // 设置夜间时段 [start, end)，start == end 表示不区分
+  void setNightHours(uint8_t start, uint8_t end);
+
+  // 渲染输入的指纹与屏幕上已显示的一致（可跳过绘制和刷新）
+  bool isUnchanged(uint32_t fingerprint) const;
+
+  // 根据当前帧缓冲和时间生成刷新计划
+  RefreshPlan plan(const DisplayLayout& layout, const GFXcanvas1& canvas, uint8_t hour, uint8_t minute, bool partialSupported);
+
+  // 预测在 hour:minute 显示时间时的刷新方式（用于唤醒调度按刷新方式估计耗时）
+  // 假设布局不变、只有时间区域改写一个条带（分钟个位），残影、夜间和整点条件与 plan() 相同
+  RefreshMode predict(uint8_t hour, uint8_t minute, bool partialSupported) const;
+
+  // 刷新完成后更新状态并写入 RTC 内存，fingerprint 为本帧渲染输入的指纹
+  void commit(const RefreshPlan& plan, uint32_t fingerprint);
+
+  // 屏幕显示了调度器之外的内容（如配置界面、休眠画面），下次必须全刷
+  // fingerprint 为该画面的指纹，用于判断画面是否已经在屏幕上
+  void invalidate(uint32_t fingerprint = 0);
+
+  // 屏幕上的画面（包括调度器之外的画面）是否与指纹一致
+  bool isShowing(uint32_t fingerprint) const;
+
+private:
+  // RTC 内存中的状态（17 块 + CRC）
+  struct RefreshState {
+    uint32_t contentHash;                        // 屏幕上画面的渲染输入指纹
+    uint16_t stripeHash[REFRESH_REGION_COUNT][REFRESH_REGION_STRIPES];  // 上一帧各条带指纹
+    uint8_t partialCount[REFRESH_REGION_COUNT];  // 各区域自上次全刷以来的局部刷新次数
+    uint8_t ghost[REFRESH_REGION_COUNT];         // 各区域自上次全刷以来累计改写的条带数
+    uint8_t layoutIndex;                         // 上一帧使用的布局
+    uint8_t synced;                              // 控制器中的画面是否与指纹一致
+    uint16_t fullCount;                          // 全刷次数（统计用）
+  };
+
+  // 获取布局中某个区域的矩形
+  static LayoutRect regionRect(const DisplayLayout& layout, uint8_t region);
+
+  // 计算区域各条带的指纹（旋转 1，按原生字节列读取帧缓冲）
+  static void hashRegion(const GFXcanvas1& canvas, const LayoutRect& rect, uint16_t* hashes);
+
+  // 合并两个矩形
+  static LayoutRect unionRect(const LayoutRect& a, const LayoutRect& b);
+
+  // 残影、夜间或整点条件要求全刷时返回原因，否则返回 nullptr
+  const char* fullRefreshReason(const uint8_t* changedStripes, uint8_t maxGhost, uint8_t hour, uint8_t minute) const;
+
+  // 当前时间是否在夜间时段
+  bool isNight(uint8_t hour) const;
+
+  RefreshState _state;
+  uint16_t _newHash[REFRESH_REGION_COUNT][REFRESH_REGION_STRIPES];
+  uint8_t _newLayoutIndex;
+  uint8_t _ghostBudget;
+  uint8_t _nightStart;
+  uint8_t _nightEnd;
+};
+
+#endif // REFRESH_SCHEDULER_H
@@ -0,0 +1,82 @@
+#include "I2CBus.h"
+
+bool I2CBus::_started = false;
+uint16_t I2CBus::_transactions = 0;
+uint16_t I2CBus::_errors = 0;
+
+void I2CBus::begin(uint8_t sda, uint8_t scl, uint32_t clock) {
+  if (_started) {
+    return;
+  }
+  
+  Wire.begin(sda, scl);
+  Wire.setClock(clock);
+  _started = true;
+}
+
+bool I2CBus::isStarted() {
+  return _started;
+}
+
+bool I2CBus::probe(uint8_t address) {
+  Wire.beginTransmission(address);
+  return count(Wire.endTransmission() == 0);
+}
+
+bool I2CBus::write(uint8_t address, const uint8_t* data, uint8_t length) {
+  Wire.beginTransmission(address);
+  Wire.write(data, length);
+  return count(Wire.endTransmission() == 0);
+}
+
+bool I2CBus::read(uint8_t address, uint8_t* data, uint8_t length) {
+  if (Wire.requestFrom(address, length) != length) {
+    return count(false);
+  }
+  
+  for (uint8_t i = 0; i < length; i++) {
+    data[i] = Wire.read();
+  }
+  return count(true);
+}
+
+bool I2CBus::writeRegisters(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  Wire.write(data, length);
+  return count(Wire.endTransmission() == 0);
+}
+
+bool I2CBus::readRegisters(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+  // 写寄存器地址后不发送 STOP，直接重复起始读取
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  if (Wire.endTransmission(false) != 0) {
+    return count(false);
+  }
+  
+  if (Wire.requestFrom(address, length) != length) {
+    return count(false);
+  }
+  
+  for (uint8_t i = 0; i < length; i++) {
+    data[i] = Wire.read();
+  }
+  return count(true);
+}
+
+uint16_t I2CBus::getTransactionCount() {
+  return _transactions;
+}
+
+uint16_t I2CBus::getErrorCount() {
+  return _errors;
+}
+
+bool I2CBus::count(bool ok) {
+  _transactions++;
+  if (!ok) {
+    _errors++;
+  }
+  return ok;
+}
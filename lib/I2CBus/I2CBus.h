@@ -0,0 +1,74 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+// 默认总线时钟：BM8563 和 SHT40 都支持 400kHz 快速模式
+#define I2C_BUS_DEFAULT_CLOCK 400000
+
+/**
+ * 共享 I2C 总线
+ * 多个设备驱动共用同一条总线，只在第一次调用 begin() 时初始化，
+ * 并统计本次唤醒的总线事务数（一次 START 到 STOP 记为一次）和失败次数
+ */
+class I2CBus {
+public:
+  /**
+   * 初始化总线，已初始化时直接返回
+   * @param sda SDA 引脚
+   * @param scl SCL 引脚
+   * @param clock 总线时钟（Hz）
+   */
+  static void begin(uint8_t sda, uint8_t scl, uint32_t clock = I2C_BUS_DEFAULT_CLOCK);
+  
+  /**
+   * 总线是否已初始化
+   */
+  static bool isStarted();
+  
+  /**
+   * 检查设备是否应答
+   */
+  static bool probe(uint8_t address);
+  
+  /**
+   * 发送数据（例如单字节命令）
+   */
+  static bool write(uint8_t address, const uint8_t* data, uint8_t length);
+  
+  /**
+   * 读取数据
+   */
+  static bool read(uint8_t address, uint8_t* data, uint8_t length);
+  
+  /**
+   * 从寄存器 reg 开始连续写入（寄存器地址自动递增）
+   */
+  static bool writeRegisters(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length);
+  
+  /**
+   * 从寄存器 reg 开始连续读取，寄存器地址和数据之间使用重复起始条件
+   */
+  static bool readRegisters(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length);
+  
+  /**
+   * 本次唤醒的总线事务数
+   */
+  static uint16_t getTransactionCount();
+  
+  /**
+   * 本次唤醒失败（无应答或数据不足）的事务数
+   */
+  static uint16_t getErrorCount();
+  
+private:
+  // 记录一次事务，返回 ok
+  static bool count(bool ok);
+  
+  static bool _started;
+  static uint16_t _transactions;
+  static uint16_t _errors;
+};
+
+#endif // I2C_BUS_H
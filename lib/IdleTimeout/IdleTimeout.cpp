@@ -0,0 +1,39 @@
+#include "IdleTimeout.h"
+
+IdleTimeout::IdleTimeout()
+  : _timeoutMs(0), _lastActivityMs(0) {
+}
+
+void IdleTimeout::begin(uint32_t timeoutSeconds) {
+  _timeoutMs = timeoutSeconds * 1000UL;
+  touch();
+}
+
+void IdleTimeout::touch() {
+  _lastActivityMs = millis();
+}
+
+bool IdleTimeout::isEnabled() const {
+  return _timeoutMs > 0;
+}
+
+bool IdleTimeout::isExpired() const {
+  return isEnabled() && idleMs() >= _timeoutMs;
+}
+
+uint32_t IdleTimeout::getRemainingSeconds() const {
+  if (!isEnabled()) {
+    return 0;
+  }
+  uint32_t idle = idleMs();
+  return idle >= _timeoutMs ? 0 : (_timeoutMs - idle + 999) / 1000;
+}
+
+uint32_t IdleTimeout::getTimeoutSeconds() const {
+  return _timeoutMs / 1000;
+}
+
+uint32_t IdleTimeout::idleMs() const {
+  // 无符号减法在 millis() 溢出后仍然正确
+  return millis() - _lastActivityMs;
+}
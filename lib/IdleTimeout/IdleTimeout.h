@@ -0,0 +1,44 @@
+#ifndef IDLE_TIMEOUT_H
+#define IDLE_TIMEOUT_H
+
+#include <Arduino.h>
+
+/**
+ * 空闲超时计时器
+ * 配置模式下记录最近一次活动（串口输入、HTTP 请求、热点上有已连接的设备），
+ * 超过设定时间没有活动时由主程序关闭热点并回到正常的深度睡眠周期。
+ * 基于 millis()，溢出后仍按差值正确计算
+ */
+class IdleTimeout {
+public:
+  IdleTimeout();
+
+  /**
+   * 开始计时
+   * @param timeoutSeconds 超时时间（秒），0 表示不超时
+   */
+  void begin(uint32_t timeoutSeconds);
+
+  // 记录一次活动，重新开始计时
+  void touch();
+
+  // 是否启用了超时
+  bool isEnabled() const;
+
+  // 是否已超时（未启用时总是 false）
+  bool isExpired() const;
+
+  // 距超时的剩余秒数（未启用时返回 0）
+  uint32_t getRemainingSeconds() const;
+
+  // 超时时间（秒）
+  uint32_t getTimeoutSeconds() const;
+
+private:
+  uint32_t idleMs() const;
+
+  uint32_t _timeoutMs;
+  uint32_t _lastActivityMs;
+};
+
+#endif // IDLE_TIMEOUT_H
@@ -1,10 +1,12 @@
 #include "LogManager.h"
 #include <stdarg.h>
+#include "../LogRing/LogRing.h"
 
 // 静态成员变量初始化
 LogLevel LogManager::_currentLevel = LOG_INFO;
 bool LogManager::_timestampEnabled = false;
 bool LogManager::_initialized = false;
+LogOutput LogManager::_output = LOG_OUTPUT_SERIAL;
 
 // 全局实例
 LogManager Logger;
@@ -32,6 +34,19 @@ void LogManager::enableTimestamp(bool enable) {
     infof(F("Timestamp %s"), enable ? F("enabled") : F("disabled"));
 }
 
+void LogManager::setOutput(LogOutput output) {
+    if (output == LOG_OUTPUT_RTC && _output != LOG_OUTPUT_RTC) {
+        LogRing::begin();
+    } else if (output != LOG_OUTPUT_RTC && _output == LOG_OUTPUT_RTC) {
+        LogRing::flush();
+    }
+    _output = output;
+}
+
+LogOutput LogManager::getOutput() {
+    return _output;
+}
+
 // F() 宏版本的日志函数
 void LogManager::error(const __FlashStringHelper* message) {
     _print(LOG_ERROR, message);
@@ -113,7 +128,7 @@ void LogManager::debugf(const __FlashStringHelper* format, ...) {
 }
 
 void LogManager::printSeparator(char character, int length) {
-    if (_currentLevel >= LOG_INFO) {
+    if (isEnabled(LOG_INFO) && _output == LOG_OUTPUT_SERIAL) {
         for (int i = 0; i < length; i++) {
             Serial.print(character);
         }
@@ -122,7 +137,7 @@ void LogManager::printSeparator(char character, int length) {
 }
 
 void LogManager::printKeyValue(const __FlashStringHelper* key, const String& value) {
-    if (_currentLevel >= LOG_INFO) {
+    if (isEnabled(LOG_INFO) && _output == LOG_OUTPUT_SERIAL) {
         _printPrefix(LOG_INFO);
         Serial.print(key);
         Serial.print(F(": "));
@@ -131,7 +146,7 @@ void LogManager::printKeyValue(const __FlashStringHelper* key, const String& val
 }
 
 void LogManager::printKeyValue(const __FlashStringHelper* key, int value) {
-    if (_currentLevel >= LOG_INFO) {
+    if (isEnabled(LOG_INFO) && _output == LOG_OUTPUT_SERIAL) {
         _printPrefix(LOG_INFO);
         Serial.print(key);
         Serial.print(F(": "));
@@ -140,7 +155,7 @@ void LogManager::printKeyValue(const __FlashStringHelper* key, int value) {
 }
 
 void LogManager::printKeyValue(const __FlashStringHelper* key, float value, int decimals) {
-    if (_currentLevel >= LOG_INFO) {
+    if (isEnabled(LOG_INFO) && _output == LOG_OUTPUT_SERIAL) {
         _printPrefix(LOG_INFO);
         Serial.print(key);
         Serial.print(F(": "));
@@ -149,7 +164,7 @@ void LogManager::printKeyValue(const __FlashStringHelper* key, float value, int
 }
 
 void LogManager::printKeyValue(const __FlashStringHelper* key, bool value) {
-    if (_currentLevel >= LOG_INFO) {
+    if (isEnabled(LOG_INFO) && _output == LOG_OUTPUT_SERIAL) {
         _printPrefix(LOG_INFO);
         Serial.print(key);
         Serial.print(F(": "));
@@ -204,28 +219,46 @@ const char* LogManager::_getLevelString(LogLevel level) {
 }
 
 void LogManager::_print(LogLevel level, const __FlashStringHelper* message) {
-    if (!_initialized || level > _currentLevel) return;
+    if (!isEnabled(level)) return;
     
+    if (_output == LOG_OUTPUT_RTC) {
+        LogRing::append(level, message);
+        return;
+    }
     _printPrefix(level);
     Serial.println(message);
 }
 
 void LogManager::_print(LogLevel level, const String& message) {
-    if (!_initialized || level > _currentLevel) return;
+    if (!isEnabled(level)) return;
     
+    if (_output == LOG_OUTPUT_RTC) {
+        LogRing::append(level, message.c_str());
+        return;
+    }
     _printPrefix(level);
     Serial.println(message);
 }
 
 void LogManager::_print(LogLevel level, const char* message) {
-    if (!_initialized || level > _currentLevel) return;
+    if (!isEnabled(level)) return;
     
+    if (_output == LOG_OUTPUT_RTC) {
+        LogRing::append(level, message);
+        return;
+    }
     _printPrefix(level);
     Serial.println(message);
 }
 
 void LogManager::_printf(LogLevel level, const __FlashStringHelper* format, va_list args) {
-    if (!_initialized || level > _currentLevel) return;
+    if (!isEnabled(level)) return;
+    
+    // 二进制模式只保存格式字符串地址和参数，不格式化
+    if (_output == LOG_OUTPUT_RTC) {
+        LogRing::appendf(level, format, args);
+        return;
+    }
     
     _printPrefix(level);
     
@@ -3,6 +3,20 @@
 
 #include <Arduino.h>
 
+// 编译期最低日志级别（数值与 LogLevel 相同：0=无，1=错误，2=警告，3=信息，4=调试）
+// 高于该级别的 LOG_* 宏连同参数求值在编译时整体移除，不占 Flash 也不在运行时格式化；
+// 可在 platformio.ini 的 build_flags 中用 -DLOG_COMPILE_LEVEL=<n> 覆盖
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 3
+#endif
+
+// RTC 内存日志环只记录该级别及以上的日志（默认 2，警告和错误）：日志环只有 33 个字，
+// 约能保存十条记录，而一次唤醒的信息日志就有几十条，全部记录会把之前唤醒的警告和错误覆盖掉；
+// 可用 -DLOG_RTC_LEVEL=<n> 覆盖，高于该级别的日志在 RTC 模式下参数不求值
+#ifndef LOG_RTC_LEVEL
+#define LOG_RTC_LEVEL 2
+#endif
+
 // 日志级别枚举
 enum LogLevel {
     LOG_NONE = 0,    // 不输出任何日志
@@ -12,6 +26,13 @@ enum LogLevel {
     LOG_DEBUG = 4    // 调试信息
 };
 
+// 日志输出目标
+enum LogOutput {
+    LOG_OUTPUT_SERIAL = 0,  // 格式化后输出到串口
+    LOG_OUTPUT_RTC = 1,     // 以二进制记录写入 RTC 内存日志环（见 LogRing），不占用串口
+    LOG_OUTPUT_NONE = 2     // 丢弃所有日志，不格式化也不求值参数（静默模式，串口不初始化）
+};
+
 class LogManager {
 public:
     // 初始化日志管理器
@@ -23,9 +44,22 @@ public:
     // 获取当前日志级别
     static LogLevel getLogLevel();
     
+    // 该级别的日志是否会输出（编译期级别和运行时级别都满足，且输出目标可用；RTC 模式还需满足 LOG_RTC_LEVEL）
+    static inline bool isEnabled(LogLevel level) {
+        return level <= LOG_COMPILE_LEVEL && level <= _currentLevel &&
+               (_output == LOG_OUTPUT_SERIAL ? _initialized : (_output == LOG_OUTPUT_RTC && level <= LOG_RTC_LEVEL));
+    }
+    
     // 启用/禁用时间戳
     static void enableTimestamp(bool enable);
     
+    // 设置输出目标，切换到 LOG_OUTPUT_RTC 时恢复 RTC 内存中的日志环，从 RTC 切换到其他目标时写回
+    // 串口输出需要先调用 begin()，其他目标不需要初始化串口
+    static void setOutput(LogOutput output);
+    
+    // 获取输出目标
+    static LogOutput getOutput();
+    
     // 日志输出函数 - 使用 F() 宏的版本
     static void error(const __FlashStringHelper* message);
     static void warn(const __FlashStringHelper* message);
@@ -63,6 +97,7 @@ private:
     static LogLevel _currentLevel;
     static bool _timestampEnabled;
     static bool _initialized;
+    static LogOutput _output;
     
     // 内部辅助函数
     static void _printPrefix(LogLevel level);
@@ -75,15 +110,40 @@ private:
 };
 
 // 便捷宏定义
+// 格式化版本先检查运行时级别再求值参数，被过滤的日志不会调用参数中的函数（如 String::c_str()）
+#define LOG_IF_ENABLED(level, call) do { if (LogManager::isEnabled(level)) { call; } } while (0)
+
+#if LOG_COMPILE_LEVEL >= 1
 #define LOG_ERROR(msg) LogManager::error(F(msg))
+#define LOG_ERROR_F(format, ...) LOG_IF_ENABLED(LOG_ERROR, LogManager::errorf(F(format), ##__VA_ARGS__))
+#else
+#define LOG_ERROR(msg) do {} while (0)
+#define LOG_ERROR_F(format, ...) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 2
 #define LOG_WARN(msg) LogManager::warn(F(msg))
+#define LOG_WARN_F(format, ...) LOG_IF_ENABLED(LOG_WARN, LogManager::warnf(F(format), ##__VA_ARGS__))
+#else
+#define LOG_WARN(msg) do {} while (0)
+#define LOG_WARN_F(format, ...) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 3
 #define LOG_INFO(msg) LogManager::info(F(msg))
-#define LOG_DEBUG(msg) LogManager::debug(F(msg))
+#define LOG_INFO_F(format, ...) LOG_IF_ENABLED(LOG_INFO, LogManager::infof(F(format), ##__VA_ARGS__))
+#else
+#define LOG_INFO(msg) do {} while (0)
+#define LOG_INFO_F(format, ...) do {} while (0)
+#endif
 
-#define LOG_ERROR_F(format, ...) LogManager::errorf(F(format), ##__VA_ARGS__)
-#define LOG_WARN_F(format, ...) LogManager::warnf(F(format), ##__VA_ARGS__)
-#define LOG_INFO_F(format, ...) LogManager::infof(F(format), ##__VA_ARGS__)
-#define LOG_DEBUG_F(format, ...) LogManager::debugf(F(format), ##__VA_ARGS__)
+#if LOG_COMPILE_LEVEL >= 4
+#define LOG_DEBUG(msg) LogManager::debug(F(msg))
+#define LOG_DEBUG_F(format, ...) LOG_IF_ENABLED(LOG_DEBUG, LogManager::debugf(F(format), ##__VA_ARGS__))
+#else
+#define LOG_DEBUG(msg) do {} while (0)
+#define LOG_DEBUG_F(format, ...) do {} while (0)
+#endif
 
 // 全局日志管理器实例
 extern LogManager Logger;
@@ -0,0 +1,338 @@
+#include "LogRing.h"
+
+// ESP8266 Flash 映射窗口（1 MB），格式字符串和 F() 文本都位于这里
+#define LOG_RING_FLASH_START 0x40200000UL
+#define LOG_RING_FLASH_END   0x40300000UL
+
+// 常量字符串（字面量）所在的 .rodata 段，由链接脚本定义；弱引用，未定义时为空
+extern "C" char _rodata_start[] __attribute__((weak));
+extern "C" char _rodata_end[] __attribute__((weak));
+
+// RAM 字符串参数的编码：最高字节为标记，低 3 字节为前 3 个字符
+#define LOG_RING_INLINE_TAG  0xFF000000UL
+
+// 记录头：级别 3 位、类型 2 位、参数个数 3 位、唤醒序号 8 位、启动后毫秒数 16 位
+#define LOG_HEADER(level, kind, argc, wake, ms) \
+  ((uint32_t)((level) & 0x07) | ((uint32_t)((kind) & 0x03) << 3) | ((uint32_t)((argc) & 0x07) << 5) | \
+   ((uint32_t)(wake) << 8) | ((uint32_t)(ms) << 16))
+#define LOG_HEADER_LEVEL(header) ((header) & 0x07)
+#define LOG_HEADER_KIND(header)  (((header) >> 3) & 0x03)
+#define LOG_HEADER_ARGC(header)  (((header) >> 5) & 0x07)
+#define LOG_HEADER_WAKE(header)  (((header) >> 8) & 0xFF)
+#define LOG_HEADER_MS(header)    ((header) >> 16)
+
+LogRing::State LogRing::_state;
+bool LogRing::_started = false;
+bool LogRing::_dirty = false;
+
+bool LogRing::begin() {
+  static_assert(RTC_BLOCK_LOG_RING + RTCMemory::blocks<State>() <= 128, "Log ring exceeds RTC user memory");
+
+  // 格式字符串以地址保存，固件变化后旧记录无法解码，直接清空
+  bool restored = load() && _state.buildId == currentBuildId();
+  if (!restored) {
+    memset(&_state, 0, sizeof(_state));
+    _state.buildId = currentBuildId();
+  }
+
+  // 唤醒序号随第一次 flush() 写入
+  _state.wake++;
+  _started = true;
+  _dirty = true;
+  return restored;
+}
+
+void LogRing::append(uint8_t level, const __FlashStringHelper* text) {
+  push(level, LOG_RECORD_TEXT, (uint32_t)text, nullptr, 0);
+}
+
+void LogRing::append(uint8_t level, const char* text) {
+  // RAM 文本的内容在睡眠后丢失，直接保存前 16 字节
+  uint32_t args[LOG_RING_MAX_ARGS] = {};
+  size_t length = text ? min(strlen(text), sizeof(args)) : 0;
+  memcpy(args, text, length);
+  push(level, LOG_RECORD_INLINE, 0, args, (length + 3) / 4);
+}
+
+void LogRing::appendf(uint8_t level, const __FlashStringHelper* format, va_list args) {
+  uint32_t values[LOG_RING_MAX_ARGS];
+  uint8_t argc = 0;
+
+  // 按格式字符串的转换符从 va_list 中取出参数（long 与 int 同为 32 位）
+  PGM_P p = (PGM_P)format;
+  char c;
+  while ((c = pgm_read_byte(p++)) != '\0' && argc < LOG_RING_MAX_ARGS) {
+    if (c != '%') {
+      continue;
+    }
+    do {
+      c = pgm_read_byte(p++);
+    } while (c != '\0' && strchr("-+ #0123456789.lhzjt", c) != nullptr);
+
+    if (c == '\0') {
+      break;
+    }
+    switch (c) {
+      case '%':
+        continue;
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+        float value = (float)va_arg(args, double);
+        memcpy(&values[argc], &value, sizeof(value));
+        break;
+      }
+      case 's':
+        values[argc] = encodeString(va_arg(args, const char*));
+        break;
+      default:
+        values[argc] = va_arg(args, uint32_t);
+        break;
+    }
+    argc++;
+  }
+
+  push(level, LOG_RECORD_FORMAT, (uint32_t)format, values, argc);
+}
+
+void LogRing::push(uint8_t level, LogRecordKind kind, uint32_t address, const uint32_t* args, uint8_t argc) {
+  if (!_started) {
+    return;
+  }
+
+  // 缓冲区不足时丢弃最旧的记录
+  uint8_t length = 2 + argc;
+  while (_state.used + length > LOG_RING_WORDS) {
+    uint8_t oldest = 2 + LOG_HEADER_ARGC(_state.words[_state.head]);
+    _state.head = (_state.head + oldest) % LOG_RING_WORDS;
+    _state.used -= oldest;
+    if (_state.dropped < UINT8_MAX) {
+      _state.dropped++;
+    }
+  }
+
+  uint32_t ms = min(millis(), 0xFFFFUL);
+  uint8_t tail = (_state.head + _state.used) % LOG_RING_WORDS;
+  _state.words[tail] = LOG_HEADER(level, kind, argc, _state.wake, ms);
+  _state.words[(tail + 1) % LOG_RING_WORDS] = address;
+  for (uint8_t i = 0; i < argc; i++) {
+    _state.words[(tail + 2 + i) % LOG_RING_WORDS] = args[i];
+  }
+  _state.used += length;
+  _dirty = true;
+
+  // 每次写入都要重写整个日志环（36 块）并重新计算 CRC，其他记录在睡眠前一次写入；
+  // 错误记录立即写入，之后复位或看门狗超时也能保留
+  if (level <= LOG_RING_FLUSH_LEVEL) {
+    flush();
+  }
+}
+
+void LogRing::flush() {
+  if (!_started || !_dirty) {
+    return;
+  }
+  RTCMemory::write(RTC_BLOCK_LOG_RING, _state);
+  _dirty = false;
+}
+
+uint32_t LogRing::encodeString(const char* text) {
+  if (text == nullptr) {
+    return 0;
+  }
+  // Flash 和 .rodata 中的字符串内容固定，保存地址即可
+  if (isFlashAddress((uint32_t)text) || isConstAddress((uint32_t)text)) {
+    return (uint32_t)text;
+  }
+
+  uint32_t value = LOG_RING_INLINE_TAG;
+  for (uint8_t i = 0; i < 3 && text[i] != '\0'; i++) {
+    value |= (uint32_t)(uint8_t)text[i] << (8 * i);
+  }
+  return value;
+}
+
+uint16_t LogRing::getRecordCount() {
+  if (!_started && !load()) {
+    return 0;
+  }
+
+  uint16_t count = 0;
+  for (uint8_t offset = 0; offset < _state.used; count++) {
+    offset += 2 + LOG_HEADER_ARGC(_state.words[(_state.head + offset) % LOG_RING_WORDS]);
+  }
+  return count;
+}
+
+uint8_t LogRing::getDroppedCount() {
+  if (!_started && !load()) {
+    return 0;
+  }
+  return _state.dropped;
+}
+
+void LogRing::print(Print& out) {
+  if (!_started && !load()) {
+    out.println(F("No RTC log records"));
+    return;
+  }
+  if (_state.buildId != currentBuildId()) {
+    out.println(F("RTC log was written by another firmware build, decode 'logs raw' with scripts/decode_rtc_log.py"));
+    return;
+  }
+
+  out.printf_P(PSTR("RTC log: %u records, %u dropped\n"), getRecordCount(), _state.dropped);
+
+  static const char* const LEVELS[] = {"NONE ", "ERROR", "WARN ", "INFO ", "DEBUG"};
+  for (uint8_t offset = 0; offset < _state.used;) {
+    uint32_t record[2 + LOG_RING_MAX_ARGS];
+    uint32_t header = _state.words[(_state.head + offset) % LOG_RING_WORDS];
+    uint8_t argc = min((uint8_t)LOG_HEADER_ARGC(header), (uint8_t)LOG_RING_MAX_ARGS);
+    for (uint8_t i = 0; i < 2 + argc; i++) {
+      record[i] = _state.words[(_state.head + offset + i) % LOG_RING_WORDS];
+    }
+    offset += 2 + LOG_HEADER_ARGC(header);
+
+    uint8_t level = LOG_HEADER_LEVEL(header);
+    out.printf_P(PSTR("[#%03u %5ums] [%s] "), (unsigned)LOG_HEADER_WAKE(header), (unsigned)LOG_HEADER_MS(header),
+                 level <= 4 ? LEVELS[level] : "?    ");
+
+    switch (LOG_HEADER_KIND(header)) {
+      case LOG_RECORD_FORMAT:
+        if (isFlashAddress(record[1])) {
+          printFormatted(out, (const char*)record[1], record + 2, argc);
+        }
+        break;
+      case LOG_RECORD_TEXT:
+        if (isFlashAddress(record[1])) {
+          out.print((const __FlashStringHelper*)record[1]);
+        }
+        break;
+      default: {
+        char text[sizeof(uint32_t) * LOG_RING_MAX_ARGS + 1] = {};
+        memcpy(text, record + 2, argc * sizeof(uint32_t));
+        out.print(text);
+        break;
+      }
+    }
+    out.println();
+  }
+}
+
+void LogRing::printFormatted(Print& out, const char* format, const uint32_t* args, uint8_t argc) {
+  // 逐个转换符调用 snprintf，参数类型由转换符决定
+  PGM_P p = format;
+  uint8_t index = 0;
+  char c;
+  while ((c = pgm_read_byte(p++)) != '\0') {
+    if (c != '%') {
+      out.print(c);
+      continue;
+    }
+
+    char spec[16] = "%";
+    uint8_t length = 1;
+    do {
+      c = pgm_read_byte(p++);
+      if (length < sizeof(spec) - 1) {
+        spec[length++] = c;
+      }
+    } while (c != '\0' && strchr("-+ #0123456789.lhzjt", c) != nullptr);
+    spec[length] = '\0';
+
+    if (c == '\0') {
+      break;
+    }
+    if (c == '%') {
+      out.print('%');
+      continue;
+    }
+    if (index >= argc) {
+      out.print(F("<?>"));
+      continue;
+    }
+
+    char buffer[40];
+    uint32_t value = args[index++];
+    switch (c) {
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+        float number;
+        memcpy(&number, &value, sizeof(number));
+        snprintf(buffer, sizeof(buffer), spec, (double)number);
+        break;
+      }
+      case 's': {
+        char text[32];
+        decodeString(value, text, sizeof(text));
+        snprintf(buffer, sizeof(buffer), spec, text);
+        break;
+      }
+      default:
+        snprintf(buffer, sizeof(buffer), spec, value);
+        break;
+    }
+    out.print(buffer);
+  }
+}
+
+void LogRing::decodeString(uint32_t value, char* buffer, size_t size) {
+  if (value == 0) {
+    strncpy(buffer, "(null)", size);
+  } else if ((value & 0xFF000000UL) == LOG_RING_INLINE_TAG) {
+    // RAM 字符串只保存了前 3 个字符
+    uint8_t length = 0;
+    for (uint8_t i = 0; i < 3 && length < size - 4; i++) {
+      char c = (value >> (8 * i)) & 0xFF;
+      if (c == '\0') {
+        break;
+      }
+      buffer[length++] = c;
+    }
+    strcpy(buffer + length, length == 3 ? ".." : "");
+    return;
+  } else if (isFlashAddress(value)) {
+    strncpy_P(buffer, (PGM_P)value, size);
+  } else if (isConstAddress(value)) {
+    strncpy(buffer, (const char*)value, size);
+  } else {
+    strncpy(buffer, "?", size);
+  }
+  buffer[size - 1] = '\0';
+}
+
+void LogRing::dump(Print& out) {
+  if (!_started && !load()) {
+    out.println(F("No RTC log records"));
+    return;
+  }
+
+  // 一行输出全部状态字，与 State 的内存布局一致
+  const uint32_t* words = (const uint32_t*)&_state;
+  out.print(F("RTCLOG"));
+  for (size_t i = 0; i < sizeof(_state) / sizeof(uint32_t); i++) {
+    out.printf_P(PSTR(" %08x"), words[i]);
+  }
+  out.println();
+}
+
+void LogRing::clear() {
+  memset(&_state, 0, sizeof(_state));
+  _state.buildId = currentBuildId();
+  RTCMemory::write(RTC_BLOCK_LOG_RING, _state);
+  _dirty = false;
+}
+
+bool LogRing::load() {
+  return RTCMemory::read(RTC_BLOCK_LOG_RING, _state) && _state.head < LOG_RING_WORDS && _state.used <= LOG_RING_WORDS;
+}
+
+bool LogRing::isFlashAddress(uint32_t address) {
+  return address >= LOG_RING_FLASH_START && address < LOG_RING_FLASH_END;
+}
+
+bool LogRing::isConstAddress(uint32_t address) {
+  return _rodata_start != nullptr && address >= (uint32_t)_rodata_start && address < (uint32_t)_rodata_end;
+}
+
+uint32_t LogRing::currentBuildId() {
+  // 固件大小随代码变化，足以区分格式字符串地址是否仍然有效（结果由核心库缓存）
+  return ESP.getSketchSize();
+}
@@ -0,0 +1,105 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "../RTCMemory/RTCMemory.h"
+
+// 环形缓冲区数据字数（加上 2 字状态和 1 字 CRC 共 36 块）
+#define LOG_RING_WORDS 33
+
+// 每条记录最多保存的参数个数，多出的参数被忽略
+#define LOG_RING_MAX_ARGS 4
+
+// 级别不高于该值（1=错误）的记录立即写入 RTC 内存，其他记录在 flush() 时写入
+#define LOG_RING_FLUSH_LEVEL 1
+
+// 记录类型
+enum LogRecordKind : uint8_t {
+  LOG_RECORD_FORMAT = 0,  // Flash 中的格式字符串 + 参数
+  LOG_RECORD_TEXT = 1,    // Flash 中的固定文本
+  LOG_RECORD_INLINE = 2   // RAM 中的文本，前 16 字节直接存入参数字
+};
+
+/**
+ * RTC 内存二进制日志环
+ * 每条日志只保存格式字符串在 Flash 中的地址、最多 4 个 32 位参数、级别、唤醒序号和启动后的毫秒数，
+ * 不格式化也不经过串口。记录先追加到 RAM 中的副本，睡眠前由 flush() 一次写入 RTC 内存
+ * （错误记录立即写入），深度睡眠后保留，写满时覆盖最旧的记录。
+ * 记录在配置模式下由 print() 解码输出，或由 dump() 输出原始数据交给 scripts/decode_rtc_log.py 解码
+ *
+ * 容量：33 个数据字，每条记录 2-6 个字，共 5-16 条（通常约 10 条）
+ * 字符串参数：指向 Flash 或常量区（字面量）的指针保存地址，其他 RAM 中的字符串只保存前 3 个字符
+ */
+class LogRing {
+public:
+  /**
+   * 从 RTC 内存恢复缓冲区并开始新的一次唤醒
+   * 冷启动、数据损坏或固件变化（格式字符串地址失效）时清空
+   * @return 是否恢复了之前的记录
+   */
+  static bool begin();
+
+  // 追加一条记录（level 与 LogLevel 相同）
+  static void append(uint8_t level, const __FlashStringHelper* text);
+  static void append(uint8_t level, const char* text);
+  static void appendf(uint8_t level, const __FlashStringHelper* format, va_list args);
+
+  // 将本次唤醒追加的记录写入 RTC 内存（没有新记录时不写），深度睡眠前调用
+  static void flush();
+
+  // 缓冲区中的记录数
+  static uint16_t getRecordCount();
+
+  // 被覆盖的记录数（最大 255）
+  static uint8_t getDroppedCount();
+
+  // 解码并输出所有记录（只能解码当前固件写入的记录）
+  static void print(Print& out);
+
+  // 以十六进制输出缓冲区原始数据，供主机端解码
+  static void dump(Print& out);
+
+  // 清空缓冲区
+  static void clear();
+
+private:
+  // RTC 内存中的状态（35 字 + CRC）
+  struct State {
+    uint32_t buildId;                // 写入记录的固件标识（固件大小）
+    uint8_t head;                    // 最旧记录的起始字
+    uint8_t used;                    // 已用字数
+    uint8_t wake;                    // 唤醒序号
+    uint8_t dropped;                 // 被覆盖的记录数
+    uint32_t words[LOG_RING_WORDS];  // 记录数据
+  };
+
+  // 读取 RTC 内存中的状态，失败时返回 false
+  static bool load();
+
+  // 写入一条记录（header 和参数），错误记录立即保存到 RTC 内存
+  static void push(uint8_t level, LogRecordKind kind, uint32_t address, const uint32_t* args, uint8_t argc);
+
+  // 编码字符串参数
+  static uint32_t encodeString(const char* text);
+
+  // 解码一条格式化记录
+  static void printFormatted(Print& out, const char* format, const uint32_t* args, uint8_t argc);
+
+  // 解码字符串参数
+  static void decodeString(uint32_t value, char* buffer, size_t size);
+
+  // 地址是否指向当前固件的 Flash 区域
+  static bool isFlashAddress(uint32_t address);
+
+  // 地址是否位于常量区（.rodata，字符串字面量）
+  static bool isConstAddress(uint32_t address);
+
+  static uint32_t currentBuildId();
+
+  static State _state;
+  static bool _started;
+  static bool _dirty;  // RAM 中的副本有尚未写入 RTC 内存的修改
+};
+
+#endif // LOG_RING_H
@@ -0,0 +1,192 @@
+#include "Metrics.h"
+
+// 布局版本：修改 State 或指标列表时递增，旧数据在下次启动时清零
+#define METRICS_VERSION 1
+
+// Prometheus 指标名前缀
+#define METRICS_PREFIX "weweather_"
+
+// 指标名和说明（保存在 Flash 中，输出时逐条拷贝）
+struct MetricInfo {
+  char name[28];
+  char help[44];
+};
+
+static const MetricInfo COUNTER_INFO[METRIC_COUNTER_COUNT] PROGMEM = {
+  {"wakes_total", "Normal wakes since power-on"},
+  {"wifi_connect_attempts_total", "WiFi connection attempts"},
+  {"wifi_connect_failures_total", "WiFi connection attempts that timed out"},
+  {"http_requests_total", "Weather API requests"},
+  {"http_failures_total", "Weather API requests without HTTP 200"},
+  {"ntp_syncs_total", "Successful NTP time syncs"},
+  {"ntp_failures_total", "NTP time syncs that timed out"},
+  {"flash_commits_total", "EEPROM sector commits"},
+};
+
+static const MetricInfo GAUGE_INFO[METRIC_GAUGE_COUNT] PROGMEM = {
+  {"free_heap_bytes", "Free heap before deep sleep"},
+  {"wifi_rssi_dbm", "Signal strength of the last connection"},
+  {"battery_millivolts", "Battery voltage"},
+};
+
+static const MetricInfo HISTOGRAM_INFO[METRIC_HISTOGRAM_COUNT] PROGMEM = {
+  {"wake_duration_seconds", "Time from wake to deep sleep"},
+  {"wifi_connect_seconds", "Time to connect to WiFi"},
+};
+
+static_assert(sizeof(MetricInfo) % 4 == 0, "MetricInfo must be word aligned for PROGMEM reads");
+
+Metrics::State Metrics::_state;
+bool Metrics::_started = false;
+
+bool Metrics::begin() {
+  static_assert(RTC_BLOCK_METRICS + RTCMemory::blocks<State>() <= 128, "Metrics exceed RTC user memory");
+
+  bool restored = RTCMemory::read(RTC_BLOCK_METRICS, _state) && _state.version == METRICS_VERSION;
+  if (!restored) {
+    memset(&_state, 0, sizeof(_state));
+    _state.version = METRICS_VERSION;
+  }
+  _started = true;
+  return restored;
+}
+
+void Metrics::increment(MetricCounter counter, uint32_t delta) {
+  ensureStarted();
+  _state.counters[counter] += delta;
+  save();
+}
+
+void Metrics::set(MetricGauge gauge, int32_t value) {
+  ensureStarted();
+  if (_state.gauges[gauge] == value) {
+    return;
+  }
+  _state.gauges[gauge] = value;
+  save();
+}
+
+void Metrics::observe(MetricHistogram histogram, uint32_t valueMs) {
+  ensureStarted();
+  Histogram& h = _state.histograms[histogram];
+
+  uint8_t bucket = 0;
+  while (bucket < METRICS_HISTOGRAM_BUCKETS - 1 && valueMs > ((uint32_t)METRICS_BUCKET_BASE_MS << bucket)) {
+    bucket++;
+  }
+
+  // 桶计数将要溢出时整体减半，保持分布比例
+  if (h.buckets[bucket] == UINT16_MAX || h.sumMs > UINT32_MAX - valueMs) {
+    for (uint8_t i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+      h.buckets[i] /= 2;
+    }
+    h.sumMs /= 2;
+  }
+
+  h.buckets[bucket]++;
+  h.sumMs += valueMs;
+  save();
+}
+
+uint32_t Metrics::get(MetricCounter counter) {
+  ensureStarted();
+  return _state.counters[counter];
+}
+
+int32_t Metrics::get(MetricGauge gauge) {
+  ensureStarted();
+  return _state.gauges[gauge];
+}
+
+void Metrics::printPrometheus(Print& out) {
+  ensureStarted();
+  MetricInfo info;
+
+  for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+    memcpy_P(&info, &COUNTER_INFO[i], sizeof(info));
+    out.printf_P(PSTR("# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s counter\n" METRICS_PREFIX "%s %u\n"),
+                 info.name, info.help, info.name, info.name, _state.counters[i]);
+  }
+
+  for (uint8_t i = 0; i < METRIC_GAUGE_COUNT; i++) {
+    memcpy_P(&info, &GAUGE_INFO[i], sizeof(info));
+    out.printf_P(PSTR("# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s gauge\n" METRICS_PREFIX "%s %d\n"),
+                 info.name, info.help, info.name, info.name, _state.gauges[i]);
+  }
+
+  for (uint8_t i = 0; i < METRIC_HISTOGRAM_COUNT; i++) {
+    const Histogram& h = _state.histograms[i];
+    memcpy_P(&info, &HISTOGRAM_INFO[i], sizeof(info));
+    out.printf_P(PSTR("# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s histogram\n"),
+                 info.name, info.help, info.name);
+
+    // Prometheus 的桶计数是累计的，单位为秒
+    uint32_t cumulative = 0;
+    for (uint8_t bucket = 0; bucket < METRICS_HISTOGRAM_BUCKETS; bucket++) {
+      cumulative += h.buckets[bucket];
+      if (bucket < METRICS_HISTOGRAM_BUCKETS - 1) {
+        uint32_t bound = (uint32_t)METRICS_BUCKET_BASE_MS << bucket;
+        out.printf_P(PSTR(METRICS_PREFIX "%s_bucket{le=\"%u.%03u\"} %u\n"), info.name, bound / 1000, bound % 1000, cumulative);
+      } else {
+        out.printf_P(PSTR(METRICS_PREFIX "%s_bucket{le=\"+Inf\"} %u\n"), info.name, cumulative);
+      }
+    }
+    out.printf_P(PSTR(METRICS_PREFIX "%s_sum %u.%03u\n" METRICS_PREFIX "%s_count %u\n"),
+                 info.name, h.sumMs / 1000, h.sumMs % 1000, info.name, cumulative);
+  }
+}
+
+void Metrics::print(Print& out) {
+  ensureStarted();
+  MetricInfo info;
+
+  out.println(F("=== Metrics (since power-on) ==="));
+  for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+    memcpy_P(&info, &COUNTER_INFO[i], sizeof(info));
+    out.printf_P(PSTR("%-28s %u\n"), info.name, _state.counters[i]);
+  }
+  for (uint8_t i = 0; i < METRIC_GAUGE_COUNT; i++) {
+    memcpy_P(&info, &GAUGE_INFO[i], sizeof(info));
+    out.printf_P(PSTR("%-28s %d\n"), info.name, _state.gauges[i]);
+  }
+  for (uint8_t i = 0; i < METRIC_HISTOGRAM_COUNT; i++) {
+    const Histogram& h = _state.histograms[i];
+    uint32_t count = histogramCount(h);
+    memcpy_P(&info, &HISTOGRAM_INFO[i], sizeof(info));
+    out.printf_P(PSTR("%-28s n=%u avg=%ums |"), info.name, count, count > 0 ? h.sumMs / count : 0);
+    for (uint8_t bucket = 0; bucket < METRICS_HISTOGRAM_BUCKETS; bucket++) {
+      if (bucket < METRICS_HISTOGRAM_BUCKETS - 1) {
+        out.printf_P(PSTR(" <=%u:%u"), (uint32_t)METRICS_BUCKET_BASE_MS << bucket, h.buckets[bucket]);
+      } else {
+        out.printf_P(PSTR(" more:%u"), h.buckets[bucket]);
+      }
+    }
+    out.println();
+  }
+  out.println(F("================================"));
+}
+
+void Metrics::reset() {
+  memset(&_state, 0, sizeof(_state));
+  _state.version = METRICS_VERSION;
+  _started = true;
+  save();
+}
+
+void Metrics::ensureStarted() {
+  if (!_started) {
+    begin();
+  }
+}
+
+void Metrics::save() {
+  RTCMemory::write(RTC_BLOCK_METRICS, _state);
+}
+
+uint32_t Metrics::histogramCount(const Histogram& histogram) {
+  uint32_t count = 0;
+  for (uint8_t i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+    count += histogram.buckets[i];
+  }
+  return count;
+}
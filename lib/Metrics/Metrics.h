@@ -0,0 +1,99 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "../RTCMemory/RTCMemory.h"
+
+// 直方图桶数（最后一个桶为 +Inf），桶上限为 METRICS_BUCKET_BASE_MS * 2^i
+#define METRICS_HISTOGRAM_BUCKETS 6
+#define METRICS_BUCKET_BASE_MS 500
+
+// 计数器（只增不减，冷启动时清零）
+enum MetricCounter : uint8_t {
+  METRIC_WAKES = 0,           // 正常唤醒次数
+  METRIC_WIFI_ATTEMPTS,       // WiFi 连接尝试次数
+  METRIC_WIFI_FAILURES,       // WiFi 连接失败次数
+  METRIC_HTTP_REQUESTS,       // 天气 API 请求次数
+  METRIC_HTTP_FAILURES,       // 天气 API 请求失败次数（非 200）
+  METRIC_NTP_SYNCS,           // NTP 同步成功次数
+  METRIC_NTP_FAILURES,        // NTP 同步失败次数
+  METRIC_FLASH_COMMITS,       // EEPROM 扇区写入次数
+  METRIC_COUNTER_COUNT
+};
+
+// 仪表（最近一次的值）
+enum MetricGauge : uint8_t {
+  METRIC_FREE_HEAP = 0,       // 睡眠前的空闲堆（字节）
+  METRIC_WIFI_RSSI,           // 最近一次连接的信号强度（dBm）
+  METRIC_BATTERY_MV,          // 电池电压（mV）
+  METRIC_GAUGE_COUNT
+};
+
+// 直方图（毫秒，按 2 的幂分桶）
+enum MetricHistogram : uint8_t {
+  METRIC_WAKE_DURATION = 0,   // 唤醒到进入深度睡眠的耗时
+  METRIC_WIFI_CONNECT,        // WiFi 连接成功的耗时
+  METRIC_HISTOGRAM_COUNT
+};
+
+/**
+ * 固定内存的运行指标
+ * 计数器、仪表和按对数分桶的直方图保存在 RTC 内存中，深度睡眠后保留，断电后清零。
+ * 各模块在事件发生时直接更新，每次更新立即写入 RTC 内存；配置模式下通过串口 stats 命令
+ * 或网页 /metrics（Prometheus 文本格式）读取
+ */
+class Metrics {
+public:
+  // 从 RTC 内存恢复指标，冷启动、数据损坏或布局变化时清零；首次更新时自动调用
+  static bool begin();
+
+  // 计数器加 delta
+  static void increment(MetricCounter counter, uint32_t delta = 1);
+
+  // 设置仪表
+  static void set(MetricGauge gauge, int32_t value);
+
+  // 向直方图记录一个观测值（毫秒）
+  static void observe(MetricHistogram histogram, uint32_t valueMs);
+
+  // 读取计数器和仪表
+  static uint32_t get(MetricCounter counter);
+  static int32_t get(MetricGauge gauge);
+
+  // 以 Prometheus 文本格式输出所有指标
+  static void printPrometheus(Print& out);
+
+  // 以便于阅读的格式输出所有指标
+  static void print(Print& out);
+
+  // 清零所有指标
+  static void reset();
+
+private:
+  // 直方图：各桶计数（非累计）和观测值之和
+  // 任一桶计数将要溢出时所有桶和总和减半，比例不变（Prometheus 视为计数器重置）
+  struct Histogram {
+    uint16_t buckets[METRICS_HISTOGRAM_BUCKETS];
+    uint32_t sumMs;
+  };
+
+  // RTC 内存中的状态（20 字 + CRC）
+  struct State {
+    uint32_t version;                          // 布局版本
+    uint32_t counters[METRIC_COUNTER_COUNT];
+    int32_t gauges[METRIC_GAUGE_COUNT];
+    Histogram histograms[METRIC_HISTOGRAM_COUNT];
+  };
+
+  // 确保已从 RTC 内存恢复
+  static void ensureStarted();
+
+  static void save();
+
+  static uint32_t histogramCount(const Histogram& histogram);
+
+  static State _state;
+  static bool _started;
+};
+
+#endif // METRICS_H
@@ -0,0 +1,152 @@
+#include "MicroBench.h"
+#include "../LogManager/LogManager.h"
+#include "../WeatherManager/WeatherManager.h"
+#include "../TimeManager/TimeManager.h"
+#include "../ClimateHistory/ClimateHistory.h"
+
+// 高德实时天气接口的响应示例（格式与接口文档一致，数值为示例）
+static const char SAMPLE_AMAP_PAYLOAD[] PROGMEM =
+  "{\"status\":\"1\",\"count\":\"1\",\"info\":\"OK\",\"infocode\":\"10000\",\"lives\":[{"
+  "\"province\":\"北京\",\"city\":\"海淀区\",\"adcode\":\"110108\",\"weather\":\"雷阵雨\","
+  "\"temperature\":\"23\",\"winddirection\":\"西北\",\"windpower\":\"≤3\",\"humidity\":\"65\","
+  "\"reporttime\":\"2025-06-15 12:00:00\",\"temperature_float\":\"23.0\",\"humidity_float\":\"65.0\"}]}";
+
+// 所有用例共用的输入，计时前准备好，不计入耗时
+struct BenchContext {
+  GDEY029T94* display;
+  String payload;
+  WeatherInfo weather;
+  ClimateSeries series;
+  DateTime time;
+};
+
+// 累加每次调用的结果，避免被编译器优化掉
+static volatile uint32_t benchSink;
+
+static void benchGetWeatherInfo(BenchContext& ctx) {
+  benchSink += WeatherManager::getWeatherInfo(ctx.weather).length();
+}
+
+static void benchParseWeatherResponse(BenchContext& ctx) {
+  WeatherInfo weather;
+  benchSink += WeatherManager::parseWeatherResponse(ctx.payload, weather) ? weather.Symbol : 0;
+}
+
+static void benchRenderTimeDisplay(BenchContext& ctx) {
+  ctx.display->renderTimeDisplay(ctx.time, ctx.weather, 23.4f, 45.0f, 87.0f, &ctx.series);
+}
+
+// 基准用例：每轮连续调用 iterations 次，使单轮耗时在毫秒量级
+struct BenchCase {
+  const char* name;
+  uint16_t iterations;
+  void (*function)(BenchContext& ctx);
+};
+
+// 只包含依赖 Arduino String、ArduinoJson 或帧缓冲的函数；不依赖 Arduino 的纯函数
+// （天气和风向映射、配置校验和、星期计算、SHT40 CRC）在主机上测试和计时，见 test/test_microbench
+static const BenchCase BENCH_CASES[] = {
+  {"weather.parseWeatherResponse", 10, benchParseWeatherResponse},
+  {"weather.getWeatherInfo",       50, benchGetWeatherInfo},
+  {"display.renderTimeDisplay",     1, benchRenderTimeDisplay},
+};
+
+#define BENCH_CASE_COUNT (sizeof(BENCH_CASES) / sizeof(BENCH_CASES[0]))
+
+static void prepareContext(BenchContext& ctx, GDEY029T94* display) {
+  ctx.display = display;
+  ctx.payload = FPSTR(SAMPLE_AMAP_PAYLOAD);
+
+  // 天气数据取自示例响应，解析失败时保持默认值也能渲染
+  ctx.weather.Temperature = 23.0f;
+  ctx.weather.Humidity = 65;
+  ctx.weather.Symbol = 'k';
+  WeatherManager::parseWeatherResponse(ctx.payload, ctx.weather);
+
+  // 24 小时趋势图：三角形起伏，所有列都有数据，按最多的列数绘制
+  int half = SPARKLINE_WIDTH / 2;
+  ctx.series.columns = SPARKLINE_WIDTH;
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) {
+    int16_t value = 2100 + 400 * (half - abs(i - half)) / half;
+    ctx.series.minValue[i] = value - 15;
+    ctx.series.maxValue[i] = value + 15;
+  }
+
+  ctx.time = {25, 6, 15, 12, 34, 0};
+}
+
+// 样本数很少，插入排序即可
+static void sortSamples(uint32_t* samples, int count) {
+  for (int i = 1; i < count; i++) {
+    uint32_t value = samples[i];
+    int j = i - 1;
+    while (j >= 0 && samples[j] > value) {
+      samples[j + 1] = samples[j];
+      j--;
+    }
+    samples[j + 1] = value;
+  }
+}
+
+MicroBench::MicroBench(GDEY029T94* display)
+  : _display(display) {
+}
+
+int MicroBench::getCaseCount() {
+  return BENCH_CASE_COUNT;
+}
+
+int MicroBench::run(Print& out, const String& filter, int repetitions) {
+  repetitions = constrain(repetitions, 1, MICROBENCH_MAX_REPETITIONS);
+
+  DisplayLayoutId savedLayout = _display->getLayout();
+  _display->setLayout(LAYOUT_STANDARD);
+
+  BenchContext* ctx = new BenchContext();
+  prepareContext(*ctx, _display);
+
+  uint32_t cpuMHz = ESP.getCpuFreqMHz();
+  uint32_t samples[MICROBENCH_MAX_REPETITIONS];
+
+  out.println(F(MICROBENCH_BEGIN));
+  out.printf("{\"suite\":\"microbench\",\"sketch_md5\":\"%s\",\"cpu_mhz\":%u,\"warmup\":%d,\"repetitions\":%d,\"results\":[\n",
+             ESP.getSketchMD5().c_str(), cpuMHz, MICROBENCH_WARMUP_REPETITIONS, repetitions);
+
+  int executed = 0;
+  for (size_t i = 0; i < BENCH_CASE_COUNT; i++) {
+    const BenchCase& bench = BENCH_CASES[i];
+    if (filter.length() > 0 && strstr(bench.name, filter.c_str()) == nullptr) {
+      continue;
+    }
+
+    for (int rep = 0; rep < MICROBENCH_WARMUP_REPETITIONS + repetitions; rep++) {
+      uint32_t start = ESP.getCycleCount();
+      for (uint16_t n = 0; n < bench.iterations; n++) {
+        bench.function(*ctx);
+      }
+      uint32_t cycles = ESP.getCycleCount() - start;
+      if (rep >= MICROBENCH_WARMUP_REPETITIONS) {
+        samples[rep - MICROBENCH_WARMUP_REPETITIONS] = (uint64_t)cycles * 1000 / cpuMHz / bench.iterations;
+      }
+      // 轮与轮之间让出CPU，避免触发看门狗，WiFi 处理不计入耗时
+      yield();
+    }
+
+    sortSamples(samples, repetitions);
+    uint32_t median = (repetitions % 2 == 1) ? samples[repetitions / 2]
+                                             : (samples[repetitions / 2 - 1] + samples[repetitions / 2]) / 2;
+    uint32_t p95 = samples[(repetitions * 95 + 99) / 100 - 1];
+
+    out.printf("%s{\"name\":\"%s\",\"iterations\":%u,\"median_ns\":%u,\"p95_ns\":%u,\"min_ns\":%u,\"max_ns\":%u}\n",
+               executed > 0 ? "," : "", bench.name, bench.iterations, median, p95, samples[0], samples[repetitions - 1]);
+    executed++;
+  }
+
+  out.println(F("]}"));
+  out.println(F(MICROBENCH_END));
+
+  delete ctx;
+  _display->setLayout(savedLayout);
+  LOG_INFO_F("MicroBench: %d cases, %d repetitions", executed, repetitions);
+  return executed;
+}
@@ -0,0 +1,40 @@
+#ifndef MICRO_BENCH_H
+#define MICRO_BENCH_H
+
+#include <Arduino.h>
+#include "../GDEY029T94/GDEY029T94.h"
+
+// 基准结果的起止标记，scripts/microbench.py 按这些标记解析串口输出
+#define MICROBENCH_BEGIN "BENCH BEGIN"
+#define MICROBENCH_END "BENCH END"
+
+// 每个用例正式计时前丢弃的轮数（填充缓存、完成首次分配）
+#define MICROBENCH_WARMUP_REPETITIONS 3
+
+// 默认和最大计时轮数
+#define MICROBENCH_DEFAULT_REPETITIONS 21
+#define MICROBENCH_MAX_REPETITIONS 64
+
+/**
+ * 热点函数微基准
+ * 在设备上对依赖 Arduino 的热点函数（高德 JSON 解析、天气信息字符串以及完整的
+ * 时间界面渲染，只绘制到帧缓冲，不刷新屏幕）逐个计时：每个用例先预热若干轮，
+ * 再计时多轮，每轮连续调用固定次数，按 CPU 周期数换算为每次调用的纳秒数，
+ * 输出中位数、p95、最小值和最大值。结果为 JSON，由 scripts/microbench.py 保存并与
+ * 之前的结果比较。不依赖 Arduino 的纯函数在主机上计时（test/test_microbench）
+ */
+class MicroBench {
+public:
+  MicroBench(GDEY029T94* display);
+
+  // 运行基准并输出 JSON，filter 不为空时只运行名称包含 filter 的用例，返回运行的用例数
+  int run(Print& out, const String& filter = "", int repetitions = MICROBENCH_DEFAULT_REPETITIONS);
+
+  // 用例数
+  static int getCaseCount();
+
+private:
+  GDEY029T94* _display;
+};
+
+#endif // MICRO_BENCH_H
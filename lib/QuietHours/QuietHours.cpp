@@ -0,0 +1,118 @@
+#include "QuietHours.h"
+#include "../LogManager/LogManager.h"
+
+// 静默时段记录（含校验和）不能与配置数据或气候历史重叠
+static_assert(sizeof(ConfigData) + 1 <= QUIET_HOURS_CONFIG_ADDRESS, "Quiet hours record overlaps ConfigData");
+static_assert(QUIET_HOURS_CONFIG_ADDRESS + sizeof(QuietHoursConfig) + 1 <= 512, "Quiet hours record overlaps climate history");
+
+QuietHours::QuietHours(int address)
+  : _store(address) {
+  memset(&_config, 0, sizeof(_config));
+}
+
+void QuietHours::begin(const char* defaultSpec) {
+  // EEPROM 中的设置优先，未设置时使用默认时段
+  if (_store.isValid() && _store.read(_config) && _config.configured) {
+    LOG_INFO_F("Quiet hours: %s", format().c_str());
+    return;
+  }
+
+  memset(&_config, 0, sizeof(_config));
+  if (defaultSpec != nullptr && defaultSpec[0] != '\0' && !parse(defaultSpec, _config)) {
+    LOG_WARN_F("Invalid default quiet hours '%s'", defaultSpec);
+    memset(&_config, 0, sizeof(_config));
+  }
+  _config.configured = 0;
+  LOG_INFO_F("Quiet hours (default): %s", format().c_str());
+}
+
+bool QuietHours::isEnabled() const {
+  return _config.enabled != 0;
+}
+
+bool QuietHours::isQuiet(uint8_t hour, uint8_t minute) const {
+  if (!_config.enabled) {
+    return false;
+  }
+
+  uint16_t now = hour * 60 + minute;
+  uint16_t start = _config.startHour * 60 + _config.startMinute;
+  uint16_t end = _config.endHour * 60 + _config.endMinute;
+  if (start < end) {
+    return now >= start && now < end;
+  }
+  return now >= start || now < end;  // 跨午夜
+}
+
+uint8_t QuietHours::getEndHour() const {
+  return _config.endHour;
+}
+
+uint8_t QuietHours::getEndMinute() const {
+  return _config.endMinute;
+}
+
+uint16_t QuietHours::minutesUntilEnd(uint8_t hour, uint8_t minute) const {
+  int16_t minutes = (_config.endHour * 60 + _config.endMinute) - (hour * 60 + minute);
+  if (minutes <= 0) {
+    minutes += 1440;
+  }
+  return minutes;
+}
+
+String QuietHours::format() const {
+  if (!_config.enabled) {
+    return "off";
+  }
+
+  char buffer[12];
+  snprintf(buffer, sizeof(buffer), "%02u:%02u-%02u:%02u",
+           _config.startHour, _config.startMinute, _config.endHour, _config.endMinute);
+  return String(buffer);
+}
+
+bool QuietHours::set(const String& spec) {
+  QuietHoursConfig config;
+  if (!parse(spec, config)) {
+    return false;
+  }
+
+  config.configured = 1;
+  if (!_store.write(config)) {
+    return false;
+  }
+
+  _config = config;
+  LOG_INFO_F("Quiet hours set to %s", format().c_str());
+  return true;
+}
+
+bool QuietHours::parse(const String& spec, QuietHoursConfig& config) {
+  memset(&config, 0, sizeof(config));
+
+  String value = spec;
+  value.trim();
+  value.toLowerCase();
+  if (value == "off" || value.length() == 0) {
+    return true;
+  }
+
+  unsigned int startHour, startMinute, endHour, endMinute;
+  char tail;
+  if (sscanf(value.c_str(), "%u:%u-%u:%u%c", &startHour, &startMinute, &endHour, &endMinute, &tail) != 4) {
+    return false;
+  }
+  if (startHour > 23 || endHour > 23 || startMinute > 59 || endMinute > 59) {
+    return false;
+  }
+  if (startHour == endHour && startMinute == endMinute) {
+    return false;
+  }
+
+  config.enabled = 1;
+  config.startHour = startHour;
+  config.startMinute = startMinute;
+  config.endHour = endHour;
+  config.endMinute = endMinute;
+  return true;
+}
@@ -0,0 +1,71 @@
+#ifndef QUIET_HOURS_H
+#define QUIET_HOURS_H
+
+#include <Arduino.h>
+#include "../ConfigManager/ConfigManager.h"
+
+// 静默时段配置在 EEPROM 中的地址：ConfigData 之后、气候历史（512）之前的独立记录，
+// 不修改 ConfigData 的布局，已保存的 WiFi 和 API 配置不受影响
+#define QUIET_HOURS_CONFIG_ADDRESS 256
+
+// 静默时段配置（EEPROM 存储）
+struct QuietHoursConfig {
+  uint8_t configured;   // 是否通过串口或网页设置过（否则使用 config.h 中的默认值）
+  uint8_t enabled;      // 是否启用
+  uint8_t startHour;    // 开始时间
+  uint8_t startMinute;
+  uint8_t endHour;      // 结束时间（恢复正常刷新）
+  uint8_t endMinute;
+  uint8_t reserved[2];
+};
+
+/**
+ * 夜间静默时段
+ * 时段 [start, end) 内设备显示静态的休眠画面，用 BM8563 分钟定时器分段（每段最长 255 分钟）睡到结束时间，
+ * 不再每分钟唤醒。时段可以跨午夜，格式为 "HH:MM-HH:MM"，"off" 表示关闭
+ */
+class QuietHours {
+public:
+  QuietHours(int address = QUIET_HOURS_CONFIG_ADDRESS);
+
+  /**
+   * 读取静默时段配置
+   * @param defaultSpec EEPROM 中没有设置时使用的默认时段（如 config.h 中的 DEFAULT_QUIET_HOURS）
+   */
+  void begin(const char* defaultSpec = "");
+
+  // 是否启用
+  bool isEnabled() const;
+
+  // 指定时间是否在静默时段内
+  bool isQuiet(uint8_t hour, uint8_t minute) const;
+
+  // 静默结束时间
+  uint8_t getEndHour() const;
+  uint8_t getEndMinute() const;
+
+  // 距离静默结束的分钟数（1-1440）
+  uint16_t minutesUntilEnd(uint8_t hour, uint8_t minute) const;
+
+  // 格式化为 "HH:MM-HH:MM" 或 "off"
+  String format() const;
+
+  /**
+   * 解析并保存新的静默时段
+   * @param spec "HH:MM-HH:MM" 或 "off"
+   * @return 格式有效且保存成功
+   */
+  bool set(const String& spec);
+
+  /**
+   * 解析静默时段
+   * @return 格式是否有效（开始和结束相同视为无效）
+   */
+  static bool parse(const String& spec, QuietHoursConfig& config);
+
+private:
+  ConfigManager<QuietHoursConfig> _store;
+  QuietHoursConfig _config;
+};
+
+#endif // QUIET_HOURS_H
@@ -0,0 +1,89 @@
+#ifndef RTC_MEMORY_H
+#define RTC_MEMORY_H
+
+#include <Arduino.h>
+#include <coredecls.h>
+
+// ==================== RTC 用户内存分区 ====================
+// ESP8266 RTC 用户内存共 512 字节（128 个 4 字节块），深度睡眠期间保持不丢失
+// 偏移量以块为单位，每个区域末尾额外占用 1 块存放 CRC32
+
+// 0-31 块（前 128 字节）保留给 OTA 更新（eboot 命令），不可使用
+#define RTC_BLOCK_RESERVED_END      32
+
+// 室内气候历史：待写入 Flash 的样本批次（18 块，32-49）
+#define RTC_BLOCK_CLIMATE_HISTORY   32
+
+// 墨水屏刷新调度：内容指纹、各区域指纹和残影计数（18 块，50-67）
+#define RTC_BLOCK_DISPLAY_REFRESH   50
+
+// 唤醒调度：局部刷新和全刷各自学习到的唤醒到刷新完成耗时（3 块，68-70）
+#define RTC_BLOCK_WAKE_SCHEDULER    68
+
+// 二进制日志环：格式字符串地址、参数和时间戳（36 块，71-106）
+#define RTC_BLOCK_LOG_RING          71
+
+// 运行指标：计数器、仪表和直方图（21 块，107-127）
+#define RTC_BLOCK_METRICS           107
+
+/**
+ * RTC 用户内存读写工具
+ * 数据按 4 字节块存储并附带 CRC32 校验，冷启动后的随机内容会被识别为无效
+ */
+class RTCMemory {
+public:
+  /**
+   * 从 RTC 内存读取数据
+   * @param block 起始块偏移
+   * @param data 输出参数，读取的数据
+   * @return 是否读取成功且校验通过
+   */
+  template<typename T>
+  static bool read(uint32_t block, T& data);
+  
+  /**
+   * 将数据写入 RTC 内存
+   * @param block 起始块偏移
+   * @param data 要写入的数据
+   * @return 是否写入成功
+   */
+  template<typename T>
+  static bool write(uint32_t block, const T& data);
+  
+  /**
+   * 获取数据占用的块数（包含 CRC）
+   */
+  template<typename T>
+  static constexpr uint32_t blocks() {
+    return (sizeof(T) + 3) / 4 + 1;
+  }
+};
+
+template<typename T>
+bool RTCMemory::read(uint32_t block, T& data) {
+  uint32_t words[blocks<T>()];
+  if (!ESP.rtcUserMemoryRead(block, words, sizeof(words))) {
+    return false;
+  }
+  
+  const size_t dataWords = blocks<T>() - 1;
+  if (crc32(words, dataWords * 4) != words[dataWords]) {
+    return false;
+  }
+  
+  memcpy(&data, words, sizeof(T));
+  return true;
+}
+
+template<typename T>
+bool RTCMemory::write(uint32_t block, const T& data) {
+  uint32_t words[blocks<T>()] = {};
+  memcpy(words, &data, sizeof(T));
+  
+  const size_t dataWords = blocks<T>() - 1;
+  words[dataWords] = crc32(words, dataWords * 4);
+  
+  return ESP.rtcUserMemoryWrite(block, words, sizeof(words));
+}
+
+#endif // RTC_MEMORY_H
@@ -1,16 +1,17 @@
 #include "SHT40.h"
+#include "SHT40Crc.h"
 
 SHT40::SHT40(uint8_t sda_pin, uint8_t scl_pin, uint8_t addr) 
-    : _addr(addr), _sda_pin(sda_pin), _scl_pin(scl_pin) {
+    : _addr(addr), _sda_pin(sda_pin), _scl_pin(scl_pin),
+      _pending(false), _precision(SHT40_PRECISION_HIGH), _startMicros(0) {
 }
 
 bool SHT40::begin() {
-    // 初始化I2C
-    Wire.begin(_sda_pin, _scl_pin);
+    // 初始化I2C（与 RTC 共用总线，已初始化时不重复初始化）
+    I2CBus::begin(_sda_pin, _scl_pin);
     
     // 检查传感器是否响应
-    Wire.beginTransmission(_addr);
-    if (Wire.endTransmission() != 0) {
+    if (!I2CBus::probe(_addr)) {
         return false;
     }
     
@@ -19,18 +20,55 @@ bool SHT40::begin() {
 }
 
 bool SHT40::readTemperatureHumidity(float &temperature, float &humidity) {
-    // 发送高精度测量命令
-    if (!sendCommand(MEAS_HIGHREP)) {
+    return startMeasurement(SHT40_PRECISION_HIGH) && collectMeasurement(temperature, humidity);
+}
+
+bool SHT40::startMeasurement(SHT40Precision precision) {
+    static const uint8_t commands[] = {MEAS_HIGHREP, MEAS_MEDREP, MEAS_LOWREP};
+    
+    _pending = false;
+    if (precision > SHT40_PRECISION_LOW) {
+        precision = SHT40_PRECISION_HIGH;
+    }
+    if (!sendCommand(commands[precision])) {
         return false;
     }
     
-    // 等待测量完成（高精度测量约8.2ms）
-    delay(10);
+    _pending = true;
+    _precision = precision;
+    _startMicros = micros();
+    return true;
+}
+
+bool SHT40::isMeasurementPending() const {
+    return _pending;
+}
+
+bool SHT40::isMeasurementReady() const {
+    return _pending && micros() - _startMicros >= getMeasurementMicros(_precision);
+}
+
+bool SHT40::collectMeasurement(float &temperature, float &humidity) {
+    if (!_pending) {
+        return false;
+    }
+    
+    // 等待测量完成（启动后已经过去的时间通常早已超过测量时间）
+    unsigned long elapsed = micros() - _startMicros;
+    uint16_t duration = getMeasurementMicros(_precision);
+    if (elapsed < duration) {
+        delay((duration - elapsed + 999) / 1000);
+    }
+    _pending = false;
     
     // 读取6字节数据：温度(2字节) + CRC(1字节) + 湿度(2字节) + CRC(1字节)
+    // 测量未完成时传感器不应答，稍等后重试一次
     uint8_t data[6];
     if (!readData(data, 6)) {
-        return false;
+        delay(1);
+        if (!readData(data, 6)) {
+            return false;
+        }
     }
     
     // 检查CRC校验
@@ -48,6 +86,18 @@ bool SHT40::readTemperatureHumidity(float &temperature, float &humidity) {
     return true;
 }
 
+uint16_t SHT40::getMeasurementMicros(SHT40Precision precision) {
+    // 数据手册给出的最长测量时间
+    switch (precision) {
+        case SHT40_PRECISION_MEDIUM:
+            return 4500;
+        case SHT40_PRECISION_LOW:
+            return 1700;
+        default:
+            return 8300;
+    }
+}
+
 float SHT40::readTemperature() {
     float temperature, humidity;
     if (readTemperatureHumidity(temperature, humidity)) {
@@ -69,8 +119,8 @@ bool SHT40::softReset() {
         return false;
     }
     
-    // 等待复位完成
-    delay(10);
+    // 等待复位完成（数据手册最长 1ms）
+    delay(1);
     
     return true;
 }
@@ -103,46 +153,22 @@ bool SHT40::readSerialNumber(uint32_t &serialNumber) {
 }
 
 bool SHT40::sendCommand(uint8_t command) {
-    Wire.beginTransmission(_addr);
-    Wire.write(command);
-    return Wire.endTransmission() == 0;
+    return I2CBus::write(_addr, &command, 1);
 }
 
 bool SHT40::sendCommand(uint16_t command) {
-    Wire.beginTransmission(_addr);
-    Wire.write(command >> 8);   // 高字节
-    Wire.write(command & 0xFF); // 低字节
-    return Wire.endTransmission() == 0;
+    uint8_t bytes[2];
+    bytes[0] = command >> 8;    // 高字节
+    bytes[1] = command & 0xFF;  // 低字节
+    return I2CBus::write(_addr, bytes, 2);
 }
 
 bool SHT40::readData(uint8_t *data, uint8_t length) {
-    Wire.requestFrom(_addr, length);
-    if (Wire.available() != length) {
-        return false;
-    }
-    
-    for (uint8_t i = 0; i < length; i++) {
-        data[i] = Wire.read();
-    }
-    
-    return true;
+    return I2CBus::read(_addr, data, length);
 }
 
 uint8_t SHT40::crc8(const uint8_t *data, uint8_t len) {
-    uint8_t crc = 0xFF; // 初始化值
-    
-    for (uint8_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        for (uint8_t bit = 8; bit > 0; --bit) {
-            if (crc & 0x80) {
-                crc = (crc << 1) ^ 0x31;
-            } else {
-                crc = (crc << 1);
-            }
-        }
-    }
-    
-    return crc;
+    return SHT40Crc::compute(data, len);
 }
 
 void SHT40::convertRawData(uint16_t rawTemperature, uint16_t rawHumidity, float &temperature, float &humidity) {
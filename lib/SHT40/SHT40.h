@@ -2,7 +2,14 @@
 #define SHT40_H
 
 #include <Arduino.h>
-#include <Wire.h>
+#include "../I2CBus/I2CBus.h"
+
+// 测量精度（重复性），精度越低测量时间越短
+enum SHT40Precision : uint8_t {
+    SHT40_PRECISION_HIGH = 0,    // 高精度，约 8.3ms
+    SHT40_PRECISION_MEDIUM = 1,  // 中精度，约 4.5ms
+    SHT40_PRECISION_LOW = 2      // 低精度，约 1.7ms
+};
 
 class SHT40 {
 public:
@@ -27,9 +34,24 @@ public:
     // 初始化传感器
     bool begin();
     
-    // 读取温湿度数据
+    // 读取温湿度数据（高精度，阻塞等待测量完成）
     bool readTemperatureHumidity(float &temperature, float &humidity);
     
+    // 发送测量命令后立即返回，测量在传感器内部进行
+    bool startMeasurement(SHT40Precision precision = SHT40_PRECISION_HIGH);
+    
+    // 是否有已开始但尚未读取的测量
+    bool isMeasurementPending() const;
+    
+    // 已开始的测量是否已经完成（可以不等待直接读取）
+    bool isMeasurementReady() const;
+    
+    // 读取已开始的测量结果，测量未完成时等待剩余时间
+    bool collectMeasurement(float &temperature, float &humidity);
+    
+    // 指定精度的最长测量时间（微秒）
+    static uint16_t getMeasurementMicros(SHT40Precision precision);
+    
     // 读取温度（摄氏度）
     float readTemperature();
     
@@ -47,6 +69,11 @@ private:
     uint8_t _sda_pin;
     uint8_t _scl_pin;
     
+    // 进行中的测量
+    bool _pending;
+    SHT40Precision _precision;
+    unsigned long _startMicros;
+    
     // 发送命令并等待测量完成
     bool sendCommand(uint8_t command);
     bool sendCommand(uint16_t command);
@@ -0,0 +1,18 @@
+#include "SHT40Crc.h"
+
+uint8_t SHT40Crc::compute(const uint8_t *data, uint8_t len) {
+    uint8_t crc = 0xFF; // 初始化值
+    
+    for (uint8_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 8; bit > 0; --bit) {
+            if (crc & 0x80) {
+                crc = (crc << 1) ^ 0x31;
+            } else {
+                crc = (crc << 1);
+            }
+        }
+    }
+    
+    return crc;
+}
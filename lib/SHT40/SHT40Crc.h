@@ -0,0 +1,16 @@
+#ifndef SHT40_CRC_H
+#define SHT40_CRC_H
+
+#include <stdint.h>
+
+/**
+ * SHT40 数据帧的 CRC-8（多项式 0x31，初始值 0xFF）
+ * 不依赖 Arduino，可在主机上编译测试（test/test_microbench）
+ */
+class SHT40Crc {
+public:
+    // 计算 data 的 CRC，例如 0xBE 0xEF 的校验值为 0x92
+    static uint8_t compute(const uint8_t *data, uint8_t len);
+};
+
+#endif // SHT40_CRC_H
@@ -0,0 +1,96 @@
+#include "CommandLine.h"
+#include <string.h>
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+CommandLine::CommandLine() {
+    reset();
+}
+
+bool CommandLine::feed(char c) {
+    // 上一行已交给调用方，开始新的一行
+    if (_complete) {
+        _length = 0;
+        _overflow = false;
+        _complete = false;
+    }
+
+    bool afterCR = _lastWasCR;
+    _lastWasCR = (c == '\r');
+
+    if (c == '\r' || c == '\n') {
+        if (c == '\n' && afterCR) {
+            return false;
+        }
+        _buffer[_length] = '\0';
+        _complete = true;
+        return true;
+    }
+
+    if (c == '\b' || c == 0x7F) {
+        if (_length > 0 && !_overflow) {
+            _length--;
+        }
+        return false;
+    }
+
+    if ((uint8_t)c < 0x20) {
+        return false;
+    }
+
+    if (_length >= sizeof(_buffer) - 1) {
+        _overflow = true;
+        return false;
+    }
+    if (!_overflow) {
+        _buffer[_length++] = c;
+    }
+    return false;
+}
+
+char* CommandLine::line() {
+    char* cursor = _buffer;
+    return rest(cursor);
+}
+
+bool CommandLine::overflowed() const {
+    return _overflow;
+}
+
+void CommandLine::reset() {
+    _length = 0;
+    _buffer[0] = '\0';
+    _complete = false;
+    _overflow = false;
+    _lastWasCR = false;
+}
+
+char* CommandLine::nextToken(char*& cursor) {
+    while (isSpace(*cursor)) {
+        cursor++;
+    }
+    char* token = cursor;
+    while (*cursor != '\0' && !isSpace(*cursor)) {
+        cursor++;
+    }
+    if (*cursor != '\0') {
+        *cursor++ = '\0';
+    }
+    return token;
+}
+
+char* CommandLine::rest(char*& cursor) {
+    while (isSpace(*cursor)) {
+        cursor++;
+    }
+    char* start = cursor;
+    char* end = start + strlen(start);
+    while (end > start && isSpace(end[-1])) {
+        end--;
+    }
+    *end = '\0';
+    cursor = end;
+    return start;
+}
@@ -0,0 +1,63 @@
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+// 只依赖 C 标准库，可在主机上编译测试（test/test_command_line）
+#include <stddef.h>
+#include <stdint.h>
+
+// 命令行缓冲区大小（含结尾的 '\0'），最长的命令为 set apikey <63 个字符>
+#define SERIAL_COMMAND_LINE_SIZE 128
+
+/**
+ * @brief 固定缓冲区的命令行状态机
+ *
+ * 逐字节输入，一行可以跨多次调用到达，不依赖字节之间的时间间隔，不分配内存：
+ * - CR、LF、CRLF 都作为一行结束（CRLF 只算一次）
+ * - 退格（BS 或 DEL）删除上一个字符
+ * - 其他控制字符忽略
+ * - 超长的行整行丢弃，行结束时报告溢出
+ * 完整的一行在缓冲区中原地切分为命令和参数
+ */
+class CommandLine {
+public:
+    CommandLine();
+
+    /**
+     * @brief 输入一个字节
+     * @param c 收到的字节
+     * @return true 如果一行已完整（通过 line() 读取，下次输入时自动清空）
+     */
+    bool feed(char c);
+
+    // 当前完整的一行（去除首尾空白）
+    char* line();
+
+    // 当前行是否因超长被丢弃
+    bool overflowed() const;
+
+    // 清空缓冲区
+    void reset();
+
+    /**
+     * @brief 原地取出下一个以空白分隔的词，并在词尾写入 '\0'
+     * @param cursor 当前位置，返回后指向剩余部分
+     * @return 词的起始位置，没有更多词时返回空字符串
+     */
+    static char* nextToken(char*& cursor);
+
+    /**
+     * @brief 取出剩余部分（去除首尾空白，中间的空白保留，例如带空格的 WiFi 名称）
+     * @param cursor 当前位置，返回后指向字符串末尾
+     * @return 剩余部分，没有时返回空字符串
+     */
+    static char* rest(char*& cursor);
+
+private:
+    char _buffer[SERIAL_COMMAND_LINE_SIZE];
+    size_t _length;
+    bool _complete;      // 上一次 feed() 返回了完整的行
+    bool _overflow;      // 当前行超长
+    bool _lastWasCR;     // 上一个字节是 CR，紧随的 LF 不再结束一行
+};
+
+#endif // COMMAND_LINE_H
@@ -7,7 +7,7 @@
  * @param configMgr 配置管理器指针
  */
 SerialConfigManager::SerialConfigManager(ConfigManager<ConfigData>* configMgr) 
-    : configManager(configMgr), isConfigMode(false) {
+    : configManager(configMgr), quietHours(nullptr), deviceSettings(nullptr), isConfigMode(false), extraCommandCount(0) {
 }
 
 /**
@@ -79,88 +79,131 @@ void SerialConfigManager::printPrompt() {
 
 /**
  * @brief 处理串口输入
- * 检查是否有串口数据可用并处理命令
- * @return true 如果处理了命令，false 如果没有数据
+ * 读取所有可用的字节（不等待），一行可以跨多次调用到达，每收到完整的一行执行一次命令
+ * @return true 如果收到了数据，false 如果没有数据
  */
 bool SerialConfigManager::processInput() {
     if (!isConfigMode) {
         return false;
     }
     
-    int available = Serial.available();
-    if (available > 0) {
-        LOG_INFO_F("Serial data available: %d bytes, processing command...", available);
-        
-        // 等待完整的命令行输入
-        String command = "";
-        while (Serial.available() > 0) {
-            char c = Serial.read();
-            if (c == '\n' || c == '\r') {
-                break;
-            }
-            command += c;
-            delay(1); // 短暂延时，确保接收完整
+    bool received = false;
+    while (Serial.available() > 0) {
+        received = true;
+        if (!commandLine.feed((char)Serial.read())) {
+            continue;
         }
         
-        // 清除剩余的换行符
-        while (Serial.available() > 0 && (Serial.peek() == '\n' || Serial.peek() == '\r')) {
-            Serial.read();
-        }
-        
-        command.trim(); // 去除首尾空白字符
-        
-        // 调试输出
-        Serial.println(F("Received command: '") + command + F("' (length: ") + String(command.length()) + F(")"));
-        if (command.length() > 0) {
-            parseAndExecuteCommand(command);
+        if (commandLine.overflowed()) {
+            Serial.printf_P(PSTR("Command too long (max %u characters)\n"), (unsigned)(SERIAL_COMMAND_LINE_SIZE - 1));
+        } else {
+            char* line = commandLine.line();
+            // 调试输出
+            Serial.printf_P(PSTR("Received command: '%s' (length: %u)\n"), line, (unsigned)strlen(line));
+            if (*line != '\0') {
+                executeLine(line);
+            }
         }
-        
         printPrompt();
-        return true;
     }
     
-    return false;
+    return received;
+}
+
+// 内置命令处理函数，args 为命令后的参数（原地切分，去除首尾空白）
+typedef void (*BuiltinHandler)(SerialConfigManager& manager, char* args);
+
+static void commandShow(SerialConfigManager& manager, char*) {
+    manager.showConfig();
+}
+
+static void commandSet(SerialConfigManager& manager, char* args) {
+    // set key value，value 中可以包含空格
+    char* key = CommandLine::nextToken(args);
+    char* value = CommandLine::rest(args);
+    if (*key == '\0' || *value == '\0') {
+        Serial.println(F("Usage: set <key> <value>"));
+        Serial.println(F("Keys: ssid, password, apikey, citycode, mac, quiet, log, otapass"));
+        return;
+    }
+    manager.setConfig(key, value);
+}
+
+static void commandClear(SerialConfigManager& manager, char*) {
+    manager.clearConfig();
+}
+
+static void commandStats(SerialConfigManager&, char* args) {
+    // 运行指标保存在 RTC 内存中，不依赖 EEPROM 配置
+    if (strcmp(args, "reset") == 0) {
+        Metrics::reset();
+        Serial.println(F("Metrics reset"));
+    } else {
+        Metrics::print(Serial);
+    }
+}
+
+static void commandHelp(SerialConfigManager& manager, char*) {
+    manager.showHelp();
+}
+
+static void commandExit(SerialConfigManager& manager, char*) {
+    manager.exitConfigMode();
 }
 
+// 内置命令表（位于 Flash，逐条拷贝后使用）：命令名、用法、说明和处理函数
+struct BuiltinCommand {
+    char name[8];
+    char usage[24];
+    char description[48];
+    BuiltinHandler handler;
+};
+
+static const BuiltinCommand BUILTIN_COMMANDS[] PROGMEM = {
+    {"show", "show", "Display current configuration", commandShow},
+    {"set", "set <key> <value>", "Set and save configuration value", commandSet},
+    {"clear", "clear", "Clear all configuration", commandClear},
+    {"stats", "stats [reset]", "Show or reset runtime metrics", commandStats},
+    {"help", "help", "Show this help message", commandHelp},
+    {"exit", "exit", "Exit configuration mode (restart system)", commandExit},
+};
+
+static_assert(sizeof(BuiltinCommand) % 4 == 0, "BuiltinCommand must be word aligned for PROGMEM reads");
+
+#define BUILTIN_COMMAND_COUNT (sizeof(BUILTIN_COMMANDS) / sizeof(BUILTIN_COMMANDS[0]))
+
 /**
- * @brief 解析并执行命令
- * @param command 完整的命令字符串
+ * @brief 解析并执行一行命令
+ * 命令名不区分大小写，内置命令优先于扩展命令
+ * @param line 完整的命令行（原地切分）
  */
-void SerialConfigManager::parseAndExecuteCommand(const String& command) {
-    // 解析命令和参数
-    int spaceIndex = command.indexOf(' ');
-    String cmd = (spaceIndex > 0) ? command.substring(0, spaceIndex) : command;
-    String args = (spaceIndex > 0) ? command.substring(spaceIndex + 1) : "";
-    
-    cmd.toLowerCase();
+void SerialConfigManager::executeLine(char* line) {
+    char* cursor = line;
+    char* cmd = CommandLine::nextToken(cursor);
+    char* args = CommandLine::rest(cursor);
     
     // 调试输出
-    Serial.println(F("Parsed command: '") + cmd + F("', args: '") + args + F("'"));
+    Serial.printf_P(PSTR("Parsed command: '%s', args: '%s'\n"), cmd, args);
     
-    // 执行命令
-    if (cmd == "show") {
-        showConfig();
-    } else if (cmd == "set") {
-        // 解析 set 命令的参数：set key value
-        int argSpaceIndex = args.indexOf(' ');
-        if (argSpaceIndex > 0) {
-            String key = args.substring(0, argSpaceIndex);
-            String value = args.substring(argSpaceIndex + 1);
-            setConfig(key, value);
-        } else {
-            Serial.println(F("Usage: set <key> <value>"));
-            Serial.println(F("Keys: ssid, password, apikey, citycode, mac"));
+    for (size_t i = 0; i < BUILTIN_COMMAND_COUNT; i++) {
+        BuiltinCommand command;
+        memcpy_P(&command, &BUILTIN_COMMANDS[i], sizeof(command));
+        if (strcasecmp(cmd, command.name) == 0) {
+            command.handler(*this, args);
+            return;
         }
-    } else if (cmd == "clear") {
-        clearConfig();
-    } else if (cmd == "help") {
-        showHelp();
-    } else if (cmd == "exit") {
-        exitConfigMode();
-    } else {
-        Serial.println(F("Unknown command: '") + cmd + F("'"));
-        Serial.println(F("Type 'help' for available commands"));
     }
+    
+    // 查找扩展命令
+    for (int i = 0; i < extraCommandCount; i++) {
+        if (strcasecmp(cmd, extraCommands[i].name) == 0) {
+            extraCommands[i].handler(args);
+            return;
+        }
+    }
+    
+    Serial.printf_P(PSTR("Unknown command: '%s'\n"), cmd);
+    Serial.println(F("Type 'help' for available commands"));
 }
 
 /**
@@ -176,7 +219,9 @@ bool SerialConfigManager::isValidConfigKey(const String& key) {
             lowerKey == "password" || 
             lowerKey == "apikey" || 
             lowerKey == "citycode" || 
-            lowerKey == "mac");
+            lowerKey == "mac" ||
+            (lowerKey == "quiet" && quietHours != nullptr) ||
+            ((lowerKey == "log" || lowerKey == "otapass") && deviceSettings != nullptr));
 }
 
 /**
@@ -195,6 +240,14 @@ void SerialConfigManager::showConfig() {
     } else {
         Serial.println(F("No valid configuration found or failed to read"));
     }
+    if (quietHours != nullptr) {
+        Serial.println(F("Quiet Hours: ") + quietHours->format());
+    }
+    if (deviceSettings != nullptr) {
+        Serial.println(F("Log Output: ") + String(DeviceSettings::formatLogOutput(deviceSettings->getLogOutput())));
+        // 只显示是否设置，不回显密码
+        Serial.println(deviceSettings->isUpdateEnabled() ? F("Update Password: (set)") : F("Update Password: off (firmware update disabled)"));
+    }
     
     Serial.println(F("============================="));
 }
@@ -210,10 +263,46 @@ bool SerialConfigManager::setConfig(const String& key, const String& value) {
     
     if (!isValidConfigKey(lowerKey)) {
         Serial.println(F("Invalid key: ") + key);
-        Serial.println(F("Valid keys: ssid, password, apikey, citycode, mac"));
+        Serial.println(F("Valid keys: ssid, password, apikey, citycode, mac, quiet, log, otapass"));
         return false;
     }
     
+    // 静默时段保存在独立的 EEPROM 记录中
+    if (lowerKey == "quiet") {
+        if (!quietHours->set(value)) {
+            Serial.println(F("Invalid quiet hours: ") + value);
+            Serial.println(F("Format: HH:MM-HH:MM or off"));
+            return false;
+        }
+        Serial.println(F("Set quiet = ") + quietHours->format());
+        Serial.println(F("Configuration saved successfully"));
+        return true;
+    }
+    
+    // 日志输出保存在设备运行设置中，下次正常唤醒生效
+    if (lowerKey == "log") {
+        if (!deviceSettings->setLogOutput(value)) {
+            Serial.println(F("Invalid log output: ") + value);
+            Serial.println(F("Format: serial, rtc or off"));
+            return false;
+        }
+        Serial.println(F("Set log = ") + String(DeviceSettings::formatLogOutput(deviceSettings->getLogOutput())));
+        Serial.println(F("Configuration saved successfully"));
+        return true;
+    }
+    
+    // 固件更新密码保存在设备运行设置中，立即生效
+    if (lowerKey == "otapass") {
+        if (!deviceSettings->setUpdatePassword(value)) {
+            Serial.println(F("Invalid update password"));
+            Serial.println(F("Format: 8-31 printable characters without spaces, or off"));
+            return false;
+        }
+        Serial.println(deviceSettings->isUpdateEnabled() ? F("Set otapass = (set)") : F("Set otapass = off"));
+        Serial.println(F("Configuration saved successfully"));
+        return true;
+    }
+    
     ConfigData config;
     // 尝试读取现有配置，如果失败则使用默认值
     if (!configManager->read(config)) {
@@ -287,12 +376,17 @@ bool SerialConfigManager::clearConfig() {
  */
 void SerialConfigManager::showHelp() {
     Serial.println(F("=== Available Commands ==="));
-    Serial.println(F("show                    - Display current configuration"));
-    Serial.println(F("set <key> <value>       - Set and save configuration value"));
-    Serial.println(F("  Keys: ssid, password, apikey, citycode, mac"));
-    Serial.println(F("clear                   - Clear all configuration"));
-    Serial.println(F("help                    - Show this help message"));
-    Serial.println(F("exit                    - Exit configuration mode (restart system)"));
+    for (size_t i = 0; i < BUILTIN_COMMAND_COUNT; i++) {
+        BuiltinCommand command;
+        memcpy_P(&command, &BUILTIN_COMMANDS[i], sizeof(command));
+        Serial.printf_P(PSTR("%-23s - %s\n"), command.usage, command.description);
+        if (command.handler == commandSet) {
+            Serial.println(F("  Keys: ssid, password, apikey, citycode, mac, quiet, log, otapass"));
+        }
+    }
+    for (int i = 0; i < extraCommandCount; i++) {
+        Serial.printf("%-23s - %s\n", extraCommands[i].name, extraCommands[i].description);
+    }
     Serial.println(F("=========================="));
     Serial.println();
     Serial.println(F("Examples:"));
@@ -301,6 +395,45 @@ void SerialConfigManager::showHelp() {
     Serial.println(F("  set apikey your_amap_api_key"));
     Serial.println(F("  set citycode 110108"));
     Serial.println(F("  set mac AA:BB:CC:DD:EE:FF"));
+    Serial.println(F("  set quiet 23:00-07:00"));
+    Serial.println(F("  set log off"));
+    Serial.println(F("  set otapass myUpdatePassword"));
+}
+
+/**
+ * @brief 设置夜间静默时段，启用 quiet 配置项
+ * @param quiet 静默时段指针
+ */
+void SerialConfigManager::setQuietHours(QuietHours* quiet) {
+    quietHours = quiet;
+}
+
+/**
+ * @brief 设置设备运行设置，启用 log 和 otapass 配置项
+ * @param settings 设备运行设置指针
+ */
+void SerialConfigManager::setDeviceSettings(DeviceSettings* settings) {
+    deviceSettings = settings;
+}
+
+/**
+ * @brief 注册扩展命令
+ * @param name 命令名（匹配时不区分大小写）
+ * @param description 帮助说明
+ * @param handler 命令处理函数
+ * @return true 如果注册成功，false 如果命令表已满
+ */
+bool SerialConfigManager::addCommand(const char* name, const char* description, CommandHandler handler) {
+    if (extraCommandCount >= MAX_EXTRA_COMMANDS) {
+        LOG_WARN_F("Command table full, '%s' not registered", name);
+        return false;
+    }
+    
+    extraCommands[extraCommandCount].name = name;
+    extraCommands[extraCommandCount].description = description;
+    extraCommands[extraCommandCount].handler = handler;
+    extraCommandCount++;
+    return true;
 }
 
 /**
@@ -2,26 +2,49 @@
 #define SERIAL_CONFIG_MANAGER_H
 
 #include <Arduino.h>
+#include <functional>
 #include "../../config.h"
 #include "../ConfigManager/ConfigManager.h"
+#include "../QuietHours/QuietHours.h"
+#include "../DeviceSettings/DeviceSettings.h"
+#include "../Metrics/Metrics.h"
+#include "CommandLine.h"
 
 /**
  * @brief 串口配置管理类
  * 
  * 负责处理通过串口进行的设备配置功能，包括：
  * - 串口初始化和重新配置
- * - 串口命令解析和处理
+ * - 串口命令解析和处理（固定缓冲区逐字节解析，内置命令表位于 Flash）
  * - 配置参数的显示、设置和清除
  * - 配置模式的进入和退出
  */
 class SerialConfigManager {
+public:
+    // 扩展命令处理函数，参数为命令后的参数字符串（去除首尾空白，指向命令行缓冲区，只在调用期间有效）
+    typedef std::function<void(const char* args)> CommandHandler;
+    
 private:
+    // 扩展命令
+    struct ExtraCommand {
+        const char* name;
+        const char* description;
+        CommandHandler handler;
+    };
+    
+    static const int MAX_EXTRA_COMMANDS = 8;
+    
     ConfigManager<ConfigData>* configManager;  // 配置管理器指针
+    QuietHours* quietHours;                    // 夜间静默时段（可选）
+    DeviceSettings* deviceSettings;            // 设备运行设置（可选）
     bool isConfigMode;                         // 是否处于配置模式
+    ExtraCommand extraCommands[MAX_EXTRA_COMMANDS];  // 扩展命令表
+    int extraCommandCount;                     // 已注册的扩展命令数
+    CommandLine commandLine;                   // 串口命令行缓冲区
     
     // 私有方法
     void showWelcomeMessage();
-    void parseAndExecuteCommand(const String& command);
+    void executeLine(char* line);
     bool isValidConfigKey(const String& key);
     void printPrompt();
     
@@ -57,8 +80,8 @@ public:
     
     /**
      * @brief 处理串口输入
-     * 检查是否有串口数据可用并处理命令
-     * @return true 如果处理了命令，false 如果没有数据
+     * 读取所有可用的字节（不等待），一行可以跨多次调用到达，每收到完整的一行执行一次命令
+     * @return true 如果收到了数据，false 如果没有数据
      */
     bool processInput();
     
@@ -87,6 +110,28 @@ public:
      */
     void showHelp();
     
+    /**
+     * @brief 注册扩展命令
+     * 内置命令优先，扩展命令在 help 中列出
+     * @param name 命令名（匹配时不区分大小写）
+     * @param description 帮助说明
+     * @param handler 命令处理函数
+     * @return true 如果注册成功，false 如果命令表已满
+     */
+    bool addCommand(const char* name, const char* description, CommandHandler handler);
+    
+    /**
+     * @brief 设置夜间静默时段，启用 quiet 配置项
+     * @param quiet 静默时段指针
+     */
+    void setQuietHours(QuietHours* quiet);
+    
+    /**
+     * @brief 设置设备运行设置，启用 log 和 otapass 配置项
+     * @param settings 设备运行设置指针
+     */
+    void setDeviceSettings(DeviceSettings* settings);
+    
     /**
      * @brief 退出配置模式
      * 重启系统以应用新配置
@@ -0,0 +1,40 @@
+#include "Calendar.h"
+
+// 0=周六，1=周日，2=周一...（与 Zeller 公式的结果对应）
+static constexpr const char* DAY_NAMES[] = {"Saturday", "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+
+static constexpr int longestDayName() {
+    int longest = 0;
+    for (const char* name : DAY_NAMES) {
+        int length = 0;
+        while (name[length]) {
+            length++;
+        }
+        if (length > longest) {
+            longest = length;
+        }
+    }
+    return longest;
+}
+
+static_assert(longestDayName() == CALENDAR_DAY_NAME_MAX_LENGTH, "CALENDAR_DAY_NAME_MAX_LENGTH does not match the day names");
+
+const char* Calendar::dayOfWeekName(int year, int month, int day) {
+    // 使用Zeller公式计算星期几
+    if (month < 3) {
+        month += 12;
+        year--;
+    }
+    
+    int k = year % 100;
+    int j = year / 100;
+    
+    // -2j 可能使和为负数（例如 2000-03-01），取余后调整到 0-6
+    int h = (day + ((13 * (month + 1)) / 5) + k + (k / 4) + (j / 4) - 2 * j) % 7;
+    if (h < 0) {
+        h += 7;
+    }
+    
+    // 转换为星期几字符串
+    return DAY_NAMES[h];
+}
@@ -0,0 +1,18 @@
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+/**
+ * 日历计算
+ * 不依赖 Arduino，可在主机上编译测试（test/test_microbench）
+ */
+
+// dayOfWeekName() 返回的最长名称（"Wednesday"）的字符数，DisplayLayout.h 据此计算日期区域宽度
+#define CALENDAR_DAY_NAME_MAX_LENGTH 9
+
+class Calendar {
+public:
+    // 星期几的英文名称（year 为完整年份）
+    static const char* dayOfWeekName(int year, int month, int day);
+};
+
+#endif // CALENDAR_H
@@ -0,0 +1,79 @@
+#include "TimeManager.h"
+#include "Calendar.h"
+
+// 时间的格式化和换算（静态函数），不访问 RTC 和网络，可在主机单元测试中单独编译
+
+String TimeManager::getFormattedTime(const DateTime& currentTime) {
+    char timeString[6];
+    sprintf(timeString, "%02d:%02d", currentTime.hour, currentTime.minute);
+    
+    return String(timeString);
+}
+
+String TimeManager::getFormattedDate(const DateTime& currentTime) {
+    // 获取完整年份（2000 + 两位数年份）
+    int fullYear = 2000 + currentTime.year;
+    
+    char dateString[50];
+    sprintf(dateString, "%04d/%02d/%02d %s", fullYear, currentTime.month, currentTime.day,
+            Calendar::dayOfWeekName(fullYear, currentTime.month, currentTime.day));
+    
+    return String(dateString);
+}
+
+String TimeManager::getDayOfWeek(int year, int month, int day) {
+    return String(Calendar::dayOfWeekName(year, month, day));
+}
+
+uint32_t TimeManager::toEpochSeconds(const DateTime& dt) {
+    // 每月之前的累计天数（非闰年）
+    static const uint16_t DAYS_BEFORE_MONTH[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+    
+    if (dt.month < 1 || dt.month > 12) {
+        return 0;
+    }
+    
+    // DateTime.year 为两位数年份，2000-2099 范围内每4年一个闰年
+    uint32_t days = dt.year * 365UL + (dt.year + 3) / 4;
+    days += DAYS_BEFORE_MONTH[dt.month - 1] + dt.day - 1;
+    if (dt.month > 2 && (dt.year % 4) == 0) {
+        days++;
+    }
+    
+    return ((days * 24 + dt.hour) * 60 + dt.minute) * 60 + dt.second;
+}
+
+DateTime TimeManager::fromEpochSeconds(uint32_t seconds) {
+    static const uint8_t DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    
+    DateTime dt;
+    dt.second = seconds % 60;
+    seconds /= 60;
+    dt.minute = seconds % 60;
+    seconds /= 60;
+    dt.hour = seconds % 24;
+    uint32_t days = seconds / 24;
+    
+    // 每4年 1461 天，周期的第一年（2000、2004……）为闰年
+    dt.year = days / 1461 * 4;
+    days %= 1461;
+    bool leap = days < 366;
+    if (!leap) {
+        days -= 366;
+        dt.year += 1 + days / 365;
+        days %= 365;
+    }
+    
+    dt.month = 1;
+    while (dt.month < 12) {
+        uint8_t length = DAYS_IN_MONTH[dt.month - 1] + ((dt.month == 2 && leap) ? 1 : 0);
+        if (days < length) {
+            break;
+        }
+        days -= length;
+        dt.month++;
+    }
+    dt.day = days + 1;
+    
+    return dt;
+}
@@ -1,5 +1,6 @@
 #include "TimeManager.h"
 #include "../LogManager/LogManager.h"
+#include "../Metrics/Metrics.h"
 
 // NTP 服务器配置
 const char* TimeManager::NTP_SERVERS[] = {
@@ -52,15 +53,18 @@ bool TimeManager::updateNTPTime() {
     while (time(nullptr) < 1000000000 && retryCount < NTP_MAX_RETRIES) {
         delay(500);
         retryCount++;
-        LogManager::debug(F("."));
+        LOG_DEBUG(".");
     }
-    LogManager::debug(F(""));
+    LOG_DEBUG("");
     
     if (retryCount >= NTP_MAX_RETRIES) {
+        Metrics::increment(METRIC_NTP_FAILURES);
         LOG_ERROR("TimeManager: Failed to get time from NTP server");
         return false;
     }
     
+    Metrics::increment(METRIC_NTP_SYNCS);
+    
     // 获取时间
     time_t now = time(nullptr);
     struct tm* timeinfo = localtime(&now);
@@ -193,40 +197,3 @@ void TimeManager::printTimeDebug(const char* prefix, const DateTime& dt) {
                 prefix, 2000 + dt.year, dt.month, dt.day,
                 dt.hour, dt.minute, dt.second);
 }
-
-String TimeManager::getFormattedTime(const DateTime& currentTime) {
-    char timeString[6];
-    sprintf(timeString, "%02d:%02d", currentTime.hour, currentTime.minute);
-    
-    return String(timeString);
-}
-
-String TimeManager::getFormattedDate(const DateTime& currentTime) {
-    // 获取完整年份（2000 + 两位数年份）
-    int fullYear = 2000 + currentTime.year;
-    
-    // 获取星期几
-    String dayOfWeek = getDayOfWeek(fullYear, currentTime.month, currentTime.day);
-    
-    char dateString[50];
-    sprintf(dateString, "%04d/%02d/%02d %s", fullYear, currentTime.month, currentTime.day, dayOfWeek.c_str());
-    
-    return String(dateString);
-}
-
-String TimeManager::getDayOfWeek(int year, int month, int day) {
-    // 使用Zeller公式计算星期几
-    if (month < 3) {
-        month += 12;
-        year--;
-    }
-    
-    int k = year % 100;
-    int j = year / 100;
-    
-    int h = (day + ((13 * (month + 1)) / 5) + k + (k / 4) + (j / 4) - 2 * j) % 7;
-    
-    // 转换为星期几字符串（0=周六，1=周日，2=周一...）
-    String days[] = {"Saturday", "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
-    return days[h];
-}
\ No newline at end of file
@@ -54,6 +54,12 @@ public:
     // 获取星期几
     static String getDayOfWeek(int year, int month, int day);
     
+    // 转换为自 2000-01-01 00:00:00（本地时间）起的秒数
+    static uint32_t toEpochSeconds(const DateTime& dt);
+    
+    // toEpochSeconds 的逆运算
+    static DateTime fromEpochSeconds(uint32_t seconds);
+    
 private:
     BM8563* _rtc;
     DateTime _currentTime;
@@ -16,7 +16,7 @@ UnifiedConfigManager::~UnifiedConfigManager() {
 
 void UnifiedConfigManager::begin() {
     if (!_initialized) {
-        _configManager->begin();
+        // 只读访问直接从 Flash 读取，写入时 ConfigManager 会按需初始化 EEPROM
         _initialized = true;
         LOG_INFO("UnifiedConfigManager initialized");
         printCurrentConfig();
@@ -111,10 +111,11 @@ void UnifiedConfigManager::clearEEPROMConfig() {
 }
 
 void UnifiedConfigManager::printCurrentConfig() {
-    if (!_initialized) return;
+    // 日志级别过滤时不读取配置（每个字段都会创建 String）
+    if (!_initialized || !LogManager::isEnabled(LOG_INFO)) return;
     
     LogManager::printSeparator('=', 30);
-    LogManager::info(F("当前配置信息"));
+    LOG_INFO("当前配置信息");
     LogManager::printSeparator('=', 30);
     
     LogManager::printKeyValue(F("WiFi SSID"), getWiFiSSID().c_str());
@@ -11,7 +11,7 @@
  */
 class UnifiedConfigManager {
 public:
-    UnifiedConfigManager(int eepromSize = 512);
+    UnifiedConfigManager(int eepromSize = EEPROM_TOTAL_SIZE);
     ~UnifiedConfigManager();
     
     void begin();
@@ -0,0 +1,116 @@
+#include "WakeScheduler.h"
+#include "../LogManager/LogManager.h"
+
+static const char* const REFRESH_NAMES[] = {"partial", "full"};
+
+WakeScheduler::WakeScheduler()
+  : _interval(60) {
+  memset(&_state, 0, sizeof(_state));
+  _state.latencyMs[0] = WAKE_DEFAULT_LATENCY_MS;
+  _state.latencyMs[1] = WAKE_DEFAULT_LATENCY_MS;
+}
+
+void WakeScheduler::begin() {
+  // 冷启动或 RTC 数据损坏时从默认延迟重新学习
+  if (!RTCMemory::read(RTC_BLOCK_WAKE_SCHEDULER, _state)) {
+    memset(&_state, 0, sizeof(_state));
+    _state.latencyMs[0] = WAKE_DEFAULT_LATENCY_MS;
+    _state.latencyMs[1] = WAKE_DEFAULT_LATENCY_MS;
+    LOG_INFO("WakeScheduler: no wake latency in RTC memory");
+    return;
+  }
+
+  // 尚未学习或超出范围的刷新方式使用默认延迟
+  for (uint8_t type = 0; type < 2; type++) {
+    if (_state.samples[type] == 0 || _state.latencyMs[type] > WAKE_LATENCY_MAX_SAMPLE) {
+      _state.latencyMs[type] = WAKE_DEFAULT_LATENCY_MS;
+      _state.samples[type] = 0;
+    }
+  }
+
+  LOG_DEBUG_F("WakeScheduler: latency partial %u ms (%u samples), full %u ms (%u samples)",
+              _state.latencyMs[0], _state.samples[0], _state.latencyMs[1], _state.samples[1]);
+}
+
+void WakeScheduler::setInterval(uint16_t seconds) {
+  _interval = seconds > 0 ? seconds : 60;
+}
+
+uint32_t WakeScheduler::getLatencyMs(bool fullRefresh) const {
+  return _state.latencyMs[fullRefresh ? 1 : 0];
+}
+
+uint32_t WakeScheduler::elapsedMs() {
+  return millis() + WAKE_BOOT_OVERHEAD_MS;
+}
+
+uint32_t WakeScheduler::lookaheadFor(uint32_t latencyMs) {
+  uint32_t elapsed = elapsedMs();
+  if (elapsed >= latencyMs) {
+    return 0;
+  }
+  return (latencyMs - elapsed + 500) / 1000;
+}
+
+uint32_t WakeScheduler::getLookaheadSeconds(uint8_t hour, uint8_t minute, uint8_t second, WakeFullRefreshPredictor predictFull) const {
+  if (!predictFull) {
+    return lookaheadFor(_state.latencyMs[1]);
+  }
+
+  // 按局部刷新提前后显示的时间预测刷新方式
+  uint32_t lookahead = lookaheadFor(_state.latencyMs[0]);
+  uint32_t shown = (uint32_t)hour * 3600 + minute * 60 + second + lookahead;
+  if (predictFull((shown / 3600) % 24, (shown / 60) % 60)) {
+    lookahead = lookaheadFor(_state.latencyMs[1]);
+  }
+  return lookahead;
+}
+
+void WakeScheduler::recordLatency(uint32_t ms, bool fullRefresh) {
+  uint8_t type = fullRefresh ? 1 : 0;
+  if (ms > WAKE_LATENCY_MAX_SAMPLE) {
+    LOG_WARN_F("WakeScheduler: %s refresh latency sample %lu ms ignored", REFRESH_NAMES[type], ms);
+    return;
+  }
+
+  // 第一个样本直接采用，之后按指数加权移动平均平滑
+  if (_state.samples[type] == 0) {
+    _state.latencyMs[type] = ms;
+  } else {
+    int32_t delta = (int32_t)ms - (int32_t)_state.latencyMs[type];
+    _state.latencyMs[type] += delta / WAKE_LATENCY_SMOOTHING;
+  }
+  if (_state.samples[type] < UINT16_MAX) {
+    _state.samples[type]++;
+  }
+
+  LOG_INFO_F("WakeScheduler: %s refresh wake took %lu ms, learned latency %u ms", REFRESH_NAMES[type], ms, _state.latencyMs[type]);
+  if (!RTCMemory::write(RTC_BLOCK_WAKE_SCHEDULER, _state)) {
+    LOG_WARN("WakeScheduler: failed to save state to RTC memory");
+  }
+}
+
+uint32_t WakeScheduler::sleepUntilBoundary(uint32_t now, uint32_t latencyMs, uint32_t& boundary) const {
+  uint32_t latency = (latencyMs + 500) / 1000;
+
+  // 满足最短睡眠时间的第一个周期边界：唤醒时刻 = 边界 - 延迟
+  uint32_t earliest = now + latency + WAKE_MIN_SLEEP_SECONDS;
+  boundary = (earliest + _interval - 1) / _interval * _interval;
+  return boundary - latency - now;
+}
+
+uint16_t WakeScheduler::computeSleepSeconds(uint8_t hour, uint8_t minute, uint8_t second, WakeFullRefreshPredictor predictFull) const {
+  uint32_t now = (uint32_t)hour * 3600 + minute * 60 + second;
+
+  // 先按局部刷新耗时找到目标边界，预测该时刻全刷时改用全刷耗时重新计算
+  bool fullRefresh = true;
+  uint32_t boundary = 0;
+  if (predictFull) {
+    sleepUntilBoundary(now, _state.latencyMs[0], boundary);
+    fullRefresh = predictFull((boundary / 3600) % 24, (boundary / 60) % 60);
+  }
+  uint32_t sleepSeconds = sleepUntilBoundary(now, _state.latencyMs[fullRefresh ? 1 : 0], boundary);
+
+  // 周期超过定时器上限时分段睡眠，下次唤醒重新计算
+  return (uint16_t)min(sleepSeconds, (uint32_t)WAKE_MAX_SLEEP_SECONDS);
+}
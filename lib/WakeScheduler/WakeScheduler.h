@@ -0,0 +1,88 @@
+#ifndef WAKE_SCHEDULER_H
+#define WAKE_SCHEDULER_H
+
+#include <Arduino.h>
+#include "../RTCMemory/RTCMemory.h"
+
+// 未学习到延迟前使用的唤醒到刷新完成耗时（毫秒）
+#define WAKE_DEFAULT_LATENCY_MS 3000
+
+// 复位到 millis() 开始计时之间的启动耗时估计（ROM 引导和 SDK 初始化，毫秒）
+#ifndef WAKE_BOOT_OVERHEAD_MS
+#define WAKE_BOOT_OVERHEAD_MS 120
+#endif
+
+// 最短睡眠时间（秒），距离目标边界太近时顺延一个周期，避免连续唤醒
+#define WAKE_MIN_SLEEP_SECONDS 10
+
+// BM8563 定时器为 8 位计数器，1Hz 时钟下最长 255 秒
+#define WAKE_MAX_SLEEP_SECONDS 255
+
+// 延迟学习的平滑系数：新样本占 1/WAKE_LATENCY_SMOOTHING
+#define WAKE_LATENCY_SMOOTHING 4
+
+// 单个延迟样本的上限（毫秒），超出的视为异常唤醒不参与学习
+#define WAKE_LATENCY_MAX_SAMPLE 20000
+
+// 预测显示 hour:minute 时的刷新是否为全刷（例如 GDEY029T94::predictRefresh()）
+typedef bool (*WakeFullRefreshPredictor)(uint8_t hour, uint8_t minute);
+
+/**
+ * 唤醒调度器
+ * 按 RTC 当前时间把下次唤醒安排在下一个周期边界（默认整分钟）之前，
+ * 提前量为学习到的唤醒到刷新完成耗时，使刷新完成时正好进入新的一分钟。
+ * 局部刷新和全刷的耗时相差数秒，分别按指数加权移动平均学习，保存在 RTC 内存中；
+ * 计算提前量时由预测函数判断目标时刻的刷新方式，未提供时按全刷估计
+ */
+class WakeScheduler {
+public:
+  WakeScheduler();
+
+  // 从 RTC 内存恢复学习到的延迟
+  void begin();
+
+  // 设置唤醒周期（秒），唤醒对齐到当天内该周期的整数倍
+  void setInterval(uint16_t seconds);
+
+  // 学习到的唤醒到刷新完成耗时（毫秒）
+  uint32_t getLatencyMs(bool fullRefresh) const;
+
+  // 本次唤醒已经过的时间（毫秒，含启动耗时估计）
+  static uint32_t elapsedMs();
+
+  /**
+   * 显示时间应提前的秒数：预计刷新完成时刻与现在之差，四舍五入
+   * @param hour/minute/second 当前时间
+   * @param predictFull 刷新方式预测，按局部刷新提前后的显示时间判断是否改用全刷耗时
+   */
+  uint32_t getLookaheadSeconds(uint8_t hour, uint8_t minute, uint8_t second, WakeFullRefreshPredictor predictFull = nullptr) const;
+
+  // 记录本次从唤醒到刷新完成的耗时（只应在未联网、实际刷新了屏幕的唤醒中调用）
+  void recordLatency(uint32_t ms, bool fullRefresh);
+
+  /**
+   * 计算睡眠秒数
+   * @param hour/minute/second RTC 当前时间
+   * @param predictFull 刷新方式预测，按局部刷新耗时找到的边界时刻判断是否改用全刷耗时
+   * @return 唤醒后刷新完成时刻落在下一个周期边界的睡眠时间
+   */
+  uint16_t computeSleepSeconds(uint8_t hour, uint8_t minute, uint8_t second, WakeFullRefreshPredictor predictFull = nullptr) const;
+
+private:
+  // RTC 内存中的状态（2 块 + CRC），下标 0 为局部刷新，1 为全刷
+  struct WakeState {
+    uint16_t latencyMs[2];  // 平滑后的唤醒到刷新完成耗时
+    uint16_t samples[2];    // 已学习的样本数
+  };
+
+  // 按延迟计算提前秒数
+  static uint32_t lookaheadFor(uint32_t latencyMs);
+
+  // 按延迟计算到下一个周期边界前的睡眠秒数，boundary 返回边界（当天秒数，可能超过一天）
+  uint32_t sleepUntilBoundary(uint32_t now, uint32_t latencyMs, uint32_t& boundary) const;
+
+  WakeState _state;
+  uint16_t _interval;
+};
+
+#endif // WAKE_SCHEDULER_H
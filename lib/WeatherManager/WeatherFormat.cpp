@@ -0,0 +1,71 @@
+#include "WeatherManager.h"
+#include "WeatherText.h"
+#include "../LogManager/LogManager.h"
+
+// 天气数据的解析和格式化（静态函数），不涉及网络和存储，可在主机单元测试中单独编译
+
+bool WeatherManager::parseWeatherResponse(const String& payload, WeatherInfo& weather) {
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, payload);
+  
+  if (error) {
+    LOG_WARN_F("Failed to parse JSON: %s", error.c_str());
+    return false;
+  }
+  
+  // 检查status是否为"1"
+  String status = doc["status"].as<String>();
+  if (status != "1") {
+    LOG_WARN_F("API returned error status: %s", status.c_str());
+    return false;
+  }
+  
+  // 获取lives数据
+  JsonObject lives = doc["lives"][0];
+  
+  // 城市编码不存在时 status 仍为"1"，但 lives 为空
+  if (lives.isNull()) {
+    LOG_WARN("API returned no live weather data");
+    return false;
+  }
+  
+  // 更新WeatherInfo
+  weather.Temperature = lives["temperature"].as<float>();
+  weather.Humidity = lives["humidity"].as<int>();
+  weather.WindDirection = lives["winddirection"].as<String>();
+  weather.WindSpeed = lives["windpower"].as<String>();
+  weather.Weather = lives["weather"].as<String>();
+  
+  // 根据天气状况设置符号
+  weather.Symbol = mapWeatherToSymbol(weather.Weather);
+  return true;
+}
+
+char WeatherManager::mapWeatherToSymbol(const String& weather) {
+  return WeatherText::toSymbol(weather.c_str());
+}
+
+String WeatherManager::translateWindDirection(const String& chineseDirection) {
+  const char* english = WeatherText::windDirectionToEnglish(chineseDirection.c_str());
+  return english != nullptr ? String(english) : chineseDirection; // 如果没有匹配的，返回原始值
+}
+
+String WeatherManager::formatWindSpeed(const String& windSpeed) {
+  String formatted = windSpeed;
+  formatted.replace("≤", "<=");
+  formatted.replace("≥", ">=");
+  return formatted;
+}
+
+String WeatherManager::getWeatherInfo(const WeatherInfo& currentWeather) {
+  String weatherString = "";
+  weatherString += String(currentWeather.Temperature, 0) + "C ";
+  weatherString += String(currentWeather.Humidity) + "% ";
+  weatherString += translateWindDirection(currentWeather.WindDirection) + " ";
+  weatherString += formatWindSpeed(currentWeather.WindSpeed);
+  return weatherString;
+}
+
+char WeatherManager::getWeatherSymbol(const WeatherInfo& currentWeather) {
+  return currentWeather.Symbol;
+}
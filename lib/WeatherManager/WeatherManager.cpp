@@ -1,5 +1,6 @@
 #include "WeatherManager.h"
 #include "../LogManager/LogManager.h"
+#include "../Metrics/Metrics.h"
 #include "../../config.h"
 
 WeatherManager::WeatherManager(const char* apiKey, const String& cityCode, BM8563* rtc, int eepromSize)
@@ -19,7 +20,7 @@ WeatherManager::~WeatherManager() {
 }
 
 void WeatherManager::begin() {
-  _configManager->begin();
+  // 不调用 _configManager->begin()：缓存读取直接走 Flash，仅写入时才初始化 EEPROM
   LOG_INFO("WeatherManager initialized");
   
   // 尝试从配置读取天气信息
@@ -85,61 +86,41 @@ bool WeatherManager::fetchWeatherFromNetwork() {
   // API URL
   String url = "https://restapi.amap.com/v3/weather/weatherInfo?key=" + String(_apiKey) + "&city=" + _cityCode + "&extensions=base&output=JSON";
   
-  LogManager::info(String(F("Fetching weather data from: ")) + url);
+  LOG_INFO_F("Fetching weather data from: %s", url.c_str());
   
   client.setInsecure(); // 跳过SSL证书验证
   http.begin(client, url);
   http.setTimeout(5000); // 5秒超时
   
   int httpResponseCode = http.GET();
+  Metrics::increment(METRIC_HTTP_REQUESTS);
+  if (httpResponseCode != 200) {
+    Metrics::increment(METRIC_HTTP_FAILURES);
+  }
   
   if (httpResponseCode == 200) {
     String payload = http.getString();
-    LogManager::info(String(F("Weather data received: ")) + payload);
+    LOG_INFO_F("Weather data received (%u bytes)", payload.length());
+    LOG_DEBUG_F("%s", payload.c_str());
     
     // 解析JSON数据
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, payload);
-    
-    if (error) {
-      LogManager::warn(String(F("Failed to parse JSON: ")) + String(error.c_str()));
-      http.end();
-      return false;
-    }
-    
-    // 检查status是否为"1"
-    String status = doc["status"].as<String>();
-    if (status != "1") {
-      LogManager::warn(String(F("API returned error status: ")) + status);
+    if (!parseWeatherResponse(payload, _currentWeather)) {
       http.end();
       return false;
     }
     
-    // 获取lives数据
-    JsonObject lives = doc["lives"][0];
-    
-    // 更新WeatherInfo
-    _currentWeather.Temperature = lives["temperature"].as<float>();
-    _currentWeather.Humidity = lives["humidity"].as<int>();
-    _currentWeather.WindDirection = lives["winddirection"].as<String>();
-    _currentWeather.WindSpeed = lives["windpower"].as<String>();
-    _currentWeather.Weather = lives["weather"].as<String>();
-    
-    // 根据天气状况设置符号
-    _currentWeather.Symbol = mapWeatherToSymbol(_currentWeather.Weather);
-    
     LOG_INFO("Weather updated successfully");
-    LogManager::info(String(F("Temperature: ")) + String(_currentWeather.Temperature));
-    LogManager::info(String(F("Humidity: ")) + String(_currentWeather.Humidity));
-    LogManager::info(String(F("Wind Direction: ")) + _currentWeather.WindDirection);
-    LogManager::info(String(F("Wind Speed: ")) + _currentWeather.WindSpeed);
-    LogManager::info(String(F("Weather: ")) + _currentWeather.Weather);
-    LogManager::info(String(F("Symbol: ")) + String(_currentWeather.Symbol));
+    LOG_INFO_F("Temperature: %.2f", _currentWeather.Temperature);
+    LOG_INFO_F("Humidity: %d", _currentWeather.Humidity);
+    LOG_INFO_F("Wind Direction: %s", _currentWeather.WindDirection.c_str());
+    LOG_INFO_F("Wind Speed: %s", _currentWeather.WindSpeed.c_str());
+    LOG_INFO_F("Weather: %s", _currentWeather.Weather.c_str());
+    LOG_INFO_F("Symbol: %c", _currentWeather.Symbol);
     
     http.end();
     return true;
   } else {
-    LogManager::warn(String(F("HTTP request failed with code: ")) + String(httpResponseCode));
+    LOG_WARN_F("HTTP request failed with code: %d", httpResponseCode);
     http.end();
     return false;
   }
@@ -164,10 +145,10 @@ bool WeatherManager::readWeatherFromStorage() {
   convertFromConfigData(configData, _currentWeather);
   
   LOG_INFO("Weather config read from storage successfully");
-  LogManager::info(String(F("Temperature: ")) + String(_currentWeather.Temperature));
-  LogManager::info(String(F("Humidity: ")) + String(_currentWeather.Humidity));
-  LogManager::info(String(F("Weather: ")) + _currentWeather.Weather);
-  LogManager::info(String(F("Last Update: ")) + String(configData.lastUpdateTime));
+  LOG_INFO_F("Temperature: %.2f", _currentWeather.Temperature);
+  LOG_INFO_F("Humidity: %d", _currentWeather.Humidity);
+  LOG_INFO_F("Weather: %s", _currentWeather.Weather.c_str());
+  LOG_INFO_F("Last Update: %lu", configData.lastUpdateTime);
   
   return true;
 }
@@ -192,10 +173,10 @@ bool WeatherManager::writeWeatherToStorage() {
   
   if (success) {
     LOG_INFO("Weather config written to storage successfully");
-    LogManager::info(String(F("Temperature: ")) + String(configData.temperature));
-    LogManager::info(String(F("Humidity: ")) + String(configData.humidity));
-    LogManager::info(String(F("Weather: ")) + String(configData.weather));
-    LogManager::info(String(F("Last Update: ")) + String(configData.lastUpdateTime));
+    LOG_INFO_F("Temperature: %.2f", configData.temperature);
+    LOG_INFO_F("Humidity: %d", configData.humidity);
+    LOG_INFO_F("Weather: %s", configData.weather);
+    LOG_INFO_F("Last Update: %lu", configData.lastUpdateTime);
   } else {
     LOG_ERROR("Failed to write weather config to storage");
   }
@@ -235,7 +216,7 @@ bool WeatherManager::setUpdateTime(unsigned long timestamp) {
   
   if (success) {
     LOG_INFO("Timestamp updated successfully");
-    LogManager::info(String(F("New timestamp: ")) + String(timestamp));
+    LOG_INFO_F("New timestamp: %lu", timestamp);
   } else {
     LOG_ERROR("Failed to update timestamp");
   }
@@ -249,48 +230,13 @@ void WeatherManager::clearWeatherData() {
   LOG_INFO("Weather config cleared from storage");
 }
 
-char WeatherManager::mapWeatherToSymbol(const String& weather) {
-  // Weather symbol mapping:
-  // n=晴(sunny), d=雪(snow), m=雨(rain), l=雾(fog), c=阴(overcast), o=多云(cloudy), k=雷雨(thunderstorm)
-  
-  if (weather.indexOf("晴") >= 0) {
-    return 'n'; // 晴天
-  } else if (weather.indexOf("雷") >= 0 && weather.indexOf("雨") >= 0) {
-    return 'k'; // 雷雨
-  } else if (weather.indexOf("雪") >= 0) {
-    return 'd'; // 雪
-  } else if (weather.indexOf("雨") >= 0) {
-    return 'm'; // 雨
-  } else if (weather.indexOf("雷") >= 0) {
-    return 'a'; // 雷
-  } else if (weather.indexOf("雾") >= 0) {
-    return 'l'; // 雾
-  } else if (weather.indexOf("阴") >= 0) {
-    return 'c'; // 阴
-  } else if (weather.indexOf("多云") >= 0) {
-    return 'o'; // 多云
-  } else if (weather.indexOf("少云") >= 0) {
-    return 'p'; // 少云
-  } else if (weather.indexOf("晴间多云") >= 0) {
-    return 'c'; // 晴间多云
-  } else if (weather.indexOf("风") >= 0) {
-    return 'f'; // 风
-  } else if (weather.indexOf("冷") >= 0) {
-    return 'e'; // 冷
-  } else if (weather.indexOf("热") >= 0) {
-    return 'h'; // 热
-  } else {
-    return 'n'; // 默认晴天
-  }
-}
-
 void WeatherManager::initializeDefaultWeather() {
   _currentWeather.Temperature = 23.5;
   _currentWeather.Humidity = 65;
-  _currentWeather.Symbol = 'n';
   _currentWeather.WindDirection = "北";
   _currentWeather.WindSpeed = "≤3";
   _currentWeather.Weather = "晴";
+  _currentWeather.Symbol = mapWeatherToSymbol(_currentWeather.Weather);
 }
 
 void WeatherManager::convertToConfigData(const WeatherInfo& weatherInfo, ConfigData& configData) {
@@ -391,35 +337,3 @@ unsigned long WeatherManager::getCurrentUnixTimestamp() {
   
   return now;
 }
-
-String WeatherManager::translateWindDirection(const String& chineseDirection) {
-  if (chineseDirection == "东") return "East";
-  if (chineseDirection == "西") return "West";
-  if (chineseDirection == "南") return "South";
-  if (chineseDirection == "北") return "North";
-  if (chineseDirection == "东北") return "Northeast";
-  if (chineseDirection == "西北") return "Northwest";
-  if (chineseDirection == "东南") return "Southeast";
-  if (chineseDirection == "西南") return "Southwest";
-  return chineseDirection; // 如果没有匹配的，返回原始值
-}
-
-String WeatherManager::formatWindSpeed(const String& windSpeed) {
-  String formatted = windSpeed;
-  formatted.replace("≤", "<=");
-  formatted.replace("≥", ">=");
-  return formatted;
-}
-
-String WeatherManager::getWeatherInfo(const WeatherInfo& currentWeather) {
-  String weatherString = "";
-  weatherString += String(currentWeather.Temperature, 0) + "C ";
-  weatherString += String(currentWeather.Humidity) + "% ";
-  weatherString += translateWindDirection(currentWeather.WindDirection) + " ";
-  weatherString += formatWindSpeed(currentWeather.WindSpeed);
-  return weatherString;
-}
-
-char WeatherManager::getWeatherSymbol(const WeatherInfo& currentWeather) {
-  return currentWeather.Symbol;
-}
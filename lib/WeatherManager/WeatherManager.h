@@ -18,8 +18,7 @@ struct WeatherInfo {
   String WindDirection; // 风向
   String WindSpeed;     // 风速
   String Weather;       // 天气状况
-  // 天气符号映射:
-  // n=晴(sunny), d=雪(snow), m=雨(rain), l=雾(fog), c=阴(overcast), o=多云(cloudy), k=雷雨(thunderstorm)
+  // 天气符号映射见 WeatherText.cpp 中的 WEATHER_SYMBOLS
 };
 
 // 前向声明 GDEY029T94 类
@@ -28,7 +27,7 @@ class GDEY029T94;
 class WeatherManager {
 public:
   // 构造函数
-  WeatherManager(const char* apiKey, const String& cityCode, BM8563* rtc, int eepromSize = 512);
+  WeatherManager(const char* apiKey, const String& cityCode, BM8563* rtc, int eepromSize = EEPROM_TOTAL_SIZE);
   
   // 析构函数
   ~WeatherManager();
@@ -66,6 +65,9 @@ public:
   // 清除存储中的天气数据
   void clearWeatherData();
   
+  // 解析高德天气API的响应，填充温度、湿度、风向、风速、天气和符号
+  static bool parseWeatherResponse(const String& payload, WeatherInfo& weather);
+  
   // 将天气状况映射到符号
   static char mapWeatherToSymbol(const String& weather);
   
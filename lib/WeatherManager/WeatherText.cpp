@@ -0,0 +1,65 @@
+#include "WeatherText.h"
+#include <string.h>
+
+// 中文风向和对应的英文
+struct WindDirectionName {
+  const char* chinese;
+  const char* english;
+};
+
+static const WindDirectionName WIND_DIRECTIONS[] = {
+  {"东", "East"},
+  {"西", "West"},
+  {"南", "South"},
+  {"北", "North"},
+  {"东北", "Northeast"},
+  {"西北", "Northwest"},
+  {"东南", "Southeast"},
+  {"西南", "Southwest"},
+};
+
+#define WIND_DIRECTION_COUNT (sizeof(WIND_DIRECTIONS) / sizeof(WIND_DIRECTIONS[0]))
+
+// 天气状况到符号的映射，按顺序匹配第一条：天气状况同时包含 keyword 和 also（不为空时）
+// scripts/subset_fonts.py 读取本表和 WEATHER_SYMBOL_DEFAULT 生成天气符号字体的子集，符号字母只能写在这里
+struct WeatherSymbolRule {
+  const char* keyword;
+  const char* also;
+  char symbol;
+};
+
+static const WeatherSymbolRule WEATHER_SYMBOLS[] = {
+  {"晴", nullptr, 'n'},    // 晴天
+  {"雷", "雨", 'k'},       // 雷雨
+  {"雪", nullptr, 'd'},    // 雪
+  {"雨", nullptr, 'm'},    // 雨
+  {"雷", nullptr, 'a'},    // 雷
+  {"雾", nullptr, 'l'},    // 雾
+  {"阴", nullptr, 'c'},    // 阴
+  {"多云", nullptr, 'o'},  // 多云
+  {"少云", nullptr, 'p'},  // 少云
+  {"风", nullptr, 'f'},    // 风
+  {"冷", nullptr, 'e'},    // 冷
+  {"热", nullptr, 'h'},    // 热
+};
+
+#define WEATHER_SYMBOL_COUNT (sizeof(WEATHER_SYMBOLS) / sizeof(WEATHER_SYMBOLS[0]))
+
+char WeatherText::toSymbol(const char* weather) {
+  for (size_t i = 0; i < WEATHER_SYMBOL_COUNT; i++) {
+    const WeatherSymbolRule& rule = WEATHER_SYMBOLS[i];
+    if (strstr(weather, rule.keyword) != nullptr && (rule.also == nullptr || strstr(weather, rule.also) != nullptr)) {
+      return rule.symbol;
+    }
+  }
+  return WEATHER_SYMBOL_DEFAULT;
+}
+
+const char* WeatherText::windDirectionToEnglish(const char* chineseDirection) {
+  for (size_t i = 0; i < WIND_DIRECTION_COUNT; i++) {
+    if (strcmp(chineseDirection, WIND_DIRECTIONS[i].chinese) == 0) {
+      return WIND_DIRECTIONS[i].english;
+    }
+  }
+  return nullptr;
+}
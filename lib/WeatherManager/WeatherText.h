@@ -0,0 +1,21 @@
+#ifndef WEATHER_TEXT_H
+#define WEATHER_TEXT_H
+
+/**
+ * 高德天气文字的映射：天气状况到图标字体的符号、中文风向到英文
+ * 只使用 C 字符串，不依赖 Arduino，可在主机上编译测试（test/test_microbench）
+ */
+// 无法识别的天气状况使用的符号（晴）
+#define WEATHER_SYMBOL_DEFAULT 'n'
+
+// 天气符号字体中的符号：n=晴, p=少云, o=多云, c=阴, m=雨, k=雷雨, a=雷, d=雪, l=雾, f=风, e=冷, h=热
+class WeatherText {
+public:
+  // 将天气状况（UTF-8）映射到符号，无法识别时返回 WEATHER_SYMBOL_DEFAULT
+  static char toSymbol(const char* weather);
+
+  // 将中文风向转换为英文，无法识别时返回 nullptr
+  static const char* windDirectionToEnglish(const char* chineseDirection);
+};
+
+#endif // WEATHER_TEXT_H
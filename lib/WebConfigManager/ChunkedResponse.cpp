@@ -0,0 +1,62 @@
+#include "ChunkedResponse.h"
+
+ChunkedResponse::ChunkedResponse(ESP8266WebServer& server)
+    : _server(server), _length(0) {
+}
+
+void ChunkedResponse::begin(int code, const char* contentType) {
+    _length = 0;
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.send(code, contentType, "");
+}
+
+void ChunkedResponse::sendP(PGM_P fragment) {
+    sendBuffer();
+    _server.sendContent_P(fragment);
+}
+
+void ChunkedResponse::printEscaped(const char* text) {
+    if (text == nullptr) {
+        return;
+    }
+
+    for (const char* p = text; *p != '\0'; p++) {
+        switch (*p) {
+            case '&':  print(F("&amp;"));  break;
+            case '<':  print(F("&lt;"));   break;
+            case '>':  print(F("&gt;"));   break;
+            case '"':  print(F("&quot;")); break;
+            case '\'': print(F("&#39;"));  break;
+            default:   write((uint8_t)*p); break;
+        }
+    }
+}
+
+void ChunkedResponse::end() {
+    sendBuffer();
+    // 空分块表示正文结束
+    _server.sendContent("");
+}
+
+size_t ChunkedResponse::write(uint8_t c) {
+    if (_length >= sizeof(_buffer)) {
+        sendBuffer();
+    }
+    _buffer[_length++] = (char)c;
+    return 1;
+}
+
+size_t ChunkedResponse::write(const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        write(data[i]);
+    }
+    return size;
+}
+
+void ChunkedResponse::sendBuffer() {
+    if (_length == 0) {
+        return;
+    }
+    _server.sendContent(_buffer, _length);
+    _length = 0;
+}
@@ -0,0 +1,58 @@
+#ifndef CHUNKED_RESPONSE_H
+#define CHUNKED_RESPONSE_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+
+// 小片段的合并缓冲区大小，写满后作为一个分块发送
+#define CHUNKED_RESPONSE_BUFFER_SIZE 256
+
+/**
+ * @brief 分块流式 HTTP 响应
+ *
+ * 以 CONTENT_LENGTH_UNKNOWN 发送响应头，正文按分块编码边生成边发送，不在内存中拼接整个页面：
+ * - 较大的 PROGMEM 片段通过 sendP() 直接从 Flash 发送
+ * - 配置值等小片段通过 Print 接口或 printEscaped() 写入固定大小的缓冲区，写满后发送
+ * 内存占用与页面大小无关
+ */
+class ChunkedResponse : public Print {
+public:
+    explicit ChunkedResponse(ESP8266WebServer& server);
+
+    /**
+     * @brief 发送响应头，开始分块正文
+     * @param code HTTP 状态码
+     * @param contentType 内容类型
+     */
+    void begin(int code, const char* contentType);
+
+    /**
+     * @brief 直接从 Flash 发送 PROGMEM 片段（先发送缓冲区中的内容）
+     * @param fragment PROGMEM 字符串
+     */
+    void sendP(PGM_P fragment);
+
+    /**
+     * @brief 写入经过 HTML 转义的文本（用于属性值和正文）
+     * @param text RAM 中的文本
+     */
+    void printEscaped(const char* text);
+
+    /**
+     * @brief 发送剩余内容和结束分块
+     */
+    void end();
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t size) override;
+
+private:
+    // 将缓冲区中的内容作为一个分块发送
+    void sendBuffer();
+
+    ESP8266WebServer& _server;
+    char _buffer[CHUNKED_RESPONSE_BUFFER_SIZE];
+    size_t _length;
+};
+
+#endif // CHUNKED_RESPONSE_H
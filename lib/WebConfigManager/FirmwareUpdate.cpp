@@ -0,0 +1,166 @@
+#include "FirmwareUpdate.h"
+#include "../LogManager/LogManager.h"
+
+FirmwareUpdate::FirmwareUpdate() {
+    reset();
+}
+
+bool FirmwareUpdate::begin(const String& md5, const String& sha256) {
+    reset();
+    _state = STATE_RUNNING;
+    _startMs = millis();
+
+    if (md5.length() > 0 && !isHex(md5, 32)) {
+        fail(F("invalid MD5 (expected 32 hex digits)"));
+        return false;
+    }
+    if (sha256.length() > 0 && !isHex(sha256, 64)) {
+        fail(F("invalid SHA-256 (expected 64 hex digits)"));
+        return false;
+    }
+
+    // 镜像大小未知，按 OTA 可用空间开始，结束时以实际写入的大小为准
+    uint32_t maxSize = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
+    if (!Update.begin(maxSize, U_FLASH)) {
+        fail(nullptr);
+        return false;
+    }
+    if (md5.length() > 0) {
+        Update.setMD5(md5.c_str());
+    }
+
+    _checkSha256 = sha256.length() > 0;
+    if (_checkSha256) {
+        strncpy(_expectedSha256, sha256.c_str(), sizeof(_expectedSha256) - 1);
+        _expectedSha256[sizeof(_expectedSha256) - 1] = '\0';
+        br_sha256_init(&_sha256);
+    }
+
+    LOG_INFO_F("Firmware update started (max %u bytes, MD5 %s, SHA-256 %s)", maxSize,
+               md5.length() > 0 ? "on" : "off", _checkSha256 ? "on" : "off");
+    return true;
+}
+
+bool FirmwareUpdate::write(const uint8_t* data, size_t length) {
+    if (_state != STATE_RUNNING) {
+        return false;
+    }
+
+    if (Update.write(const_cast<uint8_t*>(data), length) != length) {
+        // 放弃更新（保留 Updater 的错误信息），下次上传可以重新开始
+        Update.end(false);
+        fail(nullptr);
+        return false;
+    }
+    if (_checkSha256) {
+        br_sha256_update(&_sha256, data, length);
+    }
+
+    _bytes += length;
+    if (_bytes >= _nextReport) {
+        uint32_t elapsed = millis() - _startMs;
+        LOG_INFO_F("Firmware update: %u bytes written (%u B/s)", _bytes,
+                   elapsed > 0 ? (uint32_t)((uint64_t)_bytes * 1000 / elapsed) : 0);
+        _nextReport += FIRMWARE_UPDATE_REPORT_BYTES;
+    }
+    return true;
+}
+
+bool FirmwareUpdate::end() {
+    if (_state != STATE_RUNNING) {
+        return false;
+    }
+    _elapsedMs = millis() - _startMs;
+
+    if (_checkSha256) {
+        uint8_t digest[32];
+        char hex[65];
+        br_sha256_out(&_sha256, digest);
+        for (size_t i = 0; i < sizeof(digest); i++) {
+            snprintf(hex + i * 2, 3, "%02x", digest[i]);
+        }
+        if (strcasecmp(hex, _expectedSha256) != 0) {
+            LOG_ERROR_F("Firmware SHA-256 mismatch: %s", hex);
+            // 未写满最大空间时 end(false) 放弃更新，不设置启动命令
+            Update.end(false);
+            fail(F("SHA-256 mismatch"));
+            return false;
+        }
+    }
+
+    // 以实际写入的大小结束，Updater 校验 MD5 后设置下次启动时安装新固件
+    if (!Update.end(true)) {
+        fail(nullptr);
+        return false;
+    }
+
+    _state = STATE_DONE;
+    LOG_INFO_F("Firmware update complete: %u bytes in %u ms", _bytes, _elapsedMs);
+    return true;
+}
+
+void FirmwareUpdate::abort() {
+    if (_state != STATE_RUNNING) {
+        return;
+    }
+    Update.end(false);
+    fail(F("upload aborted"));
+}
+
+bool FirmwareUpdate::isSuccessful() const {
+    return _state == STATE_DONE;
+}
+
+void FirmwareUpdate::printResult(Print& out) const {
+    switch (_state) {
+        case STATE_DONE: {
+            uint32_t rate = _elapsedMs > 0 ? (uint32_t)((uint64_t)_bytes * 1000 / _elapsedMs) : 0;
+            out.printf_P(PSTR("OK %u bytes in %u ms (%u.%u KB/s)\n"), _bytes, _elapsedMs, rate / 1024, (rate % 1024) * 10 / 1024);
+            break;
+        }
+        case STATE_FAILED:
+            out.print(F("ERROR "));
+            if (_error != nullptr) {
+                out.println(_error);
+            } else {
+                Update.printError(out);
+            }
+            break;
+        default:
+            out.println(F("ERROR no firmware uploaded"));
+            break;
+    }
+}
+
+void FirmwareUpdate::reset() {
+    _state = STATE_IDLE;
+    _error = nullptr;
+    _startMs = 0;
+    _elapsedMs = 0;
+    _bytes = 0;
+    _nextReport = FIRMWARE_UPDATE_REPORT_BYTES;
+    _checkSha256 = false;
+    _expectedSha256[0] = '\0';
+}
+
+void FirmwareUpdate::fail(const __FlashStringHelper* error) {
+    _state = STATE_FAILED;
+    _error = error;
+    if (error != nullptr) {
+        LOG_ERROR_F("Firmware update failed: %s", String(error).c_str());
+    } else {
+        LOG_ERROR_F("Firmware update failed: %s", Update.getErrorString().c_str());
+    }
+}
+
+bool FirmwareUpdate::isHex(const String& value, size_t length) {
+    if (value.length() != length) {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (!isxdigit((unsigned char)value[i])) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,76 @@
+#ifndef FIRMWARE_UPDATE_H
+#define FIRMWARE_UPDATE_H
+
+#include <Arduino.h>
+#include <Updater.h>
+#include <bearssl/bearssl_hash.h>
+
+// 每写入多少字节输出一次进度日志
+#define FIRMWARE_UPDATE_REPORT_BYTES 65536
+
+/**
+ * @brief 流式固件更新
+ *
+ * 上传的数据分块直接写入 OTA 分区（Updater 内部只缓存一个 Flash 扇区），不缓存整个镜像。
+ * 可选的 MD5 由 Updater 在结束时校验，可选的 SHA-256 边写边计算，结束时比较；
+ * 任一校验失败时放弃更新，当前固件不受影响。校验通过后重启即由 eboot 拷贝新固件
+ */
+class FirmwareUpdate {
+public:
+    FirmwareUpdate();
+
+    /**
+     * @brief 开始更新
+     * @param md5 期望的 MD5（32 位十六进制，空字符串表示不校验）
+     * @param sha256 期望的 SHA-256（64 位十六进制，空字符串表示不校验）
+     * @return true 如果已开始，false 如果校验值格式无效或空间不足
+     */
+    bool begin(const String& md5, const String& sha256);
+
+    /**
+     * @brief 写入一块数据，出错后忽略后续数据
+     * @return true 如果写入成功
+     */
+    bool write(const uint8_t* data, size_t length);
+
+    /**
+     * @brief 结束上传：比较 SHA-256，校验 MD5 并设置下次启动时安装新固件
+     * @return true 如果更新成功
+     */
+    bool end();
+
+    // 上传中断时放弃更新
+    void abort();
+
+    // 是否已成功完成（可以重启）
+    bool isSuccessful() const;
+
+    // 输出结果：成功时为 "OK <字节数> bytes in <毫秒> ms (<速率> KB/s)"，失败时为 "ERROR <原因>"
+    void printResult(Print& out) const;
+
+    // 回到初始状态
+    void reset();
+
+private:
+    enum State : uint8_t {
+        STATE_IDLE = 0,
+        STATE_RUNNING,
+        STATE_DONE,
+        STATE_FAILED
+    };
+
+    void fail(const __FlashStringHelper* error);
+    static bool isHex(const String& value, size_t length);
+
+    State _state;
+    const __FlashStringHelper* _error;  // 本类检查出的错误，nullptr 时输出 Updater 的错误
+    uint32_t _startMs;
+    uint32_t _elapsedMs;
+    size_t _bytes;
+    size_t _nextReport;
+    bool _checkSha256;
+    char _expectedSha256[65];
+    br_sha256_context _sha256;
+};
+
+#endif // FIRMWARE_UPDATE_H
@@ -0,0 +1,55 @@
+// 由 scripts/generate_web_assets.py 根据 lib/WebConfigManager/assets/ 生成，请勿手动修改
+#pragma once
+#include <Arduino.h>
+
+// 静态资源的缓存策略（URL 中带有内容版本）
+#define WEB_ASSET_CACHE_CONTROL "public, max-age=31536000, immutable"
+
+// 页面中引用资源的 URL（路径加内容版本）
+#define WEB_ASSET_STYLE_CSS_URL "/style.css?v=58900698"
+
+// gzip 压缩的静态资源：etag 为带引号的强 ETag，data 位于 PROGMEM
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const char* etag;
+  const uint8_t* data;
+  size_t length;
+};
+
+// /style.css：865 字节，gzip 后 420 字节
+static const uint8_t WEB_ASSET_STYLE_CSS_GZ[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x6D, 0x92, 0x61, 0x6F, 0xA3, 0x30,
+  0x0C, 0x86, 0xFF, 0x0A, 0x52, 0x75, 0xD2, 0x4D, 0x3A, 0x50, 0x28, 0x70, 0x5B, 0xC3, 0xA7, 0x69,
+  0xD2, 0xFE, 0x47, 0x42, 0x12, 0xB0, 0x16, 0x62, 0x14, 0xC2, 0x95, 0x16, 0xF1, 0xDF, 0x97, 0xD2,
+  0xB4, 0x07, 0x5D, 0x95, 0x6F, 0xB6, 0x5F, 0xBF, 0x7E, 0xEC, 0x70, 0x14, 0xA7, 0x49, 0xA1, 0x71,
+  0xB1, 0x62, 0x2D, 0xE8, 0x13, 0x7D, 0xB7, 0xC0, 0x74, 0xD9, 0x32, 0x5B, 0x83, 0xA1, 0x7B, 0xD2,
+  0x8D, 0x25, 0x67, 0xD5, 0x57, 0x6D, 0x71, 0x30, 0x82, 0xEE, 0x54, 0x71, 0x79, 0x73, 0x52, 0x79,
+  0x05, 0x03, 0x23, 0xED, 0xD4, 0xB2, 0x31, 0x3E, 0x82, 0x70, 0x0D, 0xCD, 0xC9, 0xA5, 0x3A, 0x28,
+  0x49, 0xC4, 0x06, 0x87, 0x6B, 0xED, 0xB1, 0x01, 0x27, 0xCB, 0x8E, 0x09, 0x01, 0xA6, 0x0E, 0x9D,
+  0xD1, 0x0A, 0x69, 0x63, 0xCB, 0x04, 0x0C, 0x3D, 0x7D, 0x5B, 0x22, 0x63, 0xDC, 0x37, 0x4C, 0xE0,
+  0xD1, 0x77, 0xD8, 0x77, 0x63, 0xE4, 0x83, 0x91, 0xAD, 0x39, 0xFB, 0x4D, 0xFE, 0x2C, 0x2F, 0x49,
+  0x5F, 0xE6, 0x26, 0x9D, 0x9C, 0x1C, 0x5D, 0xCC, 0x34, 0xD4, 0x86, 0x56, 0xD2, 0x38, 0x69, 0xCB,
+  0x0A, 0x35, 0x5A, 0xBA, 0xCB, 0xB2, 0x2C, 0x8C, 0x10, 0x73, 0x74, 0x0E, 0xDB, 0xC5, 0x69, 0x4E,
+  0x14, 0xDA, 0x36, 0xBE, 0x4C, 0xD2, 0x4D, 0xDB, 0x74, 0x5A, 0xF8, 0xB4, 0x66, 0x5C, 0xEA, 0x49,
+  0x40, 0xDF, 0x69, 0x76, 0xA2, 0x5C, 0x63, 0xF5, 0xF5, 0xD0, 0xC5, 0x57, 0x95, 0xCB, 0x9A, 0x8E,
+  0x12, 0xEA, 0xC6, 0x51, 0x8E, 0x5A, 0xDC, 0x3C, 0x8B, 0xA2, 0x98, 0xC1, 0x74, 0x83, 0x9B, 0xAE,
+  0x8B, 0x48, 0x09, 0xF9, 0x75, 0x07, 0x7D, 0xBB, 0x73, 0xD2, 0xD4, 0xB3, 0xF4, 0xA8, 0x41, 0x44,
+  0x3B, 0x21, 0xC4, 0x03, 0x7D, 0x7E, 0x33, 0xE8, 0xE1, 0x2C, 0x69, 0x9A, 0xDF, 0x96, 0x01, 0xE7,
+  0x4B, 0x97, 0x50, 0xEB, 0x23, 0x57, 0x27, 0xAA, 0xB0, 0x1A, 0xFA, 0x29, 0x84, 0xC3, 0x1C, 0xF9,
+  0xC7, 0xFB, 0x67, 0x41, 0x4A, 0x1C, 0x9C, 0xF6, 0xA7, 0xA1, 0x06, 0x8D, 0x9C, 0x13, 0xEE, 0x4C,
+  0xE0, 0xFE, 0xB9, 0xB3, 0x80, 0xE8, 0xB0, 0xBB, 0x6E, 0x89, 0x0F, 0x9E, 0xD5, 0x4C, 0xEB, 0x83,
+  0x87, 0x9E, 0x57, 0x87, 0xED, 0x09, 0x53, 0x2F, 0x89, 0x56, 0x77, 0x5C, 0x0C, 0x9F, 0x50, 0x55,
+  0x83, 0xED, 0xBD, 0xB8, 0x43, 0x58, 0x4C, 0x1F, 0x20, 0xEF, 0xFF, 0xA5, 0xB8, 0x0F, 0x40, 0x1B,
+  0xFC, 0xE7, 0x7F, 0xD6, 0x66, 0x8C, 0x82, 0x91, 0xFC, 0x30, 0x27, 0x72, 0x04, 0x17, 0x7B, 0xA4,
+  0x4D, 0x52, 0xE5, 0x79, 0x96, 0xFD, 0xFD, 0x9F, 0x7C, 0xA2, 0x17, 0x2C, 0x3D, 0x10, 0x3E, 0x27,
+  0x60, 0x14, 0x6E, 0x12, 0xF2, 0x55, 0x65, 0x4A, 0x3D, 0xB9, 0x10, 0xCF, 0xC4, 0xC1, 0x27, 0xD6,
+  0xB0, 0x4F, 0xD8, 0x7E, 0xFE, 0xA5, 0x35, 0x5F, 0xE6, 0x91, 0xBE, 0x01, 0xA5, 0xD1, 0x8C, 0x72,
+  0x61, 0x03, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/style.css", "text/css", "\"58900698\"", WEB_ASSET_STYLE_CSS_GZ, sizeof(WEB_ASSET_STYLE_CSS_GZ)},
+};
+
+#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))
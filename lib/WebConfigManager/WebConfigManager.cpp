@@ -1,12 +1,45 @@
 #include "WebConfigManager.h"
+#include "ChunkedResponse.h"
+#include "WebAssets.h"
 #include "../LogManager/LogManager.h"
 
-// 将HTML模板存储在PROGMEM中以节省RAM
-const char HTML_HEAD[] PROGMEM = "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><meta name=\"viewport\" content=\"width=device-width,initial-scale=1.0\"><title>WeWeather</title><style>body{font-family:Arial;margin:20px;background:#f5f5f5}.container{max-width:400px;margin:0 auto;background:white;padding:20px;border-radius:8px;box-shadow:0 2px 8px rgba(0,0,0,0.1)}h1{text-align:center;color:#333;margin-bottom:20px}.form-group{margin-bottom:15px}label{display:block;margin-bottom:5px;font-weight:bold;color:#555}input{width:100%;padding:8px;border:1px solid #ddd;border-radius:4px;font-size:14px;box-sizing:border-box}input:focus{border-color:#4CAF50;outline:none}.btn-group{text-align:center;margin-top:20px}button{background:#4CAF50;color:white;padding:10px 20px;border:none;border-radius:4px;cursor:pointer;font-size:14px;margin:0 5px}button:hover{background:#45a049}.exit-btn{background:#f44336}.exit-btn:hover{background:#da190b}.info{background:#e7f3ff;border:1px solid #b3d9ff;padding:10px;border-radius:4px;margin-bottom:15px;font-size:13px}</style></head><body><div class=\"container\">";
+// 将HTML模板存储在PROGMEM中以节省RAM，样式表为 gzip 压缩的静态资源（见 WebAssets.h）
+const char HTML_HEAD[] PROGMEM = "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><meta name=\"viewport\" content=\"width=device-width,initial-scale=1.0\"><title>WeWeather</title><link rel=\"stylesheet\" href=\"" WEB_ASSET_STYLE_CSS_URL "\"></head><body><div class=\"container\">";
 
 const char HTML_FOOT[] PROGMEM = "</div></body></html>";
 
-const char CONFIG_FORM[] PROGMEM = "<h1>WeWeather 配置</h1><div class=\"info\"><strong>说明：</strong>配置完成后点击保存，设备将重启并应用新配置。</div><form method=\"POST\" action=\"/save\"><div class=\"form-group\"><label>WiFi名称:</label><input type=\"text\" name=\"ssid\" value=\"%s\" placeholder=\"请输入WiFi名称\"></div><div class=\"form-group\"><label>WiFi密码:</label><input type=\"text\" name=\"password\" value=\"%s\" placeholder=\"请输入WiFi密码\"></div><div class=\"form-group\"><label>城市代码:</label><input type=\"text\" name=\"citycode\" value=\"%s\" placeholder=\"例如：110108\"></div><div class=\"form-group\"><label>API Key:</label><input type=\"text\" name=\"apikey\" value=\"%s\" placeholder=\"请输入高德地图API密钥\"></div><div class=\"form-group\"><label>MAC地址:</label><input type=\"text\" name=\"mac\" value=\"%s\" placeholder=\"例如：AA:BB:CC:DD:EE:FF\"></div><div class=\"btn-group\"><button type=\"submit\">保存配置</button><button type=\"button\" class=\"exit-btn\" onclick=\"location.href='/exit'\">退出配置</button></div></form>";
+// 配置页面按片段流式发送，表单字段的值经过 HTML 转义后插入
+const char CONFIG_FORM_BEGIN[] PROGMEM = "<h1>WeWeather 配置</h1><div class=\"info\"><strong>说明：</strong>配置完成后点击保存，设备将重启并应用新配置。</div><form method=\"POST\" action=\"/save\">";
+
+const char CONFIG_FORM_END[] PROGMEM = "<div class=\"btn-group\"><button type=\"submit\">保存配置</button><button type=\"button\" class=\"exit-btn\" onclick=\"location.href='/exit'\">退出配置</button></div></form><p><a href=\"/update\">固件更新</a></p>";
+
+// 空闲超时提示：剩余时间（分:秒）和秒数，页面加载后在浏览器中倒计时
+const char IDLE_NOTICE[] PROGMEM = "<div class=\"info\">断开热点且无操作 <strong id=\"idle\">%u:%02u</strong> 后自动退出配置模式，设备回到正常睡眠。</div><script>let s=%u;setInterval(()=>{if(s>0)s--;document.getElementById('idle').textContent=Math.floor(s/60)+':'+String(s%%60).padStart(2,'0');},1000);</script>";
+
+// 表单字段：标签、字段名和占位提示
+struct FormField {
+    char label[16];
+    char name[12];
+    char placeholder[44];
+};
+
+static const FormField CONFIG_FIELDS[] PROGMEM = {
+    {"WiFi名称", "ssid", "请输入WiFi名称"},
+    {"WiFi密码", "password", "请输入WiFi密码"},
+    {"城市代码", "citycode", "例如：110108"},
+    {"API Key", "apikey", "请输入高德地图API密钥"},
+    {"MAC地址", "mac", "例如：AA:BB:CC:DD:EE:FF"},
+    {"夜间静默", "quiet", "例如：23:00-07:00，off 关闭"},
+};
+
+static_assert(sizeof(FormField) % 4 == 0, "FormField must be word aligned for PROGMEM reads");
+
+// 固件更新的 HTTP Basic 认证：用户名固定，密码保存在设备运行设置中
+#define UPDATE_USERNAME "admin"
+#define UPDATE_REALM "WeWeather"
+
+// 固件更新页面：浏览器通过 XHR 上传并显示进度和速率，校验值作为查询参数（上传开始前即可读取）
+const char UPDATE_PAGE[] PROGMEM = "<h1>固件更新</h1><div class=\"info\">选择编译生成的 firmware.bin 上传，可选填写 MD5 或 SHA-256 校验值。用户名 admin，密码通过串口 set otapass 设置。数据直接写入 OTA 分区，校验通过后设备自动重启；校验失败时当前固件不受影响。</div><div class=\"form-group\"><label>固件文件:</label><input type=\"file\" id=\"fw\" accept=\".bin\"></div><div class=\"form-group\"><label>MD5（可选）:</label><input type=\"text\" id=\"md5\"></div><div class=\"form-group\"><label>SHA-256（可选）:</label><input type=\"text\" id=\"sha\"></div><progress id=\"bar\" max=\"100\" value=\"0\" style=\"width:100%\"></progress><p id=\"msg\"></p><div class=\"btn-group\"><button type=\"button\" onclick=\"up()\">上传固件</button><button type=\"button\" class=\"exit-btn\" onclick=\"location.href='/config'\">返回配置</button></div><script>function v(i){return encodeURIComponent(document.getElementById(i).value.trim());}function up(){var f=document.getElementById('fw').files[0],m=document.getElementById('msg');if(!f){m.textContent='请选择固件文件';return;}var d=new FormData(),x=new XMLHttpRequest(),t=Date.now();d.append('firmware',f);x.upload.onprogress=function(e){if(e.lengthComputable){document.getElementById('bar').value=e.loaded*100/e.total;m.textContent=Math.round(e.loaded/1024)+' / '+Math.round(e.total/1024)+' KB, '+(e.loaded/1.024/(Date.now()-t+1)).toFixed(1)+' KB/s';}};x.onload=function(){m.textContent=x.responseText;};x.onerror=function(){m.textContent='上传失败';};x.open('POST','/update?md5='+v('md5')+'&sha256='+v('sha'));x.send(d);}</script>";
 
 const char SUCCESS_PAGE[] PROGMEM = "<h1 style=\"color:#4CAF50\">✓ 配置保存成功</h1><p>配置已保存，设备将在 <span id=\"countdown\" style=\"color:#f44336;font-weight:bold\">3</span> 秒后重启。</p><script>let c=3;setInterval(()=>{document.getElementById('countdown').textContent=--c;if(c<=0)document.body.innerHTML='<div class=\"container\"><h1>设备重启中...</h1></div>';},1000);</script>";
 
@@ -19,7 +52,7 @@ const char EXIT_PAGE[] PROGMEM = "<h1 style=\"color:#f44336\">正在退出配置
  * @param configMgr 配置管理器指针
  */
 WebConfigManager::WebConfigManager(ConfigManager<ConfigData>* configMgr)
-    : configManager(configMgr), webServer(nullptr), isConfigMode(false) {
+    : configManager(configMgr), quietHours(nullptr), idleTimeout(nullptr), deviceSettings(nullptr), webServer(nullptr), isConfigMode(false) {
 }
 
 /**
@@ -101,6 +134,14 @@ void WebConfigManager::handleClient() {
     }
 }
 
+/**
+ * @brief 是否有进行中的 HTTP 连接（正在接收请求或保持连接）
+ * @return true 如果有连接
+ */
+bool WebConfigManager::hasActiveClient() {
+    return webServer && isConfigMode && webServer->client().connected();
+}
+
 /**
  * @brief 设置Web路由
  */
@@ -119,6 +160,31 @@ void WebConfigManager::setupWebRoutes() {
     // 退出配置模式
     webServer->on("/exit", [this]() { handleExit(); });
     
+    // 运行指标
+    webServer->on("/metrics", HTTP_GET, [this]() { handleMetrics(); });
+    
+    // 固件更新：GET 返回上传页面，POST 的上传数据分块写入 OTA 分区，结束后返回结果
+    webServer->on("/update", HTTP_GET, [this]() { handleUpdatePage(); });
+    webServer->on("/update", HTTP_POST, [this]() { handleUpdateResult(); }, [this]() { handleUpdateUpload(); });
+    
+    // gzip 压缩的静态资源（样式表等）
+    for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+        const WebAsset* asset = &WEB_ASSETS[i];
+        webServer->on(asset->path, HTTP_GET, [this, asset]() { handleAsset(*asset); });
+    }
+    
+    // 每个请求在路由之前记录为配置模式的活动（包括 404）
+    webServer->addHook([this](const String&, const String&, WiFiClient*, ESP8266WebServer::ContentTypeFunction) {
+        if (idleTimeout != nullptr) {
+            idleTimeout->touch();
+        }
+        return ESP8266WebServer::CLIENT_REQUEST_CAN_CONTINUE;
+    });
+    
+    // 条件请求需要 If-None-Match，服务器默认不保留请求头
+    static const char* collectedHeaders[] = {"If-None-Match"};
+    webServer->collectHeaders(collectedHeaders, 1);
+    
     // 404处理
     webServer->onNotFound([this]() { handleNotFound(); });
 }
@@ -137,8 +203,7 @@ void WebConfigManager::handleRoot() {
  */
 void WebConfigManager::handleConfig() {
     LOG_INFO("Handling config page request");
-    String html = generateConfigPage();
-    webServer->send(200, "text/html", html);
+    sendConfigPage();
 }
 
 /**
@@ -185,14 +250,29 @@ void WebConfigManager::handleSave() {
         config.macAddress[sizeof(config.macAddress) - 1] = '\0';
     }
     
+    // 静默时段保存在独立的 EEPROM 记录中，格式无效时不保存任何配置
+    if (webServer->hasArg("quiet") && quietHours != nullptr) {
+        String quiet = webServer->arg("quiet");
+        QuietHoursConfig parsed;
+        if (!QuietHours::parse(quiet, parsed)) {
+            LOG_ERROR_F("Invalid quiet hours: %s", quiet.c_str());
+            sendPage(400, ERROR_PAGE);
+            return;
+        }
+        if (quiet != quietHours->format() && !quietHours->set(quiet)) {
+            LOG_ERROR("Failed to save quiet hours");
+            sendPage(500, ERROR_PAGE);
+            return;
+        }
+    }
+    
     // 保存配置
     bool success = configManager->write(config);
     
     if (success) {
         LOG_INFO("Configuration saved successfully");
         // 发送成功页面，然后自动退出配置模式
-        String html = generateSuccessPage();
-        webServer->send(200, "text/html", html);
+        sendPage(200, SUCCESS_PAGE);
         
         // 延迟3秒后自动退出配置模式，与串口模式保持一致
         delay(3000);
@@ -200,8 +280,7 @@ void WebConfigManager::handleSave() {
     } else {
         LOG_ERROR("Failed to save configuration");
         // 发送错误页面
-        String html = generateErrorPage();
-        webServer->send(500, "text/html", html);
+        sendPage(500, ERROR_PAGE);
     }
 }
 
@@ -210,14 +289,137 @@ void WebConfigManager::handleSave() {
  */
 void WebConfigManager::handleExit() {
     LOG_INFO("Handling exit request");
-    String html = generateExitPage();
-    webServer->send(200, "text/html", html);
+    sendPage(200, EXIT_PAGE);
     
     // 延迟退出配置模式
     delay(2000);
     exitConfigMode();
 }
 
+/**
+ * @brief 处理静态资源请求
+ * 直接从 Flash 发送 gzip 压缩的数据；浏览器缓存的 ETag 一致时只返回 304
+ * @param asset 静态资源
+ */
+void WebConfigManager::handleAsset(const WebAsset& asset) {
+    webServer->sendHeader("ETag", asset.etag);
+    webServer->sendHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
+    
+    if (webServer->header("If-None-Match").indexOf(asset.etag) >= 0) {
+        LOG_DEBUG_F("Asset %s not modified", asset.path);
+        webServer->send(304);
+        return;
+    }
+    
+    LOG_DEBUG_F("Sending asset %s (%u bytes gzip)", asset.path, asset.length);
+    webServer->sendHeader("Content-Encoding", "gzip");
+    webServer->send_P(200, asset.contentType, (PGM_P)asset.data, asset.length);
+}
+
+/**
+ * @brief 处理运行指标请求
+ * 以 Prometheus 文本格式输出 RTC 内存中的计数器、仪表和直方图
+ */
+void WebConfigManager::handleMetrics() {
+    LOG_INFO("Handling metrics request");
+    ChunkedResponse response(*webServer);
+    response.begin(200, "text/plain; version=0.0.4");
+    Metrics::printPrometheus(response);
+    response.end();
+}
+
+/**
+ * @brief 处理固件更新页面请求
+ */
+void WebConfigManager::handleUpdatePage() {
+    LOG_INFO("Handling update page request");
+    if (!isUpdateAuthorized()) {
+        rejectUpdate();
+        return;
+    }
+    sendPage(200, UPDATE_PAGE);
+}
+
+/**
+ * @brief 处理固件上传数据
+ * 服务器每收到一块（HTTP_UPLOAD_BUFLEN 字节）调用一次，数据直接写入 OTA 分区
+ */
+void WebConfigManager::handleUpdateUpload() {
+    HTTPUpload& upload = webServer->upload();
+    switch (upload.status) {
+        case UPLOAD_FILE_START:
+            // 未认证时不开始更新，后续数据块因没有进行中的更新而被丢弃
+            if (!isUpdateAuthorized()) {
+                LOG_WARN("Firmware upload rejected: not authorized");
+                break;
+            }
+            LOG_INFO_F("Firmware upload started: %s", upload.filename.c_str());
+            firmwareUpdate.begin(webServer->arg("md5"), webServer->arg("sha256"));
+            break;
+        case UPLOAD_FILE_WRITE:
+            firmwareUpdate.write(upload.buf, upload.currentSize);
+            break;
+        case UPLOAD_FILE_END:
+            firmwareUpdate.end();
+            break;
+        case UPLOAD_FILE_ABORTED:
+            firmwareUpdate.abort();
+            break;
+    }
+}
+
+/**
+ * @brief 上传结束后返回结果
+ * 成功时返回字节数、耗时和速率后重启，由 eboot 安装新固件
+ */
+void WebConfigManager::handleUpdateResult() {
+    if (!isUpdateAuthorized()) {
+        rejectUpdate();
+        return;
+    }
+    
+    bool success = firmwareUpdate.isSuccessful();
+    
+    ChunkedResponse response(*webServer);
+    response.begin(success ? 200 : 400, "text/plain");
+    firmwareUpdate.printResult(response);
+    response.end();
+    firmwareUpdate.reset();
+    
+    if (success) {
+        LOG_INFO("Restarting to install new firmware...");
+        delay(1000);
+        stopWebServer();
+        isConfigMode = false;
+        ESP.restart();
+    }
+}
+
+/**
+ * @brief 检查固件更新密码
+ * 配置热点不加密，任何连上热点的设备都能访问 /update，没有密码时禁用固件更新
+ * @return 设置了密码且请求的 Basic 认证正确
+ */
+bool WebConfigManager::isUpdateAuthorized() {
+    if (deviceSettings == nullptr || !deviceSettings->isUpdateEnabled()) {
+        return false;
+    }
+    return webServer->authenticate(UPDATE_USERNAME, deviceSettings->getUpdatePassword());
+}
+
+/**
+ * @brief 拒绝未认证的固件更新请求
+ * 设置了密码时返回 401 要求浏览器输入密码，否则返回 403
+ */
+void WebConfigManager::rejectUpdate() {
+    if (deviceSettings == nullptr || !deviceSettings->isUpdateEnabled()) {
+        LOG_WARN("Firmware update disabled: no update password");
+        webServer->send(403, "text/plain", F("ERROR firmware update disabled, set otapass over serial first"));
+        return;
+    }
+    webServer->requestAuthentication(BASIC_AUTH, UPDATE_REALM, F("ERROR authentication required"));
+}
+
 /**
  * @brief 处理404请求
  */
@@ -240,69 +442,67 @@ void WebConfigManager::handleNotFound() {
 }
 
 /**
- * @brief 生成配置页面HTML
+ * @brief 流式发送配置页面
+ * 页面片段直接从 Flash 发送，配置值转义后经小缓冲区发送，不拼接整个页面
  */
-String WebConfigManager::generateConfigPage() {
-    // 读取当前配置
+void WebConfigManager::sendConfigPage() {
+    // 读取当前配置，无效时各字段为空
     ConfigData config;
-    bool configValid = configManager->read(config);
+    if (!configManager->read(config)) {
+        memset(&config, 0, sizeof(config));
+    }
+    String quiet = quietHours != nullptr ? quietHours->format() : String();
     
-    // 使用栈上的缓冲区，避免动态分配
-    char buffer[1200];  // 足够容纳整个页面
+    // 与 CONFIG_FIELDS 顺序一致
+    const char* values[] = {config.wifiSSID, config.wifiPassword, config.cityCode, config.amapApiKey, config.macAddress, quiet.c_str()};
+    static_assert(sizeof(values) / sizeof(values[0]) == sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]), "Field values must match CONFIG_FIELDS");
     
-    // 准备配置值，如果无效则使用空字符串
-    const char* ssid = configValid ? config.wifiSSID : "";
-    const char* password = configValid ? config.wifiPassword : "";
-    const char* citycode = configValid ? config.cityCode : "";
-    const char* apikey = configValid ? config.amapApiKey : "";
-    const char* mac = configValid ? config.macAddress : "";
+    // 页面中包含 WiFi 密码等配置，不允许浏览器缓存
+    webServer->sendHeader("Cache-Control", "no-store");
     
-    // 使用sprintf格式化页面内容
-    snprintf_P(buffer, sizeof(buffer), CONFIG_FORM, ssid, password, citycode, apikey, mac);
+    ChunkedResponse response(*webServer);
+    response.begin(200, "text/html");
+    response.sendP(HTML_HEAD);
+    response.sendP(CONFIG_FORM_BEGIN);
     
-    String html;
-    html.reserve(1400);  // 预分配内存
-    html += FPSTR(HTML_HEAD);
-    html += buffer;
-    html += FPSTR(HTML_FOOT);
+    // 配置模式空闲超时的剩余时间
+    if (idleTimeout != nullptr && idleTimeout->isEnabled()) {
+        uint32_t remaining = idleTimeout->getRemainingSeconds();
+        response.printf_P(IDLE_NOTICE, remaining / 60, remaining % 60, remaining);
+    }
     
-    return html;
-}
-
-/**
- * @brief 生成成功页面HTML
- */
-String WebConfigManager::generateSuccessPage() {
-    String html;
-    html.reserve(800);
-    html += FPSTR(HTML_HEAD);
-    html += FPSTR(SUCCESS_PAGE);
-    html += FPSTR(HTML_FOOT);
-    return html;
-}
-
-/**
- * @brief 生成错误页面HTML
- */
-String WebConfigManager::generateErrorPage() {
-    String html;
-    html.reserve(600);
-    html += FPSTR(HTML_HEAD);
-    html += FPSTR(ERROR_PAGE);
-    html += FPSTR(HTML_FOOT);
-    return html;
+    for (size_t i = 0; i < sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]); i++) {
+        FormField field;
+        memcpy_P(&field, &CONFIG_FIELDS[i], sizeof(field));
+        
+        // 未设置静默时段时不显示该字段
+        if (strcmp(field.name, "quiet") == 0 && quietHours == nullptr) {
+            continue;
+        }
+        
+        response.printf_P(PSTR("<div class=\"form-group\"><label>%s:</label><input type=\"text\" name=\"%s\" value=\""),
+                          field.label, field.name);
+        response.printEscaped(values[i]);
+        response.printf_P(PSTR("\" placeholder=\"%s\"></div>"), field.placeholder);
+    }
+    
+    response.sendP(CONFIG_FORM_END);
+    response.sendP(HTML_FOOT);
+    response.end();
 }
 
 /**
- * @brief 生成退出页面HTML
+ * @brief 流式发送固定页面
+ * @param code HTTP 状态码
+ * @param body 页面主体（PROGMEM）
  */
-String WebConfigManager::generateExitPage() {
-    String html;
-    html.reserve(700);
-    html += FPSTR(HTML_HEAD);
-    html += FPSTR(EXIT_PAGE);
-    html += FPSTR(HTML_FOOT);
-    return html;
+void WebConfigManager::sendPage(int code, PGM_P body) {
+    ChunkedResponse response(*webServer);
+    response.begin(code, "text/html");
+    response.sendP(HTML_HEAD);
+    response.sendP(body);
+    response.sendP(HTML_FOOT);
+    response.end();
 }
 
 /**
@@ -342,4 +542,28 @@ bool WebConfigManager::isInConfigMode() const {
  */
 void WebConfigManager::setConfigMode(bool enabled) {
     isConfigMode = enabled;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 设置夜间静默时段，配置页面显示静默时段输入框
+ * @param quiet 静默时段指针
+ */
+void WebConfigManager::setQuietHours(QuietHours* quiet) {
+    quietHours = quiet;
+}
+
+/**
+ * @brief 设置配置模式空闲超时，每个 HTTP 请求都记录为活动，配置页面显示剩余时间
+ * @param timeout 空闲超时计时器指针
+ */
+void WebConfigManager::setIdleTimeout(IdleTimeout* timeout) {
+    idleTimeout = timeout;
+}
+
+/**
+ * @brief 设置设备运行设置，固件更新使用其中的密码认证
+ * @param settings 设备运行设置指针
+ */
+void WebConfigManager::setDeviceSettings(DeviceSettings* settings) {
+    deviceSettings = settings;
+}
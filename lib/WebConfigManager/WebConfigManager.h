@@ -6,6 +6,13 @@
 #include <ESP8266WebServer.h>
 #include "../../config.h"
 #include "../ConfigManager/ConfigManager.h"
+#include "../QuietHours/QuietHours.h"
+#include "../Metrics/Metrics.h"
+#include "../IdleTimeout/IdleTimeout.h"
+#include "../DeviceSettings/DeviceSettings.h"
+#include "FirmwareUpdate.h"
+
+struct WebAsset;
 
 /**
  * @brief Web配置管理类
@@ -14,12 +21,17 @@
  * - Web服务器初始化和路由处理
  * - 配置参数的Web界面显示、设置和保存
  * - 配置请求的处理
+ * - 固件上传更新（/update）
  */
 class WebConfigManager {
 private:
     ConfigManager<ConfigData>* configManager;  // 配置管理器指针
+    QuietHours* quietHours;                    // 夜间静默时段（可选）
+    IdleTimeout* idleTimeout;                  // 配置模式空闲超时（可选）
+    DeviceSettings* deviceSettings;            // 设备运行设置（固件更新密码，未设置时禁用固件更新）
     ESP8266WebServer* webServer;               // Web服务器指针
     bool isConfigMode;                         // 是否处于配置模式
+    FirmwareUpdate firmwareUpdate;             // 进行中的固件更新
     
     // 私有方法
     void setupWebRoutes();                     // 设置Web路由
@@ -27,11 +39,16 @@ private:
     void handleConfig();                       // 处理配置页面请求
     void handleSave();                         // 处理保存配置请求
     void handleExit();                         // 处理退出配置请求
+    void handleMetrics();                      // 处理运行指标请求（Prometheus 文本格式）
+    void handleUpdatePage();                   // 处理固件更新页面请求
+    void handleUpdateUpload();                 // 处理固件上传数据（分块写入 OTA 分区）
+    void handleUpdateResult();                 // 上传结束后返回结果，成功时重启
+    bool isUpdateAuthorized();                 // 请求是否带有正确的固件更新密码（HTTP Basic 认证）
+    void rejectUpdate();                       // 拒绝未认证的固件更新请求（401 或禁用时 403）
+    void handleAsset(const WebAsset& asset);   // 处理静态资源请求（gzip、ETag）
     void handleNotFound();                     // 处理404请求
-    String generateConfigPage();               // 生成配置页面HTML
-    String generateSuccessPage();              // 生成成功页面HTML
-    String generateErrorPage();                // 生成错误页面HTML
-    String generateExitPage();                 // 生成退出页面HTML
+    void sendConfigPage();                     // 流式发送配置页面
+    void sendPage(int code, PGM_P body);       // 流式发送固定页面（页头 + 主体 + 页尾）
     
 public:
     /**
@@ -70,6 +87,31 @@ public:
      */
     void handleClient();
     
+    /**
+     * @brief 是否有进行中的 HTTP 连接（正在接收请求或保持连接）
+     * 有连接时主循环应尽快再次调用 handleClient()
+     * @return true 如果有连接
+     */
+    bool hasActiveClient();
+    
+    /**
+     * @brief 设置夜间静默时段，配置页面显示静默时段输入框
+     * @param quiet 静默时段指针
+     */
+    void setQuietHours(QuietHours* quiet);
+    
+    /**
+     * @brief 设置配置模式空闲超时，每个 HTTP 请求都记录为活动，配置页面显示剩余时间
+     * @param timeout 空闲超时计时器指针
+     */
+    void setIdleTimeout(IdleTimeout* timeout);
+    
+    /**
+     * @brief 设置设备运行设置，固件更新使用其中的密码认证
+     * @param settings 设备运行设置指针，未设置或没有密码时禁用固件更新
+     */
+    void setDeviceSettings(DeviceSettings* settings);
+    
     /**
      * @brief 退出配置模式
      * 停止Web服务器，重启系统以应用新配置
@@ -1,6 +1,7 @@
 #include "WiFiManager.h"
 #include "../../config.h"
 #include "../LogManager/LogManager.h"
+#include "../Metrics/Metrics.h"
 
 extern "C" {
 #include "user_interface.h"
@@ -41,7 +42,7 @@ void WiFiManager::setDefaultConfig() {
 void WiFiManager::setCredentials(const char* ssid, const char* password) {
   _copyString(_config.ssid, ssid, sizeof(_config.ssid));
   _copyString(_config.password, password, sizeof(_config.password));
-  LogManager::info(String(F("WiFi credentials updated for SSID: ")) + _config.ssid);
+  LOG_INFO_F("WiFi credentials updated for SSID: %s", _config.ssid);
 }
 
 void WiFiManager::setConfig(const WiFiConfig& config) {
@@ -65,7 +66,7 @@ bool WiFiManager::connect(unsigned long timeout) {
   }
 
   if (_config.useMacAddress && strlen(_config.macAddress) > 0) {
-    LogManager::info(String(F("Setting custom MAC address: ")) + _config.macAddress);
+    LOG_INFO_F("Setting custom MAC address: %s", _config.macAddress);
     uint8_t mac[6];
     if (_parseMacAddress(_config.macAddress, mac)) {
       if (wifi_set_macaddr(STATION_IF, mac)) {
@@ -80,7 +81,7 @@ bool WiFiManager::connect(unsigned long timeout) {
 
   unsigned long connectTimeout = (timeout == 0) ? _config.timeout : timeout;
 
-  LogManager::info(String(F("Connecting to WiFi: ")) + _config.ssid);
+  LOG_INFO_F("Connecting to WiFi: %s", _config.ssid);
   WiFi.begin(_config.ssid, _config.password);
 
   return _waitForConnection(connectTimeout);
@@ -108,15 +109,15 @@ bool WiFiManager::scanAndConnect(unsigned long timeout) {
     return false;
   }
 
-  LogManager::info(String(n) + F(" networks found"));
+  LOG_INFO_F("%d networks found", n);
 
   for (int i = 0; i < n; ++i) {
     _printNetworkInfo(i);
     if (WiFi.SSID(i) == String(_config.ssid)) {
-      LogManager::info(String(F("Found target network: ")) + _config.ssid);
+      LOG_INFO_F("Found target network: %s", _config.ssid);
 
       if (_config.useMacAddress && strlen(_config.macAddress) > 0) {
-        LogManager::info(String(F("Setting custom MAC address: ")) + _config.macAddress);
+        LOG_INFO_F("Setting custom MAC address: %s", _config.macAddress);
         uint8_t mac[6];
         if (_parseMacAddress(_config.macAddress, mac)) {
           if (wifi_set_macaddr(STATION_IF, mac)) {
@@ -135,7 +136,7 @@ bool WiFiManager::scanAndConnect(unsigned long timeout) {
     }
   }
 
-  LogManager::warn(String(F("Target network not found: ")) + _config.ssid);
+  LOG_WARN_F("Target network not found: %s", _config.ssid);
   return false;
 }
 
@@ -149,7 +150,7 @@ bool WiFiManager::autoConnect() {
   bool connected = false;
 
   while (retries < _config.maxRetries && !connected) {
-    LogManager::info(String(F("Auto-connect attempt ")) + String(retries + 1) + F("/") + String(_config.maxRetries));
+    LOG_INFO_F("Auto-connect attempt %d/%d", retries + 1, _config.maxRetries);
     connected = scanAndConnect();
 
     if (!connected && _config.autoReconnect) {
@@ -166,7 +167,7 @@ bool WiFiManager::autoConnect() {
   if (connected) {
     LOG_INFO("Auto-connect successful");
   } else {
-    LogManager::warn(String(F("Auto-connect failed after ")) + String(_config.maxRetries) + F(" attempts"));
+    LOG_WARN_F("Auto-connect failed after %d attempts", _config.maxRetries);
   }
 
   return connected;
@@ -225,7 +226,7 @@ void WiFiManager::setMaxRetries(int retries) {
 
 void WiFiManager::setMacAddress(const char* macAddress) {
   _copyString(_config.macAddress, macAddress, sizeof(_config.macAddress));
-  LogManager::info(String(F("MAC address updated: ")) + _config.macAddress);
+  LOG_INFO_F("MAC address updated: %s", _config.macAddress);
 }
 
 String WiFiManager::getMacAddress() {
@@ -237,7 +238,7 @@ String WiFiManager::getMacAddress() {
 
 void WiFiManager::enableMacAddress(bool enable) {
   _config.useMacAddress = enable;
-  LogManager::info(String(F("Custom MAC address ")) + String(enable ? F("enabled") : F("disabled")));
+  LOG_INFO_F("Custom MAC address %s", enable ? "enabled" : "disabled");
 }
 
 String WiFiManager::getStatusString() {
@@ -260,42 +261,44 @@ String WiFiManager::getStatusString() {
 }
 
 void WiFiManager::printConfig() {
-  LogManager::info(F("=== WiFi Configuration ==="));
-  LogManager::info(String(F("SSID: ")) + _config.ssid);
-  LogManager::info(String(F("password: ")) + String(_config.password[0] ? F("***") : F("Not set")));
-  LogManager::info(String(F("Timeout: ")) + String(_config.timeout) + F("ms"));
-  LogManager::info(String(F("Auto Reconnect: ")) + String(_config.autoReconnect ? F("Enabled") : F("Disabled")));
-  LogManager::info(String(F("Max Retries: ")) + String(_config.maxRetries));
-  String macDisplay = _config.useMacAddress ? String(_config.macAddress) : String(F("Default"));
-  LogManager::info(String(F("MAC Address: ")) + macDisplay);
-  LogManager::info(String(F("Use Custom MAC: ")) + String(_config.useMacAddress ? F("Yes") : F("No")));
-  LogManager::info(F("========================"));
+  LOG_INFO("=== WiFi Configuration ===");
+  LOG_INFO_F("SSID: %s", _config.ssid);
+  LOG_INFO_F("password: %s", _config.password[0] ? "***" : "Not set");
+  LOG_INFO_F("Timeout: %lums", _config.timeout);
+  LOG_INFO_F("Auto Reconnect: %s", _config.autoReconnect ? "Enabled" : "Disabled");
+  LOG_INFO_F("Max Retries: %d", _config.maxRetries);
+  LOG_INFO_F("MAC Address: %s", _config.useMacAddress ? _config.macAddress : "Default");
+  LOG_INFO_F("Use Custom MAC: %s", _config.useMacAddress ? "Yes" : "No");
+  LOG_INFO("========================");
 }
 
 void WiFiManager::_printNetworkInfo(int networkIndex) {
-  LogManager::info(String(networkIndex + 1) + F(": ") + WiFi.SSID(networkIndex) +
-                   F(" (") + String(WiFi.RSSI(networkIndex)) + F(")") +
-                   String((WiFi.encryptionType(networkIndex) == ENC_TYPE_NONE) ? F(" ") : F("*")));
+  LOG_INFO_F("%d: %s (%d)%s", networkIndex + 1, WiFi.SSID(networkIndex).c_str(), WiFi.RSSI(networkIndex),
+             (WiFi.encryptionType(networkIndex) == ENC_TYPE_NONE) ? " " : "*");
 }
 
 bool WiFiManager::_waitForConnection(unsigned long timeout) {
   unsigned long startAttemptTime = millis();
+  Metrics::increment(METRIC_WIFI_ATTEMPTS);
 
   while (WiFi.status() != WL_CONNECTED && millis() - startAttemptTime < timeout) {
     delay(100);
-    LogManager::debug(F("."));
+    LOG_DEBUG(".");
   }
 
   if (WiFi.status() == WL_CONNECTED) {
-    LogManager::info(F(""));
+    Metrics::observe(METRIC_WIFI_CONNECT, millis() - startAttemptTime);
+    Metrics::set(METRIC_WIFI_RSSI, WiFi.RSSI());
+    LOG_INFO("");
     LOG_INFO("WiFi connected successfully");
-    LogManager::info(String(F("IP address: ")) + WiFi.localIP().toString());
-    LogManager::info(String(F("Signal strength: ")) + String(WiFi.RSSI()) + F(" dBm"));
+    LOG_INFO_F("IP address: %s", WiFi.localIP().toString().c_str());
+    LOG_INFO_F("Signal strength: %d dBm", WiFi.RSSI());
     return true;
   } else {
-    LogManager::info(F(""));
+    Metrics::increment(METRIC_WIFI_FAILURES);
+    LOG_INFO("");
     LOG_WARN("Failed to connect to WiFi");
-    LogManager::warn(String(F("Status: ")) + getStatusString());
+    LOG_WARN_F("Status: %s", getStatusString().c_str());
     return false;
   }
 }
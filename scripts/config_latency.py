@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+配置模式响应延迟测量工具
+
+配置模式的主循环在两次处理之间等待事件（串口数据、进行中的 HTTP 连接）或检查新连接的间隔，
+等待方式和间隔（CONFIG_LOOP_POLL_MS 等）决定了请求在设备上排队的时间。本工具连接设备热点后
+重复请求配置页面和静态资源，可选地通过串口发送空命令，统计往返延迟的最小值、中位数、P95 和最大值，
+用于比较修改主循环前后的响应速度。
+
+每次 HTTP 请求使用新连接（Connection: close），包含建立 TCP 连接的时间，与浏览器第一次打开页面相同；
+两次请求之间间隔 --interval 秒，使设备回到空闲等待状态。串口延迟为发送换行到收到
+"Received command" 回显的时间。
+
+空闲电流需要用电流表串联在电源上测量，本工具不涉及。
+
+用法：
+  python3 scripts/config_latency.py                              # 默认测量 http://192.168.4.1
+  python3 scripts/config_latency.py --count 50 --interval 0.5
+  python3 scripts/config_latency.py --port /dev/ttyUSB0          # 同时测量串口命令的响应延迟
+"""
+
+import argparse
+import http.client
+import statistics
+import sys
+import time
+
+DEFAULT_HOST = "192.168.4.1"
+
+# 要测量的路径（配置页面为分块流式响应，样式表为 gzip 静态资源）
+DEFAULT_PATHS = ["/config", "/style.css"]
+
+# 串口参数（与 config.h 中 SERIAL_BAUD_RATE 一致）
+DEFAULT_BAUD = 74880
+
+# processInput() 收到任意一行（包括空行）时的回显
+SERIAL_ECHO = "Received command"
+
+REQUEST_TIMEOUT = 10
+
+
+def measure_http(host, path):
+    """返回一次请求的往返时间（毫秒），包括建立连接和读取完整响应"""
+    start = time.perf_counter()
+    conn = http.client.HTTPConnection(host, timeout=REQUEST_TIMEOUT)
+    try:
+        conn.request("GET", path, headers={"Connection": "close", "Accept-Encoding": "gzip"})
+        response = conn.getresponse()
+        response.read()
+        if response.status != 200:
+            raise RuntimeError("%s 返回 %d" % (path, response.status))
+    finally:
+        conn.close()
+    return (time.perf_counter() - start) * 1000
+
+
+def measure_serial(conn):
+    """返回发送空命令到收到回显的时间（毫秒）"""
+    conn.reset_input_buffer()
+    start = time.perf_counter()
+    conn.write(b"\n")
+    deadline = start + REQUEST_TIMEOUT
+    while time.perf_counter() < deadline:
+        line = conn.readline().decode("utf-8", "replace")
+        if SERIAL_ECHO in line:
+            return (time.perf_counter() - start) * 1000
+    raise RuntimeError("等待串口回显超时，请确认设备处于配置模式")
+
+
+def summarize(name, samples):
+    ordered = sorted(samples)
+    p95 = ordered[min(len(ordered) - 1, int(round(0.95 * (len(ordered) - 1))))]
+    print("%-12s n=%-4d min=%7.1f  median=%7.1f  p95=%7.1f  max=%7.1f ms" %
+          (name, len(ordered), ordered[0], statistics.median(ordered), p95, ordered[-1]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="测量配置模式下 HTTP 和串口命令的响应延迟")
+    parser.add_argument("--host", default=DEFAULT_HOST, help="设备地址（可带端口，例如 192.168.4.1:80）")
+    parser.add_argument("--path", action="append", help="要测量的路径，可重复，默认 /config 和 /style.css")
+    parser.add_argument("--count", type=int, default=20, help="每项的测量次数")
+    parser.add_argument("--interval", type=float, default=1.0, help="两次测量之间的间隔（秒）")
+    parser.add_argument("--port", help="串口设备，指定时同时测量串口命令的响应延迟")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD, help="串口波特率")
+    args = parser.parse_args()
+
+    paths = args.path or DEFAULT_PATHS
+    results = {path: [] for path in paths}
+
+    serial_conn = None
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("需要 pyserial：pip install pyserial")
+        serial_conn = serial.Serial(args.port, args.baud, timeout=1)
+        results["serial"] = []
+
+    try:
+        for _ in range(args.count):
+            for path in paths:
+                results[path].append(measure_http(args.host, path))
+                time.sleep(args.interval)
+            if serial_conn is not None:
+                results["serial"].append(measure_serial(serial_conn))
+                time.sleep(args.interval)
+    except (OSError, RuntimeError) as e:
+        sys.exit("测量失败：%s" % e)
+    finally:
+        if serial_conn is not None:
+            serial_conn.close()
+
+    for name, samples in results.items():
+        summarize(name, samples)
+
+
+if __name__ == "__main__":
+    main()
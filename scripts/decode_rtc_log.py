@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+RTC 内存二进制日志解码工具
+
+日志输出设为 rtc 时（config.h 中的 DEFAULT_LOG_OUTPUT 或串口 set log rtc），正常唤醒的
+日志以二进制记录保存在 RTC 内存日志环中（见 lib/LogRing），记录只包含格式字符串在 Flash 中的地址和参数。配置模式下串口命令 `logs raw` 以一行
+十六进制输出日志环：
+
+  RTCLOG <buildId> <head|used|wake|dropped> <33 个数据字>
+
+本工具从生成该记录的固件 ELF 文件中查找格式字符串，还原日志文本。设备上的 `logs`
+命令只能解码当前固件写入的记录，固件更新后需要用旧固件的 ELF 文件和本工具解码。
+
+用法：
+  python3 scripts/decode_rtc_log.py --input capture.log
+  python3 scripts/decode_rtc_log.py --input capture.log --elf .pio/build/nodemcu/firmware.elf
+  pio device monitor | python3 scripts/decode_rtc_log.py
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+DEFAULT_ELF = ".pio/build/nodemcu/firmware.elf"
+MARKER = "RTCLOG"
+
+# 与 LogRing.h / LogRing.cpp 保持一致
+RING_WORDS = 33
+MAX_ARGS = 4
+INLINE_TAG = 0xFF000000
+KIND_FORMAT, KIND_TEXT, KIND_INLINE = 0, 1, 2
+LEVELS = ["NONE ", "ERROR", "WARN ", "INFO ", "DEBUG"]
+
+# printf 转换说明：标志、宽度、精度、长度修饰符和转换符
+SPEC_RE = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|j|t)?([diouxXcsfFeEgGp%])")
+
+
+def project_dir():
+    return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+class Elf(object):
+    """只读取节头，按虚拟地址查找以 NUL 结尾的字符串"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % path)
+        is64 = self.data[4] == 2
+        endian = "<" if self.data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(endian + "Q", self.data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + "HH", self.data, 0x3A)
+            header = endian + "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", self.data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + "HH", self.data, 0x2E)
+            header = endian + "IIIIIIIIII"
+
+        self.sections = []
+        for i in range(shnum):
+            fields = struct.unpack_from(header, self.data, shoff + i * shentsize)
+            sh_type, addr, offset, size = fields[1], fields[3], fields[4], fields[5]
+            if sh_type == 1 and addr != 0:  # SHT_PROGBITS 且加载到内存
+                self.sections.append((addr, offset, size))
+
+    def string(self, address):
+        for addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self.data.find(b"\0", start, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[start:end].decode("utf-8", "replace")
+        return None
+
+
+def decode_string(elf, value):
+    if value == 0:
+        return "(null)"
+    if value & 0xFF000000 == INLINE_TAG:
+        # RAM 字符串只保存了前 3 个字符
+        text = bytes((value >> (8 * i)) & 0xFF for i in range(3)).split(b"\0")[0].decode("utf-8", "replace")
+        return text + ".." if len(text) == 3 else text
+    text = elf.string(value)
+    return text if text is not None else "?"
+
+
+def format_record(elf, fmt, args):
+    values = iter(args)
+
+    def convert(match):
+        flags, conversion = match.group(1), match.group(2)
+        if conversion == "%":
+            return "%"
+        value = next(values, None)
+        if value is None:
+            return "<?>"
+        if conversion in "fFeEgG":
+            return ("%" + flags + conversion) % struct.unpack("<f", struct.pack("<I", value))[0]
+        if conversion == "s":
+            return ("%" + flags + "s") % decode_string(elf, value)
+        if conversion == "c":
+            return ("%" + flags + "c") % chr(value & 0xFF)
+        if conversion == "p":
+            return "0x%08x" % value
+        if conversion in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            return ("%" + flags + "d") % value
+        return ("%" + flags + conversion.replace("u", "d")) % value
+
+    return SPEC_RE.sub(convert, fmt)
+
+
+def decode_ring(elf, words):
+    if len(words) < 2 + RING_WORDS:
+        raise ValueError("expected %d words, got %d" % (2 + RING_WORDS, len(words)))
+
+    build_id = words[0]
+    head, used, wake, dropped = struct.unpack("<BBBB", struct.pack("<I", words[1]))
+    ring = words[2:2 + RING_WORDS]
+    lines = ["build %08x, last wake #%u, %u dropped" % (build_id, wake, dropped)]
+
+    offset = 0
+    while offset < used:
+        header = ring[(head + offset) % RING_WORDS]
+        level = header & 0x07
+        kind = (header >> 3) & 0x03
+        argc = min((header >> 5) & 0x07, MAX_ARGS)
+        record = [ring[(head + offset + i) % RING_WORDS] for i in range(2 + argc)]
+        offset += 2 + ((header >> 5) & 0x07)
+
+        if kind == KIND_FORMAT:
+            fmt = elf.string(record[1])
+            text = format_record(elf, fmt, record[2:]) if fmt is not None else "<format 0x%08x not found>" % record[1]
+        elif kind == KIND_TEXT:
+            text = elf.string(record[1])
+            if text is None:
+                text = "<text 0x%08x not found>" % record[1]
+        else:
+            text = b"".join(struct.pack("<I", w) for w in record[2:]).split(b"\0")[0].decode("utf-8", "replace")
+
+        lines.append("[#%03u %5ums] [%s] %s" % ((header >> 8) & 0xFF, header >> 16,
+                                              LEVELS[level] if level < len(LEVELS) else "?    ", text))
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description="RTC 内存二进制日志解码")
+    parser.add_argument("--input", help="包含 logs raw 输出的串口日志文件，默认读取标准输入")
+    parser.add_argument("--elf", default=os.path.join(project_dir(), DEFAULT_ELF), help="写入日志的固件 ELF 文件")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    source = open(args.input, "r", errors="replace") if args.input else sys.stdin
+    found = False
+    for line in source:
+        index = line.find(MARKER)
+        if index < 0:
+            continue
+        words = [int(w, 16) for w in line[index + len(MARKER):].split()]
+        for text in decode_ring(elf, words):
+            print(text)
+        found = True
+
+    if not found:
+        print("No %s line found" % MARKER, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
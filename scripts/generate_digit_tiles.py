@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+时钟数字瓦片和字体度量生成工具
+
+将 DSEG7Modern_Bold28pt7b 中的 0-9、冒号和空白预先栅格化为墨水屏原生方向
+（旋转 1）的 1bpp 瓦片，每个瓦片按行字节对齐，运行时 GDEY029T94 只需逐行
+memcpy 即可绘制时间，不再逐像素解码字形。
+
+同时从界面使用的各个字体的字形表生成 FontMetrics.h，DisplayLayout.h 用这些
+度量推导布局并用 static_assert 检查重叠。
+
+用法：
+  python3 scripts/generate_digit_tiles.py          # 手动生成
+  platformio.ini 中 extra_scripts = pre:scripts/generate_digit_tiles.py  # 编译前自动生成
+"""
+
+import os
+import re
+import sys
+
+# 字体与输出文件（相对于项目根目录），使用 scripts/subset_fonts.py 生成的子集，
+# 与运行时 setTimeFont() 传入的字体一致
+FONT_FILE = "lib/Fonts/subset/DSEG7Modern_Bold28pt7b.h"
+OUTPUT_FILE = "lib/GDEY029T94/DigitTiles.h"
+
+# 屏幕原生尺寸（竖向），旋转 1 时逻辑坐标 (x, y) 对应原生 (NATIVE_WIDTH - 1 - y, x)
+NATIVE_WIDTH = 128
+NATIVE_HEIGHT = 296
+
+# 布局参数来源（LAYOUT_TOP_LINE_Y、LAYOUT_TIME_GAP）
+LAYOUT_FILE = "lib/GDEY029T94/DisplayLayout.h"
+LAYOUT_TEXT = "00:00"  # 计算时间高度时使用的固定字符串
+
+# 需要生成瓦片的字符，空白使用数字宽度
+TILE_CHARS = "0123456789:"
+BLANK_CHAR = " "
+
+# 字体度量输出文件，以及 (常量名, 字体文件, 说明)
+METRICS_FILE = "lib/GDEY029T94/FontMetrics.h"
+METRICS_FONTS = [
+    ("CLOCK_FONT_METRICS", "lib/Fonts/subset/DSEG7Modern_Bold28pt7b.h", "DSEG7Modern_Bold28pt7b 数字和冒号"),
+    ("LARGE_CLOCK_FONT_METRICS", "lib/Fonts/subset/DSEG7Modern_Bold42pt7b.h", "DSEG7Modern_Bold42pt7b 数字和冒号"),
+    ("SYMBOL_FONT_METRICS", "lib/Fonts/subset/Weather_Symbols_Regular9pt7b.h", "Weather_Symbols_Regular9pt7b（advance 为最宽字形的宽度）"),
+]
+
+# 小字体来自 Adafruit GFX 库（GxEPD2 的依赖，由 PlatformIO 安装到 libdeps）
+SMALL_FONT_NAME = "SMALL_FONT_METRICS"
+SMALL_FONT_FILE = os.path.join("Adafruit GFX Library", "Fonts", "FreeMonoBold9pt7b.h")
+SMALL_FONT_NOTE = "FreeMonoBold9pt7b（等宽）"
+
+
+def project_dir():
+    """获取项目根目录（兼容 PlatformIO 预编译脚本和直接运行）"""
+    try:
+        Import("env")  # noqa: F821  PlatformIO (SCons) 环境中提供
+        return env.subst("$PROJECT_DIR")  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+
+def parse_font(path):
+    """解析 Adafruit GFX 字体头文件，返回 (位图, 字形表, 首字符, yAdvance)"""
+    with open(path, "r", encoding="utf-8") as f:
+        source = f.read()
+
+    bitmap_match = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", source, re.S)
+    glyph_match = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", source, re.S)
+    font_match = re.search(r"\(GFXglyph\s*\*\)\s*\w+,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)\s*\}", source)
+    if not bitmap_match or not glyph_match or not font_match:
+        raise ValueError("无法解析字体文件: %s" % path)
+
+    bitmaps = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_match.group(1))]
+    glyphs = [tuple(int(v) for v in g)
+              for g in re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}",
+                                  glyph_match.group(1))]
+    first = int(font_match.group(1), 0)
+    y_advance = int(font_match.group(3))
+    return bitmaps, glyphs, first, y_advance
+
+
+def find_small_font(root):
+    """在 PlatformIO 的 libdeps 目录中查找 FreeMonoBold9pt7b.h，找不到时返回 None"""
+    candidates = []
+    try:
+        candidates.append(os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), env.subst("$PIOENV"), SMALL_FONT_FILE))  # noqa: F821
+    except NameError:
+        pass
+    libdeps = os.path.join(root, ".pio", "libdeps")
+    if os.path.isdir(libdeps):
+        candidates += [os.path.join(libdeps, name, SMALL_FONT_FILE) for name in sorted(os.listdir(libdeps))]
+    for path in candidates:
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def font_metrics(path, symbol=False):
+    """按 DisplayLayout.h 中 FontMetrics 的定义从字形表计算度量
+
+    ascent/descent 为所有非空字形在基线以上/以下的最大像素行数；
+    数字字体的 advance、inkLeft、inkRight 取自 '0'，colonAdvance 取自 ':'；
+    符号字体按字形宽度右对齐，advance 取最宽的字形。
+    """
+    bitmaps, glyphs, first, _ = parse_font(path)
+    inked = [g for g in glyphs if g[1] > 0 and g[2] > 0]
+    if not inked:
+        raise ValueError("字体没有可见字形: %s" % path)
+    ascent = -min(g[5] for g in inked)
+    descent = max(g[5] + g[2] - 1 for g in inked)
+    if symbol:
+        return (max(g[1] for g in inked), ascent, descent, 0, 0, 0)
+
+    def glyph_of(ch):
+        index = ord(ch) - first
+        if index < 0 or index >= len(glyphs):
+            raise ValueError("%s 中缺少字符 '%s'" % (path, ch))
+        return glyphs[index]
+
+    zero = glyph_of("0")
+    return (zero[3], ascent, descent, glyph_of(":")[3], zero[4], zero[3] - zero[4] - zero[1])
+
+
+def committed_metrics(path, name):
+    """读取已生成的 FontMetrics.h 中某个字体的度量，不存在时返回 None"""
+    if not os.path.exists(path):
+        return None
+    with open(path, "r", encoding="utf-8") as f:
+        match = re.search(r"%s\s*=\s*\{([-\d,\s]+)\}" % name, f.read())
+    if not match:
+        return None
+    return tuple(int(v) for v in match.group(1).split(","))
+
+
+def generate_metrics(root):
+    output_path = os.path.join(root, METRICS_FILE)
+    small_path = find_small_font(root)
+
+    # 字体和脚本都未变化时跳过
+    sources = [os.path.join(root, path) for (_, path, _) in METRICS_FONTS] + [os.path.join(root, "scripts", "generate_digit_tiles.py")]
+    if small_path:
+        sources.append(small_path)
+    if os.path.exists(output_path):
+        output_time = os.path.getmtime(output_path)
+        if all(os.path.getmtime(p) <= output_time for p in sources if os.path.exists(p)):
+            return
+
+    # 小字体不在项目中，libdeps 尚未安装时沿用上次生成的值
+    if small_path:
+        small = font_metrics(small_path)
+        _, glyphs, _, _ = parse_font(small_path)
+        if any(g[3] != small[0] for g in glyphs):
+            raise ValueError("%s 不是等宽字体，drawText() 按字符数计算宽度" % small_path)
+    else:
+        small = committed_metrics(output_path, SMALL_FONT_NAME)
+        if small is None:
+            raise ValueError("找不到 %s，请先安装依赖（pio pkg install -e nodemcu）" % SMALL_FONT_FILE)
+        print("Font metrics: %s not installed, keeping %s from %s" % (SMALL_FONT_FILE, SMALL_FONT_NAME, METRICS_FILE))
+
+    metrics = [(SMALL_FONT_NAME, small, SMALL_FONT_NOTE)]
+    for (name, path, note) in METRICS_FONTS:
+        metrics.append((name, font_metrics(os.path.join(root, path), name == "SYMBOL_FONT_METRICS"), note))
+
+    write_metrics(output_path, metrics)
+    print("Font metrics: %s" % METRICS_FILE)
+
+
+def write_metrics(path, metrics):
+    lines = []
+    lines.append("// 由 scripts/generate_digit_tiles.py 根据字体字形表生成，请勿手动修改")
+    lines.append("#pragma once")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("// 字体度量（来自字形表）")
+    lines.append("struct FontMetrics {")
+    lines.append("  int16_t advance;       // 字符（数字）前进宽度")
+    lines.append("  int16_t ascent;        // 基线以上的像素行数")
+    lines.append("  int16_t descent;       // 基线以下的像素行数")
+    lines.append("  int16_t colonAdvance;  // 冒号前进宽度")
+    lines.append("  int16_t inkLeft;       // 数字左侧留白")
+    lines.append("  int16_t inkRight;      // 数字右侧留白")
+    lines.append("};")
+    for (name, values, note) in metrics:
+        lines.append("")
+        lines.append("// %s" % note)
+        lines.append("constexpr FontMetrics %s = {%s};" % (name, ", ".join(str(v) for v in values)))
+    lines.append("")
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+def parse_layout(path):
+    """读取 DisplayLayout.h 中的分隔线位置和时间间距"""
+    with open(path, "r", encoding="utf-8") as f:
+        source = f.read()
+
+    values = {}
+    for name in ("LAYOUT_TOP_LINE_Y", "LAYOUT_TIME_GAP"):
+        match = re.search(r"#define\s+%s\s+(\d+)" % name, source)
+        if not match:
+            raise ValueError("%s 中缺少 %s" % (path, name))
+        values[name] = int(match.group(1))
+    return values["LAYOUT_TOP_LINE_Y"], values["LAYOUT_TIME_GAP"]
+
+
+def glyph_pixels(bitmaps, glyph):
+    """解码字形位图，返回黑色像素的 (列, 行) 集合"""
+    offset, width, height = glyph[0], glyph[1], glyph[2]
+    pixels = set()
+    bit = 0
+    for row in range(height):
+        for col in range(width):
+            byte = bitmaps[offset + bit // 8]
+            if byte & (0x80 >> (bit % 8)):
+                pixels.add((col, row))
+            bit += 1
+    return pixels
+
+
+def generate(root):
+    font_path = os.path.join(root, FONT_FILE)
+    layout_path = os.path.join(root, LAYOUT_FILE)
+    output_path = os.path.join(root, OUTPUT_FILE)
+
+    # 字体、布局和脚本都未变化时跳过
+    if os.path.exists(output_path):
+        output_time = os.path.getmtime(output_path)
+        script_path = os.path.join(root, "scripts", "generate_digit_tiles.py")
+        sources = [font_path, layout_path] + ([script_path] if os.path.exists(script_path) else [])
+        if all(os.path.getmtime(p) <= output_time for p in sources):
+            return
+
+    bitmaps, glyphs, first, y_advance = parse_font(font_path)
+    top_line_y, time_gap = parse_layout(layout_path)
+
+    def glyph_of(ch):
+        return glyphs[ord(ch) - first]
+
+    # 按 getTextBounds 的方式计算时间高度，得到与运行时一致的基线
+    layout = [glyph_of(ch) for ch in LAYOUT_TEXT]
+    top = min(g[5] for g in layout)
+    bottom = max(g[5] + g[2] - 1 for g in layout)
+    baseline = top_line_y + (bottom - top + 1) + time_gap
+
+    # 所有瓦片共用的纵向范围（逻辑 y），对应原生 x，向外扩展到 8 像素对齐
+    tile_glyphs = [glyph_of(ch) for ch in TILE_CHARS]
+    min_y = baseline + min(g[5] for g in tile_glyphs)
+    max_y = baseline + max(g[5] + g[2] - 1 for g in tile_glyphs)
+    native_x = ((NATIVE_WIDTH - 1 - max_y) // 8) * 8
+    native_end = ((NATIVE_WIDTH - 1 - min_y) // 8 + 1) * 8
+    row_bytes = (native_end - native_x) // 8
+
+    # 瓦片整字节覆盖背景，不能碰到上下分隔线
+    covered_top = NATIVE_WIDTH - native_end
+    covered_bottom = NATIVE_WIDTH - 1 - native_x
+    bottom_line_y = baseline + time_gap
+    if covered_top <= top_line_y or covered_bottom >= bottom_line_y:
+        raise ValueError("瓦片范围 y=%d..%d 覆盖了分隔线" % (covered_top, covered_bottom))
+
+    digit_advance = glyph_of("0")[3]
+    tiles = []
+    for ch in TILE_CHARS:
+        glyph = glyph_of(ch)
+        advance, x_offset, y_offset = glyph[3], glyph[4], glyph[5]
+        if x_offset < 0 or x_offset + glyph[1] > advance:
+            raise ValueError("字符 '%s' 超出前进宽度" % ch)
+
+        # 每个原生行对应一个逻辑列，1 = 白色
+        rows = []
+        pixels = glyph_pixels(bitmaps, glyph)
+        for column in range(advance):
+            row = [0xFF] * row_bytes
+            for (col, line) in pixels:
+                if col + x_offset != column:
+                    continue
+                nx = NATIVE_WIDTH - 1 - (baseline + y_offset + line) - native_x
+                row[nx // 8] &= ~(0x80 >> (nx % 8)) & 0xFF
+            rows.append(row)
+        tiles.append((ch, advance, rows))
+
+    write_header(output_path, baseline, native_x, row_bytes, y_advance, glyph_of("0"), digit_advance, tiles)
+
+    data_size = sum(len(rows) * row_bytes for (_, _, rows) in tiles)
+    print("Digit tiles: %s (%d bytes, baseline %d)" % (OUTPUT_FILE, data_size, baseline))
+
+
+def tile_name(ch):
+    return "DigitTileColon" if ch == ":" else "DigitTile%s" % ch
+
+
+def write_header(path, baseline, native_x, row_bytes, y_advance, zero_glyph, digit_advance, tiles):
+    lines = []
+    lines.append("// 由 scripts/generate_digit_tiles.py 根据 %s 生成，请勿手动修改" % FONT_FILE)
+    lines.append("#pragma once")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("// 生成瓦片时使用的时间基线（逻辑坐标 y）")
+    lines.append("#define DIGIT_TILE_BASELINE %d" % baseline)
+    lines.append("")
+    lines.append("// 瓦片在原生坐标中的起始列（8 像素对齐）和每行字节数")
+    lines.append("#define DIGIT_TILE_NATIVE_X %d" % native_x)
+    lines.append("#define DIGIT_TILE_ROW_BYTES %d" % row_bytes)
+    lines.append("")
+    lines.append("// 源字体特征，用于确认当前时间字体与瓦片一致")
+    lines.append("#define DIGIT_TILE_FONT_Y_ADVANCE %d" % y_advance)
+    lines.append("#define DIGIT_TILE_FONT_ZERO_OFFSET %d" % zero_glyph[0])
+    lines.append("#define DIGIT_TILE_FONT_ZERO_WIDTH %d" % zero_glyph[1])
+    lines.append("#define DIGIT_TILE_FONT_ZERO_HEIGHT %d" % zero_glyph[2])
+    lines.append("")
+    lines.append("// 单个字符瓦片：rows 为原生行数（即逻辑宽度），data 为空表示全白")
+    lines.append("struct DigitTile {")
+    lines.append("  char ch;")
+    lines.append("  uint8_t rows;")
+    lines.append("  const uint8_t* data;")
+    lines.append("};")
+    lines.append("")
+    for (ch, advance, rows) in tiles:
+        lines.append("static const uint8_t %s[] PROGMEM = {" % tile_name(ch))
+        for row in rows:
+            lines.append("  " + ", ".join("0x%02X" % b for b in row) + ",")
+        lines.append("};")
+        lines.append("")
+    lines.append("static const DigitTile DIGIT_TILES[] = {")
+    for (ch, advance, rows) in tiles:
+        lines.append("  {'%s', %d, %s}," % (ch, advance, tile_name(ch)))
+    lines.append("  {'%s', %d, nullptr}," % (BLANK_CHAR, digit_advance))
+    lines.append("};")
+    lines.append("")
+    lines.append("#define DIGIT_TILE_COUNT (sizeof(DIGIT_TILES) / sizeof(DIGIT_TILES[0]))")
+    lines.append("")
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+generate(project_dir())
+generate_metrics(project_dir())
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Web 配置页面静态资源生成工具
+
+将 lib/WebConfigManager/assets/ 中的静态资源（CSS、JS、HTML 等）压缩（CSS 去除注释和空白）
+后用 gzip 压缩，生成 PROGMEM 字节数组。WebConfigManager 按资源路径注册路由，以
+Content-Encoding: gzip 直接发送压缩数据，并附带强 ETag 和 Cache-Control：
+
+- ETag 为压缩前内容的 SHA-256 前 8 位，请求带 If-None-Match 且一致时返回 304
+- 页面中通过 WEB_ASSET_<NAME>_URL（路径加 ?v=<ETag>）引用资源，内容变化时 URL 随之变化，
+  因此可以长期缓存（immutable）
+
+gzip 头中的时间戳固定为 0，相同输入总是生成相同的输出。
+
+用法：
+  python3 scripts/generate_web_assets.py          # 手动生成
+  platformio.ini 中 extra_scripts = pre:scripts/generate_web_assets.py  # 编译前自动生成
+"""
+
+import gzip
+import hashlib
+import io
+import os
+import re
+import sys
+
+# 资源目录与输出文件（相对于项目根目录）
+ASSET_DIR = "lib/WebConfigManager/assets"
+OUTPUT_FILE = "lib/WebConfigManager/WebAssets.h"
+
+# 扩展名对应的内容类型
+CONTENT_TYPES = {
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".html": "text/html",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+}
+
+# 缓存策略：URL 中带有内容版本，可以长期缓存
+CACHE_CONTROL = "public, max-age=31536000, immutable"
+
+
+def project_dir():
+    """获取项目根目录（兼容 PlatformIO 预编译脚本和直接运行）"""
+    try:
+        Import("env")  # noqa: F821  PlatformIO (SCons) 环境中提供
+        return env.subst("$PROJECT_DIR")  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+
+def minify_css(text):
+    """去除注释和多余空白（不改变语义的保守处理）"""
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{}:;,>])\s*", r"\1", text)
+    text = text.replace(";}", "}")
+    return text.strip()
+
+
+def compress(data):
+    """gzip 压缩，时间戳固定为 0，保证输出可重复"""
+    buffer = io.BytesIO()
+    with gzip.GzipFile(filename="", mode="wb", fileobj=buffer, compresslevel=9, mtime=0) as f:
+        f.write(data)
+    return buffer.getvalue()
+
+
+def symbol_name(filename):
+    """style.css -> STYLE_CSS"""
+    return re.sub(r"[^0-9A-Za-z]", "_", filename).upper()
+
+
+def load_assets(asset_dir):
+    assets = []
+    for filename in sorted(os.listdir(asset_dir)):
+        extension = os.path.splitext(filename)[1].lower()
+        if extension not in CONTENT_TYPES:
+            continue
+        with open(os.path.join(asset_dir, filename), "rb") as f:
+            data = f.read()
+        if extension == ".css":
+            data = minify_css(data.decode("utf-8")).encode("utf-8")
+
+        etag = hashlib.sha256(data).hexdigest()[:8]
+        assets.append({
+            "name": symbol_name(filename),
+            "path": "/" + filename,
+            "type": CONTENT_TYPES[extension],
+            "etag": etag,
+            "size": len(data),
+            "gzip": compress(data),
+        })
+    return assets
+
+
+def write_header(path, assets):
+    lines = []
+    lines.append("// 由 scripts/generate_web_assets.py 根据 %s/ 生成，请勿手动修改" % ASSET_DIR)
+    lines.append("#pragma once")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("// 静态资源的缓存策略（URL 中带有内容版本）")
+    lines.append("#define WEB_ASSET_CACHE_CONTROL \"%s\"" % CACHE_CONTROL)
+    lines.append("")
+    lines.append("// 页面中引用资源的 URL（路径加内容版本）")
+    for asset in assets:
+        lines.append("#define WEB_ASSET_%s_URL \"%s?v=%s\"" % (asset["name"], asset["path"], asset["etag"]))
+    lines.append("")
+    lines.append("// gzip 压缩的静态资源：etag 为带引号的强 ETag，data 位于 PROGMEM")
+    lines.append("struct WebAsset {")
+    lines.append("  const char* path;")
+    lines.append("  const char* contentType;")
+    lines.append("  const char* etag;")
+    lines.append("  const uint8_t* data;")
+    lines.append("  size_t length;")
+    lines.append("};")
+    lines.append("")
+    for asset in assets:
+        lines.append("// %s：%d 字节，gzip 后 %d 字节" % (asset["path"], asset["size"], len(asset["gzip"])))
+        lines.append("static const uint8_t WEB_ASSET_%s_GZ[] PROGMEM = {" % asset["name"])
+        data = asset["gzip"]
+        for i in range(0, len(data), 16):
+            lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+    lines.append("static const WebAsset WEB_ASSETS[] = {")
+    for asset in assets:
+        lines.append("  {\"%s\", \"%s\", \"\\\"%s\\\"\", WEB_ASSET_%s_GZ, sizeof(WEB_ASSET_%s_GZ)}," %
+                     (asset["path"], asset["type"], asset["etag"], asset["name"], asset["name"]))
+    lines.append("};")
+    lines.append("")
+    lines.append("#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))")
+    lines.append("")
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+def generate(root):
+    asset_dir = os.path.join(root, ASSET_DIR)
+    output_path = os.path.join(root, OUTPUT_FILE)
+
+    # 资源和脚本都未变化时跳过
+    if os.path.exists(output_path):
+        output_time = os.path.getmtime(output_path)
+        script_path = os.path.join(root, "scripts", "generate_web_assets.py")
+        sources = [asset_dir] + [os.path.join(asset_dir, f) for f in os.listdir(asset_dir)]
+        sources += [script_path] if os.path.exists(script_path) else []
+        if all(os.path.getmtime(p) <= output_time for p in sources):
+            return
+
+    assets = load_assets(asset_dir)
+    write_header(output_path, assets)
+    for asset in assets:
+        print("Web asset %s: %d -> %d bytes (gzip), ETag %s" % (asset["path"], asset["size"], len(asset["gzip"]), asset["etag"]))
+
+
+generate(project_dir())
@@ -0,0 +1,311 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+渲染帧基准比较工具
+
+配置模式下串口命令 `frames` 会把测试矩阵中的每一帧渲染到帧缓冲（不刷新屏幕），
+以 PBM 十六进制行和渲染耗时输出。本工具读取这些输出，保存为 PBM（安装 Pillow 时
+同时保存 PNG），与基准目录中的图像逐像素比较，并检查每帧渲染耗时是否超出预算。
+
+--native 不需要设备：运行主机测试 test_golden_frames（pio test -e native），用同一份
+渲染代码和字体在主机上渲染测试矩阵，输出格式相同。主机上的渲染耗时没有参考意义，
+此时不检查 --max-render-us。
+
+输出格式：
+  FRAMES BEGIN
+  FRAME <name> render_us=<n>
+  P4 <width> <height>
+  <每行一个十六进制串，1 = 黑色>
+  END
+  ...
+  FRAMES END
+
+用法：
+  python3 scripts/golden_frames.py --port /dev/ttyUSB0            # 从设备采集并与基准比较
+  python3 scripts/golden_frames.py --input capture.log            # 使用已保存的串口日志
+  python3 scripts/golden_frames.py --port /dev/ttyUSB0 --update   # 用当前输出更新基准图像
+  python3 scripts/golden_frames.py --input capture.log --tolerance 20 --max-render-us 30000
+  python3 scripts/golden_frames.py --native                       # 在主机上渲染并与基准比较
+  python3 scripts/golden_frames.py --native --update              # 在主机上生成基准图像
+
+没有基准图像的帧（NEW）和没有对应帧的基准图像（MISSING）都算作失败。基准目录中还没有
+任何 PBM 时只保存当前帧并提示用 --update 生成，不算失败。
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import time
+
+# 默认目录（相对于项目根目录）
+GOLDEN_DIR = "test/golden"
+OUTPUT_DIR = ".pio/frames"
+
+# 串口参数（与 config.h 中 SERIAL_BAUD_RATE 一致）
+DEFAULT_BAUD = 74880
+CAPTURE_TIMEOUT = 60
+
+BEGIN_MARKER = "FRAMES BEGIN"
+END_MARKER = "FRAMES END"
+
+# 主机渲染：测试名称和输出文件的环境变量（见 test/test_golden_frames）
+NATIVE_ENV = "native"
+NATIVE_TEST = "test_golden_frames"
+NATIVE_LOG_VAR = "GOLDEN_FRAMES_LOG"
+
+
+class Frame(object):
+    def __init__(self, name, render_us):
+        self.name = name
+        self.render_us = render_us
+        self.width = 0
+        self.height = 0
+        self.rows = []  # 每行 bytes，PBM P4 格式
+
+    def pixel(self, x, y):
+        return (self.rows[y][x // 8] >> (7 - x % 8)) & 1
+
+    def to_pbm(self):
+        return ("P4\n%d %d\n" % (self.width, self.height)).encode("ascii") + b"".join(self.rows)
+
+
+def project_dir():
+    return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def parse_frames(lines):
+    """从串口输出中解析帧，忽略标记之外的日志行"""
+    frames = []
+    current = None
+    in_block = False
+    for raw in lines:
+        line = raw.strip()
+        if line == BEGIN_MARKER:
+            in_block = True
+            continue
+        if line == END_MARKER:
+            in_block = False
+            continue
+        if not in_block:
+            continue
+
+        if line.startswith("FRAME "):
+            parts = line.split()
+            render_us = 0
+            for part in parts[2:]:
+                if part.startswith("render_us="):
+                    render_us = int(part.split("=", 1)[1])
+            current = Frame(parts[1], render_us)
+        elif current is None:
+            continue
+        elif line.startswith("P4 "):
+            _, width, height = line.split()
+            current.width, current.height = int(width), int(height)
+        elif line == "END":
+            if len(current.rows) != current.height:
+                raise ValueError("帧 %s 行数不完整：%d/%d" % (current.name, len(current.rows), current.height))
+            frames.append(current)
+            current = None
+        else:
+            current.rows.append(bytes.fromhex(line))
+    return frames
+
+
+def read_pbm(path):
+    """读取 P4 格式 PBM 文件"""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos].decode("ascii"))
+    pos += 1
+
+    if tokens[0] != "P4":
+        raise ValueError("%s 不是 P4 格式的 PBM 文件" % path)
+    frame = Frame(os.path.splitext(os.path.basename(path))[0], 0)
+    frame.width, frame.height = int(tokens[1]), int(tokens[2])
+    row_bytes = (frame.width + 7) // 8
+    frame.rows = [data[pos + y * row_bytes:pos + (y + 1) * row_bytes] for y in range(frame.height)]
+    return frame
+
+
+def capture_serial(port, baud, filter_text):
+    """发送 frames 命令并读取输出直到结束标记"""
+    try:
+        import serial
+    except ImportError:
+        sys.exit("需要 pyserial：pip install pyserial")
+
+    lines = []
+    with serial.Serial(port, baud, timeout=1) as conn:
+        conn.reset_input_buffer()
+        conn.write(("frames %s\n" % filter_text).strip().encode("ascii") + b"\n")
+        deadline = time.time() + CAPTURE_TIMEOUT
+        while time.time() < deadline:
+            line = conn.readline().decode("utf-8", "replace")
+            if not line:
+                continue
+            lines.append(line)
+            if line.strip() == END_MARKER:
+                return lines
+    sys.exit("等待 %s 超时，请确认设备处于配置模式" % END_MARKER)
+
+
+def capture_native(output):
+    """运行主机测试 test_golden_frames，读取其写出的帧输出"""
+    os.makedirs(output, exist_ok=True)
+    log_path = os.path.join(output, "native.log")
+    if os.path.exists(log_path):
+        os.remove(log_path)
+
+    env = dict(os.environ)
+    env[NATIVE_LOG_VAR] = log_path
+    try:
+        result = subprocess.call(["pio", "test", "-e", NATIVE_ENV, "-f", NATIVE_TEST], cwd=project_dir(), env=env)
+    except OSError:
+        sys.exit("需要 PlatformIO：找不到 pio 命令")
+    if result != 0:
+        sys.exit("%s 运行失败（退出码 %d）" % (NATIVE_TEST, result))
+    if not os.path.exists(log_path):
+        sys.exit("%s 没有输出帧，请先执行 pio pkg install -e nodemcu 安装 FreeMonoBold9pt7b 所在的 Adafruit GFX Library" % NATIVE_TEST)
+
+    with open(log_path, "r", encoding="utf-8", errors="replace") as f:
+        return f.readlines()
+
+
+def has_goldens(directory):
+    return os.path.isdir(directory) and any(name.endswith(".pbm") for name in os.listdir(directory))
+
+
+def save_frame(frame, directory):
+    os.makedirs(directory, exist_ok=True)
+    path = os.path.join(directory, frame.name + ".pbm")
+    with open(path, "wb") as f:
+        f.write(frame.to_pbm())
+
+    # 可选的 PNG 输出，便于直接查看
+    try:
+        from PIL import Image
+        image = Image.frombytes("1", (frame.width, frame.height), b"".join(frame.rows), "raw", "1;I")
+        image.save(os.path.join(directory, frame.name + ".png"))
+    except ImportError:
+        pass
+    return path
+
+
+def diff_frames(actual, golden):
+    """返回 (不同像素数, 差异外接矩形)，尺寸不同时返回 None"""
+    if (actual.width, actual.height) != (golden.width, golden.height):
+        return None
+
+    count = 0
+    box = None
+    for y in range(actual.height):
+        if actual.rows[y] == golden.rows[y]:
+            continue
+        for x in range(actual.width):
+            if actual.pixel(x, y) != golden.pixel(x, y):
+                count += 1
+                if box is None:
+                    box = [x, y, x, y]
+                else:
+                    box = [min(box[0], x), min(box[1], y), max(box[2], x), max(box[3], y)]
+    return count, box
+
+
+def main():
+    parser = argparse.ArgumentParser(description="渲染帧基准比较")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="设备串口，例如 /dev/ttyUSB0")
+    source.add_argument("--input", help="已保存的串口日志文件")
+    source.add_argument("--native", action="store_true", help="在主机上渲染（pio test -e native）")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD, help="串口波特率")
+    parser.add_argument("--filter", default="", help="只采集名称包含该字符串的帧")
+    parser.add_argument("--golden", default=os.path.join(project_dir(), GOLDEN_DIR), help="基准图像目录")
+    parser.add_argument("--output", default=os.path.join(project_dir(), OUTPUT_DIR), help="当前帧输出目录")
+    parser.add_argument("--tolerance", type=int, default=0, help="允许的不同像素数")
+    parser.add_argument("--max-render-us", type=int, default=0, help="单帧渲染耗时预算（微秒），0 表示不检查")
+    parser.add_argument("--update", action="store_true", help="用当前帧覆盖基准图像")
+    args = parser.parse_args()
+
+    if args.native:
+        if args.filter:
+            sys.exit("--native 总是渲染完整的测试矩阵，不支持 --filter")
+        lines = capture_native(args.output)
+        args.max_render_us = 0
+    elif args.port:
+        lines = capture_serial(args.port, args.baud, args.filter)
+    else:
+        with open(args.input, "r", encoding="utf-8", errors="replace") as f:
+            lines = f.readlines()
+
+    frames = parse_frames(lines)
+    if not frames:
+        sys.exit("没有找到帧数据")
+
+    # 基准图像尚未生成：只保存当前帧供检查，不把每一帧都报告为失败
+    if not args.update and not has_goldens(args.golden):
+        for frame in frames:
+            save_frame(frame, args.output)
+        print("%s 中没有基准图像，已将 %d 帧保存到 %s，检查无误后用 --update 生成基准" % (args.golden, len(frames), args.output))
+        return
+
+    failures = 0
+    print("%-26s %10s %8s  %s" % ("frame", "render_us", "diff", "result"))
+    for frame in frames:
+        save_frame(frame, args.output)
+        golden_path = os.path.join(args.golden, frame.name + ".pbm")
+
+        if args.update:
+            save_frame(frame, args.golden)
+            result, diff_text = "updated", "-"
+        elif not os.path.exists(golden_path):
+            result, diff_text = "NEW (no golden)", "-"
+            failures += 1
+        else:
+            diff = diff_frames(frame, read_pbm(golden_path))
+            if diff is None:
+                result, diff_text = "FAIL (size mismatch)", "-"
+                failures += 1
+            else:
+                count, box = diff
+                diff_text = str(count)
+                if count > args.tolerance:
+                    result = "FAIL (x=%d..%d y=%d..%d)" % (box[0], box[2], box[1], box[3])
+                    failures += 1
+                else:
+                    result = "ok"
+
+        if args.max_render_us and frame.render_us > args.max_render_us:
+            result += " SLOW"
+            failures += 1
+        print("%-26s %10d %8s  %s" % (frame.name, frame.render_us, diff_text, result))
+
+    # 没有对应帧的基准图像（帧被改名或删除），只在采集了完整矩阵时检查
+    if not args.update and not args.filter and os.path.isdir(args.golden):
+        captured = set(f.name for f in frames)
+        for name in sorted(os.listdir(args.golden)):
+            if name.endswith(".pbm") and name[:-4] not in captured:
+                print("%-26s %10s %8s  %s" % (name[:-4], "-", "-", "MISSING (golden without frame)"))
+                failures += 1
+
+    total_us = sum(f.render_us for f in frames)
+    print("%d frames, render total %d us, max %d us" % (len(frames), total_us, max(f.render_us for f in frames)))
+    if failures:
+        print("%d check(s) failed" % failures)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+主机测试字体准备工具
+
+界面的小字体 FreeMonoBold9pt7b 来自 Adafruit GFX Library（GxEPD2 的依赖），只在
+nodemcu 环境的 libdeps 中安装。native 环境的 test_render、test_golden_frames 需要同一个字体文件，但不能
+把整个库目录加入包含路径（会用真正的 Adafruit_GFX.h 覆盖 test/host 中的替身），
+因此本脚本只把字体头文件复制到构建目录下的 host_fonts/Fonts/，再把 host_fonts 加入
+包含路径。
+
+找不到字体时只打印提示，这两个测试会被标记为 IGNORE。
+
+用法：
+  platformio.ini 中 [env:native] 的 extra_scripts = pre:scripts/host_fonts.py
+  首次使用前安装 nodemcu 环境的依赖：pio pkg install -e nodemcu（或 pio run -e nodemcu）
+"""
+
+import os
+import shutil
+
+SMALL_FONT_FILE = os.path.join("Adafruit GFX Library", "Fonts", "FreeMonoBold9pt7b.h")
+OUTPUT_DIR = "host_fonts"
+
+
+def find_small_font(libdeps):
+    """在各环境的 libdeps 目录中查找 FreeMonoBold9pt7b.h，找不到时返回 None"""
+    if not os.path.isdir(libdeps):
+        return None
+    for name in sorted(os.listdir(libdeps)):
+        path = os.path.join(libdeps, name, SMALL_FONT_FILE)
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def prepare(env):
+    font = find_small_font(env.subst("$PROJECT_LIBDEPS_DIR"))
+    if font is None:
+        print("host_fonts: FreeMonoBold9pt7b.h not found, run 'pio pkg install -e nodemcu' to enable test_render and test_golden_frames")
+        return
+
+    output = os.path.join(env.subst("$BUILD_DIR"), OUTPUT_DIR)
+    target = os.path.join(output, "Fonts", os.path.basename(font))
+    if not os.path.exists(target) or os.path.getmtime(target) < os.path.getmtime(font):
+        os.makedirs(os.path.dirname(target), exist_ok=True)
+        shutil.copy2(font, target)
+    env.Append(CPPPATH=[output])
+
+
+Import("env")  # noqa: F821  PlatformIO (SCons) 环境中提供
+prepare(env)  # noqa: F821
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+热点函数微基准采集与比较工具
+
+配置模式下串口命令 `bench` 在设备上逐个运行 lib/MicroBench 中的用例（高德 JSON 解析、
+天气信息字符串、时间界面渲染），每个用例先预热再计时多轮，以 JSON 输出每次调用耗时的
+中位数、p95、最小值和最大值。不依赖 Arduino 的纯函数（天气和风向映射、配置校验和、
+星期计算、SHT40 CRC）由主机测试 test/test_microbench 以相同格式输出（suite 为 native），
+--native 时运行 pio test 采集。本工具读取这些输出并保存为 JSON 文件，指定 --baseline 时
+与之前保存的结果逐项比较中位数，超出阈值的用例视为性能回退，退出码为 1。
+
+输出格式：
+  BENCH BEGIN
+  {"suite":"microbench","sketch_md5":"...","cpu_mhz":80,"warmup":3,"repetitions":21,"results":[
+  {"name":"weather.parseWeatherResponse","iterations":10,"median_ns":...,"p95_ns":...,"min_ns":...,"max_ns":...}
+  ,{...}
+  ]}
+  BENCH END
+
+用法：
+  python3 scripts/microbench.py --port /dev/ttyUSB0 --output bench/main.json       # 采集并保存
+  python3 scripts/microbench.py --port /dev/ttyUSB0 --baseline bench/main.json     # 与之前的结果比较
+  python3 scripts/microbench.py --input capture.log --baseline bench/main.json --threshold 5
+  python3 scripts/microbench.py --port /dev/ttyUSB0 --filter weather --repetitions 41
+  python3 scripts/microbench.py --native --output bench/native.json                 # 主机上的纯函数
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+# 默认输出文件（相对于项目根目录）
+OUTPUT_FILE = ".pio/microbench.json"
+
+# 串口参数（与 config.h 中 SERIAL_BAUD_RATE 一致）
+DEFAULT_BAUD = 74880
+CAPTURE_TIMEOUT = 120
+
+BEGIN_MARKER = "BENCH BEGIN"
+END_MARKER = "BENCH END"
+
+
+def project_dir():
+    return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def parse_results(lines):
+    """从串口输出中取出最后一组标记之间的 JSON，忽略其他日志行"""
+    block = None
+    for raw in lines:
+        line = raw.strip()
+        if line == BEGIN_MARKER:
+            block = []
+        elif line == END_MARKER:
+            if block is not None:
+                return json.loads("".join(block))
+        elif block is not None and line:
+            block.append(line)
+    raise ValueError("输出中没有完整的 %s ... %s 块" % (BEGIN_MARKER, END_MARKER))
+
+
+def capture_serial(port, baud, filter_text, repetitions):
+    """发送 bench 命令并读取输出直到结束标记"""
+    try:
+        import serial
+    except ImportError:
+        sys.exit("需要 pyserial：pip install pyserial")
+
+    command = "bench %s %s" % (filter_text, repetitions if repetitions else "")
+    lines = []
+    with serial.Serial(port, baud, timeout=1) as conn:
+        conn.reset_input_buffer()
+        conn.write(" ".join(command.split()).encode("ascii") + b"\n")
+        deadline = time.time() + CAPTURE_TIMEOUT
+        while time.time() < deadline:
+            line = conn.readline().decode("utf-8", "replace")
+            if not line:
+                continue
+            lines.append(line)
+            if line.strip() == END_MARKER:
+                return lines
+    sys.exit("等待 %s 超时，请确认设备处于配置模式" % END_MARKER)
+
+
+def capture_native():
+    """在主机上运行 test_microbench，返回其输出"""
+    command = ["pio", "test", "-e", "native", "-f", "test_microbench", "-v"]
+    try:
+        result = subprocess.run(command, cwd=project_dir(), stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT, universal_newlines=True)
+    except OSError as e:
+        sys.exit("无法运行 %s：%s" % (" ".join(command), e))
+    if result.returncode != 0:
+        sys.stdout.write(result.stdout)
+        sys.exit("主机测试失败，结果不保存")
+    return result.stdout.splitlines()
+
+
+def compare(current, baseline, threshold):
+    """逐项比较中位数，返回回退的用例数"""
+    if current.get("suite") != baseline.get("suite"):
+        sys.exit("结果来自不同的环境（当前 %s，基准 %s），不能比较" % (current.get("suite"), baseline.get("suite")))
+    if current.get("cpu_mhz") != baseline.get("cpu_mhz"):
+        print("警告：CPU 频率不同（当前 %s MHz，基准 %s MHz），结果不可直接比较"
+              % (current.get("cpu_mhz"), baseline.get("cpu_mhz")))
+
+    old = dict((r["name"], r) for r in baseline.get("results", []))
+    regressions = 0
+    print("%-34s %12s %12s %8s" % ("case", "base_ns", "median_ns", "change"))
+    for result in current["results"]:
+        name = result["name"]
+        if name not in old:
+            print("%-34s %12s %12.1f %8s" % (name, "-", result["median_ns"], "new"))
+            continue
+        base = old[name]["median_ns"]
+        change = (result["median_ns"] - base) * 100.0 / base if base > 0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print("%-34s %12.1f %12.1f %+7.1f%%%s" % (name, base, result["median_ns"], change, flag))
+    for name in old:
+        if name not in [r["name"] for r in current["results"]]:
+            print("%-34s %12.1f %12s %8s" % (name, old[name]["median_ns"], "-", "missing"))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="热点函数微基准采集与比较")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="设备串口，例如 /dev/ttyUSB0")
+    source.add_argument("--input", help="已保存的串口日志文件")
+    source.add_argument("--native", action="store_true", help="在主机上运行 pio test -e native -f test_microbench")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD, help="串口波特率")
+    parser.add_argument("--filter", default="", help="只运行名称包含该字符串的用例")
+    parser.add_argument("--repetitions", type=int, default=0, help="计时轮数，0 表示使用设备默认值")
+    parser.add_argument("--output", default=os.path.join(project_dir(), OUTPUT_FILE), help="结果 JSON 文件")
+    parser.add_argument("--baseline", help="之前保存的结果 JSON，用于比较")
+    parser.add_argument("--threshold", type=float, default=10.0, help="中位数变慢超过该百分比视为回退")
+    args = parser.parse_args()
+
+    if args.port:
+        lines = capture_serial(args.port, args.baud, args.filter, args.repetitions)
+    elif args.native:
+        lines = capture_native()
+    else:
+        with open(args.input, "r", encoding="utf-8", errors="replace") as f:
+            lines = f.readlines()
+
+    try:
+        current = parse_results(lines)
+    except ValueError as e:
+        sys.exit(str(e))
+
+    directory = os.path.dirname(args.output)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as f:
+        # 固定缩进和键顺序，保存的结果可以直接用 git diff 比较
+        json.dump(current, f, indent=2, sort_keys=True)
+        f.write("\n")
+    print("已保存 %d 个用例的结果到 %s" % (len(current["results"]), args.output))
+
+    if not args.baseline:
+        return 0
+    with open(args.baseline, "r", encoding="utf-8") as f:
+        baseline = json.load(f)
+    regressions = compare(current, baseline, args.threshold)
+    if regressions:
+        print("%d 个用例变慢超过 %.1f%%" % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+配置热点固件上传工具
+
+设备进入配置模式后，电脑连接设备的 WeWeather 热点，本工具把编译生成的 firmware.bin 上传到
+配置页面的 /update。上传时附带 MD5 和 SHA-256，设备边写入 OTA 分区边计算，校验通过后重启并
+安装新固件；校验失败时设备上的当前固件不受影响。结束后输出设备返回的结果（字节数、耗时和速率）
+以及本机测得的总耗时。
+
+配置热点不加密，固件更新需要 HTTP Basic 认证（用户名 admin），密码在设备上通过串口
+set otapass 设置或在 config.h 中设置 DEFAULT_UPDATE_PASSWORD；设备未设置密码时拒绝固件更新。
+密码通过 --password 或环境变量 WEWEATHER_OTA_PASSWORD 指定，后者可用于 pio run -e nodemcu_ota。
+
+多台设备依次进入配置模式、连接热点后重复运行即可，不需要拆机连接串口。
+
+用法：
+  python3 scripts/ota_upload.py --password myUpdatePassword                  # 默认上传 .pio/build/nodemcu/firmware.bin
+  python3 scripts/ota_upload.py --firmware path/to/firmware.bin --host 192.168.4.1
+  WEWEATHER_OTA_PASSWORD=myUpdatePassword pio run -e nodemcu_ota -t upload  # 编译后通过热点上传
+"""
+
+import argparse
+import base64
+import hashlib
+import http.client
+import os
+import sys
+import time
+import uuid
+
+DEFAULT_HOST = "192.168.4.1"
+DEFAULT_FIRMWARE = ".pio/build/nodemcu/firmware.bin"
+
+# 固件更新认证（与 WebConfigManager 中的 UPDATE_USERNAME 一致）
+USERNAME = "admin"
+PASSWORD_ENV = "WEWEATHER_OTA_PASSWORD"
+
+# 写入 Flash 较慢，给设备留足时间
+UPLOAD_TIMEOUT = 120
+
+
+def build_body(data, filename, boundary):
+    """构造 multipart/form-data 请求体（字段名与配置页面一致）"""
+    head = ("--%s\r\n"
+            "Content-Disposition: form-data; name=\"firmware\"; filename=\"%s\"\r\n"
+            "Content-Type: application/octet-stream\r\n\r\n" % (boundary, filename)).encode("utf-8")
+    tail = ("\r\n--%s--\r\n" % boundary).encode("utf-8")
+    return head + data + tail
+
+
+def upload(host, path, password):
+    with open(path, "rb") as f:
+        data = f.read()
+    md5 = hashlib.md5(data).hexdigest()
+    sha256 = hashlib.sha256(data).hexdigest()
+    print("Firmware: %s (%d bytes)" % (path, len(data)))
+    print("MD5:      %s" % md5)
+    print("SHA-256:  %s" % sha256)
+
+    credentials = base64.b64encode(("%s:%s" % (USERNAME, password)).encode("utf-8")).decode("ascii")
+    boundary = uuid.uuid4().hex
+    body = build_body(data, os.path.basename(path), boundary)
+
+    start = time.perf_counter()
+    conn = http.client.HTTPConnection(host, timeout=UPLOAD_TIMEOUT)
+    try:
+        conn.request("POST", "/update?md5=%s&sha256=%s" % (md5, sha256), body=body, headers={
+            "Content-Type": "multipart/form-data; boundary=%s" % boundary,
+            "Authorization": "Basic %s" % credentials,
+            "Connection": "close",
+        })
+        response = conn.getresponse()
+        result = response.read().decode("utf-8", "replace").strip()
+    finally:
+        conn.close()
+    elapsed = time.perf_counter() - start
+
+    print("Device:   %s" % result)
+    if response.status == 401:
+        print("密码错误（设备上通过串口 set otapass 设置）")
+    elif response.status == 403:
+        print("设备未设置固件更新密码，请先通过串口 set otapass 设置")
+    print("Host:     %d bytes in %.1f s (%.1f KB/s)" % (len(data), elapsed, len(data) / 1024.0 / elapsed))
+    return response.status == 200
+
+
+def main():
+    parser = argparse.ArgumentParser(description="通过配置热点上传固件")
+    parser.add_argument("--host", default=DEFAULT_HOST, help="设备地址（可带端口）")
+    parser.add_argument("--firmware", default=DEFAULT_FIRMWARE, help="固件文件")
+    parser.add_argument("--password", default=os.environ.get(PASSWORD_ENV, ""),
+                        help="固件更新密码（默认取环境变量 %s）" % PASSWORD_ENV)
+    args = parser.parse_args()
+
+    if not args.password:
+        sys.exit("需要固件更新密码：--password 或环境变量 %s" % PASSWORD_ENV)
+
+    if not os.path.exists(args.firmware):
+        sys.exit("找不到固件文件 %s，请先编译：pio run" % args.firmware)
+
+    try:
+        ok = upload(args.host, args.firmware, args.password)
+    except OSError as e:
+        sys.exit("上传失败：%s（请确认已连接设备热点且设备处于配置模式）" % e)
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+字体子集生成工具
+
+lib/Fonts 中的 GFX 字体包含完整的 0x20-0x7E 字符，但时间只用到数字和冒号，天气符号
+也只用到 WeatherManager 映射出的几个字母。本工具扫描代码中实际引用的字体及其用途，
+为每个字体生成只包含所需字符的 GFXfont（lib/Fonts/subset/<字体名>.h，符号名不变），
+并输出 Flash 占用对比。
+
+字符集来源：
+  setTimeFont(&X) / setLargeTimeFont(&X)  -> CLOCK_CHARS
+  setWeatherSymbolFont(&X)                -> WeatherText.cpp 中 WEATHER_SYMBOLS 表的符号和 WEATHER_SYMBOL_DEFAULT
+
+字符集比已提交的子集少时报错退出（例如符号表被移走后扫描不到），避免生成缺字的字体；
+有意删除字符时加 --allow-shrink。
+
+用法：
+  python3 scripts/subset_fonts.py                 # 手动生成（输出未过期时只打印报告）
+  python3 scripts/subset_fonts.py --force         # 强制重新生成
+  python3 scripts/subset_fonts.py --check         # 只检查已提交的子集与重新生成的结果一致，不写文件
+  python3 scripts/subset_fonts.py --allow-shrink  # 允许字符集变小
+  platformio.ini 中 extra_scripts = pre:scripts/subset_fonts.py  # 编译前自动生成
+"""
+
+import glob
+import os
+import re
+import sys
+
+FONT_DIR = "lib/Fonts"
+OUTPUT_DIR = "lib/Fonts/subset"
+
+# 时间字符串只包含 "HH:MM"
+CLOCK_CHARS = "0123456789:"
+
+# 天气符号表和默认符号所在文件
+WEATHER_SYMBOL_TABLE = "lib/WeatherManager/WeatherText.cpp"
+WEATHER_SYMBOL_DEFAULT = "lib/WeatherManager/WeatherText.h"
+
+# 字体用途：设置函数 -> 字符集名称
+FONT_ROLES = {
+    "setTimeFont": "clock",
+    "setLargeTimeFont": "clock",
+    "setWeatherSymbolFont": "weather",
+}
+
+# ESP8266 上 GFXglyph 按 2 字节对齐为 8 字节，GFXfont 为 12 字节
+GLYPH_SIZE = 8
+FONT_STRUCT_SIZE = 12
+
+
+def project_dir():
+    """获取项目根目录（兼容 PlatformIO 预编译脚本和直接运行）"""
+    try:
+        Import("env")  # noqa: F821  PlatformIO (SCons) 环境中提供
+        return env.subst("$PROJECT_DIR")  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+
+def source_files(root):
+    """需要扫描的源文件（不含字体目录本身）"""
+    files = glob.glob(os.path.join(root, "src", "*.cpp"))
+    for pattern in ("*.cpp", "*.h"):
+        files += [p for p in glob.glob(os.path.join(root, "lib", "*", pattern))
+                  if os.path.basename(os.path.dirname(p)) != "Fonts"]
+    return sorted(files)
+
+
+def read_source(root, path):
+    with open(os.path.join(root, path), "r", encoding="utf-8") as f:
+        return f.read()
+
+
+def weather_symbols(root):
+    """WEATHER_SYMBOLS 表中每条规则的符号（每行最后一个字符字面量）和默认符号"""
+    table = re.search(r"WEATHER_SYMBOLS\[\]\s*=\s*\{(.*?)\n\};", read_source(root, WEATHER_SYMBOL_TABLE), re.S)
+    default = re.search(r"#define\s+WEATHER_SYMBOL_DEFAULT\s+'(.)'", read_source(root, WEATHER_SYMBOL_DEFAULT))
+    if not table or not default:
+        raise ValueError("%s 中没有 WEATHER_SYMBOLS 表或 %s 中没有 WEATHER_SYMBOL_DEFAULT"
+                         % (WEATHER_SYMBOL_TABLE, WEATHER_SYMBOL_DEFAULT))
+
+    symbols = set(re.findall(r"'(.)'\s*\}", table.group(1)))
+    if not symbols:
+        raise ValueError("%s 的 WEATHER_SYMBOLS 表中没有符号" % WEATHER_SYMBOL_TABLE)
+    symbols.add(default.group(1))
+    return "".join(sorted(symbols))
+
+
+def referenced_fonts(root):
+    """返回 {字体名: 所需字符集合}"""
+    charsets = {"clock": CLOCK_CHARS, "weather": weather_symbols(root)}
+    fonts = {}
+    pattern = re.compile(r"(%s)\(\s*&(\w+)\s*\)" % "|".join(FONT_ROLES))
+    for path in source_files(root):
+        with open(path, "r", encoding="utf-8") as f:
+            for setter, name in pattern.findall(f.read()):
+                fonts.setdefault(name, set()).update(charsets[FONT_ROLES[setter]])
+    return fonts
+
+
+def parse_font(path):
+    """解析 Adafruit GFX 字体头文件，返回 (位图, 字形表, 首字符, 末字符, yAdvance)"""
+    with open(path, "r", encoding="utf-8") as f:
+        source = f.read()
+
+    bitmap_match = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", source, re.S)
+    glyph_match = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", source, re.S)
+    font_match = re.search(r"\(GFXglyph\s*\*\)\s*\w+,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)\s*\}", source)
+    if not bitmap_match or not glyph_match or not font_match:
+        raise ValueError("无法解析字体文件: %s" % path)
+
+    bitmaps = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_match.group(1))]
+    glyphs = [tuple(int(v) for v in g)
+              for g in re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}",
+                                  glyph_match.group(1))]
+    return bitmaps, glyphs, int(font_match.group(1), 0), int(font_match.group(2), 0), int(font_match.group(3))
+
+
+def glyph_bytes(glyph):
+    return (glyph[1] * glyph[2] + 7) // 8
+
+
+def font_size(bitmap_len, glyph_count):
+    return bitmap_len + glyph_count * GLYPH_SIZE + FONT_STRUCT_SIZE
+
+
+def subset_font(name, chars, font):
+    """生成子集：范围为所需字符的最小到最大码位，范围内未使用的字形宽高为 0"""
+    bitmaps, glyphs, first, last, y_advance = font
+    codes = sorted(ord(c) for c in chars if first <= ord(c) <= last)
+    if not codes:
+        raise ValueError("%s 中没有所需字符" % name)
+
+    new_first, new_last = codes[0], codes[-1]
+    new_bitmaps = []
+    new_glyphs = []
+    for code in range(new_first, new_last + 1):
+        offset, width, height, x_advance, x_offset, y_offset = glyphs[code - first]
+        if code in codes:
+            size = glyph_bytes(glyphs[code - first])
+            new_glyphs.append((len(new_bitmaps), width, height, x_advance, x_offset, y_offset))
+            new_bitmaps += bitmaps[offset:offset + size]
+        else:
+            # 保留前进宽度，绘制时只移动光标
+            new_glyphs.append((len(new_bitmaps), 0, 0, x_advance, 0, 0))
+    return new_bitmaps, new_glyphs, new_first, new_last, y_advance
+
+
+def char_comment(code):
+    return "0x%02X '%s'" % (code, chr(code))
+
+
+def render_header(name, chars, subset):
+    bitmaps, glyphs, first, last, y_advance = subset
+    lines = []
+    lines.append("// 由 scripts/subset_fonts.py 根据 %s/%s.h 生成，请勿手动修改" % (FONT_DIR, name))
+    lines.append("// 包含字符：%s" % "".join(sorted(chars)))
+    lines.append("#pragma once")
+    lines.append("#include <Adafruit_GFX.h>")
+    lines.append("")
+    lines.append("const uint8_t %sBitmaps[] PROGMEM = {" % name)
+    for i in range(0, len(bitmaps), 12):
+        lines.append("  " + ", ".join("0x%02X" % b for b in bitmaps[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("const GFXglyph %sGlyphs[] PROGMEM = {" % name)
+    for i, g in enumerate(glyphs):
+        lines.append("  { %5d, %3d, %3d, %3d, %4d, %4d },   // %s" % (g + (char_comment(first + i),)))
+    lines.append("};")
+    lines.append("")
+    lines.append("const GFXfont %s PROGMEM = {" % name)
+    lines.append("  (uint8_t  *)%sBitmaps," % name)
+    lines.append("  (GFXglyph *)%sGlyphs," % name)
+    lines.append("  0x%02X, 0x%02X, %d };" % (first, last, y_advance))
+    lines.append("")
+    lines.append("// Approx. %d bytes" % font_size(len(bitmaps), len(glyphs)))
+    lines.append("")
+    return "\n".join(lines)
+
+
+def read_text(path):
+    if not os.path.exists(path):
+        return None
+    with open(path, "r", encoding="utf-8") as f:
+        return f.read()
+
+
+def committed_chars(text):
+    """已提交子集头文件中记录的字符集"""
+    match = re.search(r"^// 包含字符：(.*)$", text or "", re.M)
+    return set(match.group(1)) if match else set()
+
+
+def generate(root, force=False, check=False, allow_shrink=False):
+    fonts = referenced_fonts(root)
+    output_dir = os.path.join(root, OUTPUT_DIR)
+    script_path = os.path.join(root, "scripts", "subset_fonts.py")
+    inputs = source_files(root) + [script_path]
+
+    rows = []
+    errors = []
+    regenerated = False
+    for name in sorted(fonts):
+        font_path = os.path.join(root, FONT_DIR, name + ".h")
+        if not os.path.exists(font_path):
+            continue  # Adafruit GFX 自带字体等
+        output_path = os.path.join(output_dir, name + ".h")
+
+        font = parse_font(font_path)
+        subset = subset_font(name, fonts[name], font)
+        rows.append((name, font_size(len(font[0]), len(font[1])), font_size(len(subset[0]), len(subset[1]))))
+
+        # 扫描结果比已有子集少时不覆盖：缺少的字符在运行时只会画成空白
+        existing = read_text(output_path)
+        missing = committed_chars(existing) - set(fonts[name])
+        if missing and not allow_shrink:
+            errors.append("%s: 扫描到的字符集缺少已提交子集中的 %s（有意删除时加 --allow-shrink）"
+                          % (name, "".join(sorted(missing))))
+            continue
+
+        text = render_header(name, fonts[name], subset)
+        if check:
+            if text != existing:
+                errors.append("%s: %s 与重新生成的结果不一致，运行 python3 scripts/subset_fonts.py --force 后提交"
+                              % (name, os.path.relpath(output_path, root)))
+            continue
+
+        # 字体、源文件和脚本都未变化时跳过
+        if not force and existing is not None:
+            output_time = os.path.getmtime(output_path)
+            if all(os.path.getmtime(p) <= output_time for p in inputs + [font_path] if os.path.exists(p)):
+                continue
+
+        os.makedirs(output_dir, exist_ok=True)
+        with open(output_path, "w", encoding="utf-8") as f:
+            f.write(text)
+        regenerated = True
+
+    if errors:
+        for error in errors:
+            print("subset_fonts: %s" % error, file=sys.stderr)
+        fail()
+
+    if check:
+        print("Font subsets up to date (%d fonts)" % len(rows))
+    elif regenerated or force or not is_platformio():
+        print_report(root, rows, fonts)
+
+
+def fail():
+    """以失败退出，PlatformIO 中终止编译"""
+    try:
+        env.Exit(1)  # noqa: F821
+    except NameError:
+        sys.exit(1)
+
+
+def is_platformio():
+    try:
+        Import  # noqa: F821
+        return True
+    except NameError:
+        return False
+
+
+def print_report(root, rows, fonts):
+    print("Font subsets (%s):" % OUTPUT_DIR)
+    print("  %-32s %8s %8s %8s" % ("font", "full", "subset", "saved"))
+    for name, full, subset in rows:
+        print("  %-32s %8d %8d %8d" % (name, full, subset, full - subset))
+    total_full = sum(r[1] for r in rows)
+    total_subset = sum(r[2] for r in rows)
+    print("  %-32s %8d %8d %8d" % ("total", total_full, total_subset, total_full - total_subset))
+
+    # 未被引用的字体不会被编译，列出以便清理
+    unused = [os.path.splitext(os.path.basename(p))[0] for p in sorted(glob.glob(os.path.join(root, FONT_DIR, "*.h")))]
+    unused = [n for n in unused if n not in fonts]
+    if unused:
+        print("  unreferenced (not linked): %s" % ", ".join(unused))
+
+
+generate(project_dir(), force="--force" in sys.argv, check="--check" in sys.argv,
+         allow_shrink="--allow-shrink" in sys.argv)
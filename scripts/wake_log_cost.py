@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+串口日志耗时估算工具
+
+日志输出为 serial 时，每次正常唤醒都要初始化串口、发送日志，并在睡眠前等待串口发送完毕。
+本工具读取 `set log serial` 时抓取的串口输出，按 "System starting up..." 把日志切分为
+多次唤醒，统计每次唤醒发送的字节数，按波特率（8N1，每字节 10 位）换算为发送时间，
+再加上睡眠前等待串口的延时，得到切换到 rtc 或 off 后每次唤醒可以省下的时间上限。
+
+估算不包括串口初始化本身和日志格式化的 CPU 时间；发送时间与唤醒中其他工作重叠的部分
+（串口 FIFO 未满时写入不阻塞）也会被计入，因此结果是上限，实际收益以设备上测量为准。
+
+用法：
+  python3 scripts/wake_log_cost.py --input capture.log
+  python3 scripts/wake_log_cost.py --input capture.log --baud 115200
+  pio device monitor | python3 scripts/wake_log_cost.py
+"""
+
+import argparse
+import sys
+
+# 与 config.h 中 SERIAL_BAUD_RATE 一致
+DEFAULT_BAUD = 74880
+
+# 与 main.cpp enterDeepSleep() 中睡眠前等待串口的延时一致
+FLUSH_DELAY_MS = 100
+
+# 每次唤醒输出的第一行
+WAKE_MARKER = "System starting up..."
+
+# 每个字节的位数（起始位 + 8 数据位 + 停止位）
+BITS_PER_BYTE = 10
+
+
+def split_wakes(lines):
+    """按唤醒标记切分日志，返回每次唤醒的行列表（丢弃第一个标记之前的内容）"""
+    wakes = []
+    for line in lines:
+        if WAKE_MARKER in line:
+            wakes.append([])
+        if wakes:
+            wakes[-1].append(line.rstrip("\r\n"))
+    return wakes
+
+
+def wake_bytes(lines):
+    # 每行以 println 结束，加上 \r\n
+    return sum(len(line.encode("utf-8")) + 2 for line in lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="估算正常唤醒中串口日志占用的时间")
+    parser.add_argument("--input", help="set log serial 时抓取的串口日志文件，默认读取标准输入")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD, help="串口波特率")
+    args = parser.parse_args()
+
+    source = open(args.input, "r", errors="replace") if args.input else sys.stdin
+    wakes = split_wakes(source)
+
+    # 最后一次唤醒可能没有抓取完整，只有一次时仍然统计
+    complete = [w for w in wakes if any("Entering deep sleep" in line for line in w)]
+    if not complete:
+        print("No complete wake found (expected '%s' ... 'Entering deep sleep...')" % WAKE_MARKER, file=sys.stderr)
+        return 1
+
+    sizes = [wake_bytes(w) for w in complete]
+    average = float(sum(sizes)) / len(sizes)
+    uart_ms = average * BITS_PER_BYTE * 1000.0 / args.baud
+
+    print("wakes:             %d (%d incomplete ignored)" % (len(complete), len(wakes) - len(complete)))
+    print("log bytes/wake:    avg %.0f, min %d, max %d" % (average, min(sizes), max(sizes)))
+    print("log lines/wake:    avg %.1f" % (float(sum(len(w) for w in complete)) / len(complete)))
+    print("UART time/wake:    %.1f ms at %d baud" % (uart_ms, args.baud))
+    print("flush delay/wake:  %d ms" % FLUSH_DELAY_MS)
+    print("saved with rtc/off: up to %.1f ms awake time per wake" % (uart_ms + FLUSH_DELAY_MS))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -3,21 +3,115 @@
 #include <time.h>
 #include <Wire.h>
 #include <ESP8266mDNS.h>
+#include <coredecls.h>
 #include "../config.h"
 #include "../lib/LogManager/LogManager.h"
+#include "../lib/LogRing/LogRing.h"
 #include "../lib/BM8563/BM8563.h"
 #include "../lib/GDEY029T94/GDEY029T94.h"
 #include "../lib/WeatherManager/WeatherManager.h"
 #include "../lib/WiFiManager/WiFiManager.h"
 #include "../lib/TimeManager/TimeManager.h"
 #include "../lib/SHT40/SHT40.h"
+#include "../lib/I2CBus/I2CBus.h"
 #include "../lib/BatteryMonitor/BatteryMonitor.h"
 #include "../lib/ConfigManager/ConfigManager.h"
 #include "../lib/SerialConfigManager/SerialConfigManager.h"
 #include "../lib/WebConfigManager/WebConfigManager.h"
 #include "../lib/UnifiedConfigManager/UnifiedConfigManager.h"
-#include "../lib/Fonts/Weather_Symbols_Regular9pt7b.h"
-#include "../lib/Fonts/DSEG7Modern_Bold28pt7b.h"
+#include "../lib/ClimateHistory/ClimateHistory.h"
+#include "../lib/FrameCapture/FrameCapture.h"
+#include "../lib/MicroBench/MicroBench.h"
+#include "../lib/WakeScheduler/WakeScheduler.h"
+#include "../lib/QuietHours/QuietHours.h"
+#include "../lib/DeviceSettings/DeviceSettings.h"
+#include "../lib/Metrics/Metrics.h"
+#include "../lib/IdleTimeout/IdleTimeout.h"
+// 字体使用 scripts/subset_fonts.py 生成的子集，只包含实际用到的字符
+#include "../lib/Fonts/subset/Weather_Symbols_Regular9pt7b.h"
+#include "../lib/Fonts/subset/DSEG7Modern_Bold28pt7b.h"
+
+// 堆分配统计（-DUMM_STATS_FULL 编译时可用）
+#ifdef UMM_STATS_FULL
+#include <umm_malloc/umm_malloc.h>
+#endif
+
+// 是否在温湿度栏显示24小时温度趋势图（旧版 config.h 未定义时默认开启）
+#ifndef SHOW_CLIMATE_SPARKLINE
+#define SHOW_CLIMATE_SPARKLINE true
+#endif
+
+// 界面布局（旧版 config.h 未定义时使用标准布局）
+#ifndef DISPLAY_LAYOUT
+#define DISPLAY_LAYOUT 0
+#endif
+
+// 低于该电量时切换到低电量布局
+#ifndef LOW_BATTERY_LAYOUT_PERCENT
+#define LOW_BATTERY_LAYOUT_PERCENT 10
+#endif
+
+// 温湿度测量精度：0=高，1=中，2=低（旧版 config.h 未定义时使用高精度，低电量时使用低精度）
+#ifndef SENSOR_PRECISION
+#define SENSOR_PRECISION 0
+#endif
+#ifndef SENSOR_LOW_BATTERY_PRECISION
+#define SENSOR_LOW_BATTERY_PRECISION 2
+#endif
+
+// 刷新调度参数（旧版 config.h 未定义时使用默认值）
+#ifndef REFRESH_GHOST_BUDGET
+#define REFRESH_GHOST_BUDGET REFRESH_DEFAULT_GHOST_BUDGET
+#endif
+#ifndef NIGHT_REFRESH_START
+#define NIGHT_REFRESH_START REFRESH_DEFAULT_NIGHT_START
+#endif
+#ifndef NIGHT_REFRESH_END
+#define NIGHT_REFRESH_END REFRESH_DEFAULT_NIGHT_END
+#endif
+
+// 夜间静默时段（旧版 config.h 未定义时不启用，可通过串口或网页设置）
+#ifndef DEFAULT_QUIET_HOURS
+#define DEFAULT_QUIET_HOURS ""
+#endif
+
+// 正常唤醒的日志输出："serial"、"rtc"（RTC 内存日志环）或 "off"（静默，不初始化串口）
+// 可通过串口 set log 修改；旧版 config.h 未定义时按 LOG_TO_RTC 选择，都未定义时输出到串口
+#ifndef DEFAULT_LOG_OUTPUT
+#if defined(LOG_TO_RTC) && LOG_TO_RTC
+#define DEFAULT_LOG_OUTPUT "rtc"
+#else
+#define DEFAULT_LOG_OUTPUT "serial"
+#endif
+#endif
+
+// 固件更新密码（旧版 config.h 未定义时禁用固件更新，可通过串口 set otapass 设置）
+#ifndef DEFAULT_UPDATE_PASSWORD
+#define DEFAULT_UPDATE_PASSWORD ""
+#endif
+
+// 配置模式空闲超时（分钟）：无串口输入、HTTP 请求且热点上没有设备时关闭热点，回到正常睡眠；0 表示不超时
+#ifndef CONFIG_IDLE_TIMEOUT_MINUTES
+#define CONFIG_IDLE_TIMEOUT_MINUTES 10
+#endif
+
+// 配置模式事件循环：没有进行中的 HTTP 连接时最长等待多久再检查新连接，等待期间检查串口的间隔（毫秒）
+#ifndef CONFIG_LOOP_POLL_MS
+#define CONFIG_LOOP_POLL_MS 20
+#endif
+#ifndef CONFIG_LOOP_SERIAL_CHECK_MS
+#define CONFIG_LOOP_SERIAL_CHECK_MS 2
+#endif
+
+// 配置热点的发射功率（dBm，0-20.5）：手机通常就在设备旁边，降低功率以减少发射电流
+#ifndef CONFIG_AP_TX_POWER_DBM
+#define CONFIG_AP_TX_POWER_DBM 10
+#endif
+
+// 大时钟布局才需要大号字体，避免其他布局占用 Flash
+#if DISPLAY_LAYOUT == 1
+#include "../lib/Fonts/subset/DSEG7Modern_Bold42pt7b.h"
+#endif
 
 // 创建BM8563对象实例
 BM8563 rtc(I2C_SDA_PIN, I2C_SCL_PIN);
@@ -32,7 +126,7 @@ GDEY029T94 epd(EPD_CS_PIN, EPD_DC_PIN, EPD_RST_PIN, EPD_BUSY_PIN);
 WiFiManager wifiManager;
 
 // 创建统一配置管理器实例
-UnifiedConfigManager unifiedConfigManager(512);
+UnifiedConfigManager unifiedConfigManager(EEPROM_TOTAL_SIZE);
 
 // WeatherManager 指针，将在初始化时创建
 WeatherManager* weatherManager = nullptr;
@@ -42,6 +136,11 @@ SHT40 sht40(I2C_SDA_PIN, I2C_SCL_PIN);
 
 // 创建BatteryMonitor对象实例
 BatteryMonitor battery;
+
+// 启动时读取的电池状态（在 WiFi 开启前采样，ADC 读数更稳定）
+int batteryRawADC = 0;
+float batteryVoltage = NAN;
+float batteryPercentage = NAN;
 // 创建ConfigManager对象实例
 ConfigManager<ConfigData> configManager;
 
@@ -51,7 +150,32 @@ SerialConfigManager serialConfigManager(&configManager);
 // 创建WebConfigManager对象实例
 WebConfigManager webConfigManager(&configManager);
 
+// 创建ClimateHistory对象实例
+ClimateHistory climateHistory;
+
+// 创建FrameCapture对象实例（配置模式下通过串口导出渲染帧）
+FrameCapture frameCapture(&epd);
+
+// 创建MicroBench对象实例（配置模式下通过串口运行热点函数微基准）
+MicroBench microBench(&epd);
+
+// 创建WakeScheduler对象实例（唤醒对齐到整分钟边界）
+WakeScheduler wakeScheduler;
+
+// 创建QuietHours对象实例（夜间静默时段）
+QuietHours quietHours;
+
+// 创建DeviceSettings对象实例（日志输出等运行设置）
+DeviceSettings deviceSettings;
+
+// 创建IdleTimeout对象实例（配置模式空闲超时）
+IdleTimeout idleTimeout;
+
+// 本次唤醒是否联网更新（联网唤醒的耗时不参与唤醒延迟学习）
+bool networkWake = false;
+
 // 函数声明
+void initializeLogging();
 void initializeManagers();
 void initializeSensors();
 void initializeDisplay();
@@ -60,6 +184,10 @@ void initializeTimeManager();
 bool connectAndUpdateWiFi();
 void updateAndDisplay();
 void goToDeepSleep();
+bool enterQuietSleepIfDue();
+void enterDeepSleep();
+DateTime expectedDisplayTime(const DateTime& currentTime);
+bool predictFullRefresh(uint8_t hour, uint8_t minute);
 
 // 配置模式相关函数声明
 bool checkConfigMode();
@@ -68,6 +196,21 @@ void clearRTCWakeupSettings();
 void showConfigDisplay();
 void startAPWebConfigService();
 void exitConfigMode();
+void exitConfigModeOnIdle();
+void waitForConfigEvent();
+
+/**
+ * @brief 按设置选择正常唤醒的日志输出
+ * 输出到 RTC 内存或静默时不初始化串口，睡眠前也无需等待串口发送
+ * 设置在 setup() 开始时已读取
+ */
+void initializeLogging() {
+  LogOutput output = deviceSettings.getLogOutput();
+  if (output == LOG_OUTPUT_SERIAL) {
+    serialConfigManager.initializeSerial();
+  }
+  LogManager::setOutput(output);
+}
 
 /**
  * @brief 初始化各种管理器
@@ -87,10 +230,20 @@ void initializeManagers() {
   LOG_INFO_F("Using City Code: %s", cityCode.c_str());
   
   // 动态创建WeatherManager实例
-  weatherManager = new WeatherManager(apiKey.c_str(), cityCode, &rtc, 512);
+  weatherManager = new WeatherManager(apiKey.c_str(), cityCode, &rtc, EEPROM_TOTAL_SIZE);
   
   // 初始化WeatherManager
   weatherManager->begin();
+  
+  // 初始化室内气候历史记录（从RTC内存恢复待写入样本）
+  climateHistory.begin();
+  
+  // 恢复学习到的唤醒延迟
+  wakeScheduler.begin();
+  wakeScheduler.setInterval(RTC_TIMER_SECONDS);
+  
+  // 读取夜间静默时段
+  quietHours.begin(DEFAULT_QUIET_HOURS);
 }
 
 /**
@@ -102,13 +255,39 @@ void initializeTimeManager() {
   timeManager.begin();
 }
 
+/**
+ * @brief 选择本次唤醒的温湿度测量精度
+ * 电量低于低电量布局阈值时使用更快的低精度测量（屏幕只显示整数度数）
+ */
+SHT40Precision selectSensorPrecision(float percentage) {
+  if (LOW_BATTERY_LAYOUT_PERCENT > 0 && !isnan(percentage) && percentage < LOW_BATTERY_LAYOUT_PERCENT) {
+    return (SHT40Precision)SENSOR_LOW_BATTERY_PRECISION;
+  }
+  return (SHT40Precision)SENSOR_PRECISION;
+}
+
 /**
  * @brief 初始化传感器
+ * 读取电池状态并开始温湿度测量，测量结果在 updateAndDisplay() 中读取，
+ * 期间的网络和显示初始化覆盖了传感器的测量时间
  */
 void initializeSensors() {
-  // 初始化SHT40温湿度传感器
+  // 读取电池状态
+  battery.begin();
+  batteryRawADC = battery.getRawADC();
+  batteryVoltage = battery.getBatteryVoltage();
+  batteryPercentage = battery.getBatteryPercentage();
+  Metrics::set(METRIC_BATTERY_MV, (int32_t)(batteryVoltage * 1000));
+  
+  // 初始化SHT40温湿度传感器并开始测量
   if (sht40.begin()) {
     LOG_INFO("SHT40 initialized successfully");
+    SHT40Precision precision = selectSensorPrecision(batteryPercentage);
+    if (!sht40.startMeasurement(precision)) {
+      LOG_ERROR("Failed to start SHT40 measurement");
+    } else {
+      LOG_DEBUG_F("SHT40 measurement started (precision %d)", precision);
+    }
   } else {
     LOG_ERROR("Failed to initialize SHT40");
   }
@@ -123,6 +302,12 @@ void initializeDisplay() {
   epd.setRotation(DISPLAY_ROTATION);
   epd.setTimeFont(&DSEG7Modern_Bold28pt7b);
   epd.setWeatherSymbolFont(&Weather_Symbols_Regular9pt7b);
+#if DISPLAY_LAYOUT == 1
+  epd.setLargeTimeFont(&DSEG7Modern_Bold42pt7b);
+#endif
+  epd.setLayout((DisplayLayoutId)DISPLAY_LAYOUT);
+  epd.setLowBatteryLayout(LOW_BATTERY_LAYOUT_PERCENT);
+  epd.setRefreshPolicy(REFRESH_GHOST_BUDGET, NIGHT_REFRESH_START, NIGHT_REFRESH_END);
 }
 
 /**
@@ -149,6 +334,7 @@ bool connectAndUpdateWiFi() {
   // 判断是否需要从网络更新天气
   if (weatherManager->shouldUpdateFromNetwork()) {
     LOG_INFO("Weather data is outdated, updating from network...");
+    networkWake = true;
     
     // 从统一配置管理器获取WiFi配置
     String ssid = unifiedConfigManager.getWiFiSSID();
@@ -189,13 +375,19 @@ bool connectAndUpdateWiFi() {
  * @brief 更新传感器数据并显示到屏幕
  */
 void updateAndDisplay() {
-  // 获取当前天气信息和时间
+  // 获取当前天气信息和时间（重新读取 RTC，联网可能耗时数秒）
   WeatherInfo currentWeather = weatherManager->getCurrentWeather();
+  if (timeManager.isTimeValid()) {
+    timeManager.readTimeFromRTC();
+  }
   DateTime currentTime = timeManager.getCurrentTime();
   
-  // 读取温湿度数据（一次性读取，避免重复测量）
+  // 唤醒安排在整分钟边界之前，按预计刷新完成的时刻显示时间，刷新完成时正好进入新的一分钟
+  DateTime displayTime = expectedDisplayTime(currentTime);
+  
+  // 读取启动时开始的温湿度测量（测量通常早已完成，无需等待）
   float temperature, humidity;
-  if (sht40.readTemperatureHumidity(temperature, humidity)) {
+  if (sht40.collectMeasurement(temperature, humidity)) {
     LOG_INFO_F("Current Temperature: %.1f °C", temperature);
     LOG_INFO_F("Current Humidity: %.1f %%RH", humidity);
   } else {
@@ -204,45 +396,80 @@ void updateAndDisplay() {
     humidity = NAN;
   }
   
-  // 初始化并读取电池状态
-  battery.begin();
-  int rawADC = battery.getRawADC();
-  float batteryVoltage = battery.getBatteryVoltage();
-  float batteryPercentage = battery.getBatteryPercentage();
-  
-  // 打印电池状态信息
-  LogManager::printSeparator('=', 15);
-  LogManager::info(F("电池状态"));
-  LogManager::printSeparator('=', 15);
-  LogManager::printKeyValue(F("原始 ADC 值"), rawADC);
-  LogManager::printKeyValue(F("电池电压"), batteryVoltage, 2);
-  LogManager::printKeyValue(F("电池电量"), batteryPercentage, 1);
-  LogManager::printSeparator('=', 15);
+  // 打印启动时读取的电池状态信息
+  if (LogManager::isEnabled(LOG_INFO)) {
+    LogManager::printSeparator('=', 15);
+    LOG_INFO("电池状态");
+    LogManager::printSeparator('=', 15);
+    LogManager::printKeyValue(F("原始 ADC 值"), batteryRawADC);
+    LogManager::printKeyValue(F("电池电压"), batteryVoltage, 2);
+    LogManager::printKeyValue(F("电池电量"), batteryPercentage, 1);
+    LogManager::printSeparator('=', 15);
+  }
+  
+  // 记录室内气候历史（时间无效时无法确定采样时间槽）
+  ClimateSeries series;
+  bool hasSeries = false;
+  if (timeManager.isTimeValid()) {
+    uint32_t now = TimeManager::toEpochSeconds(currentTime);
+    climateHistory.addSample(now, temperature, humidity, batteryPercentage);
+    
+    // 按趋势图宽度抽样最近24小时的温度
+    if (SHOW_CLIMATE_SPARKLINE) {
+      hasSeries = climateHistory.getSeries(CLIMATE_TEMPERATURE, now, 86400, SPARKLINE_WIDTH, series);
+    }
+  }
   
   // 显示到屏幕
-  epd.showTimeDisplay(currentTime, currentWeather, temperature, humidity, batteryPercentage);
+  bool refreshed = epd.showTimeDisplay(displayTime, currentWeather, temperature, humidity, batteryPercentage, hasSeries ? &series : nullptr);
+  
+  // 按刷新方式记录唤醒到刷新完成的耗时，用于安排下次唤醒
+  if (refreshed && !networkWake) {
+    wakeScheduler.recordLatency(WakeScheduler::elapsedMs(), epd.getLastRefreshMode() == REFRESH_FULL);
+  }
 }
 void setup() {
-  // 初始化串口通信
-  serialConfigManager.initializeSerial();
-  LOG_INFO("System starting up...");
-  
-  // 检查是否需要进入配置模式
-  if (checkConfigMode()) {
-    // 进入配置模式
+  // 读取设备设置（日志输出、配置模式超时记录），直接读 Flash，不输出日志
+  deviceSettings.begin(DEFAULT_LOG_OUTPUT, DEFAULT_UPDATE_PASSWORD);
+  
+  // 检查是否需要进入配置模式（不依赖串口，RXD 引脚此时作为 GPIO 读取）
+  // 配置模式空闲超时后 RXD 仍被拉低时按正常模式运行，直到 RXD 恢复高电平
+  bool rxdLow = checkConfigMode();
+  if (rxdLow && !deviceSettings.isConfigModeSuppressed()) {
+    // 配置模式总是初始化串口，日志输出到串口（日志环用 logs 命令查看）
+    serialConfigManager.initializeSerial();
+    LOG_INFO("System starting up...");
+    LOG_INFO("RXD pin is LOW, entering configuration mode");
     initializeDisplay();  // 配置模式需要显示屏
     initializeRTC();      // 配置模式需要RTC来清除唤醒设置
     enterConfigMode();    // 进入配置模式（不会返回）
     return;
   }
   
-  // 正常运行模式
-  initializeManagers();
+  // 正常运行模式：只有日志输出到串口时才初始化串口
+  initializeLogging();
+  LOG_INFO("System starting up...");
+  if (rxdLow) {
+    LOG_WARN("RXD pin is LOW but configuration mode timed out, release RXD to reconfigure");
+  } else {
+    LOG_INFO("RXD pin is HIGH, normal operation mode");
+    // RXD 已释放，之后拉低即可重新进入配置模式（记录存在时才写 Flash）
+    deviceSettings.setConfigModeSuppressed(false);
+  }
+  Metrics::increment(METRIC_WAKES);
+  
+  // 先开始温湿度测量，与后续初始化并行
   initializeSensors();
+  initializeManagers();
   initializeDisplay();
   initializeRTC();
   initializeTimeManager();  // 必须在RTC初始化之后
   
+  // 处于夜间静默时段时显示休眠画面并睡到结束时间（不会返回）
+  if (enterQuietSleepIfDue()) {
+    return;
+  }
+  
   connectAndUpdateWiFi();
   updateAndDisplay();
   
@@ -260,14 +487,95 @@ void goToDeepSleep() {
   LOG_INFO("Setting up and entering deep sleep...");
   
   // 配置 RTC 定时器在指定时间后通过 INT 引脚唤醒 ESP8266
-  rtc.setupWakeupTimer(RTC_TIMER_SECONDS);
-  LOG_INFO("RTC wakeup timer configured");
+  // 按 RTC 当前时间对齐到下一个周期边界（提前量为预测的刷新方式对应的唤醒延迟），时间无效时使用固定周期
+  uint16_t sleepSeconds = RTC_TIMER_SECONDS;
+  BM8563_Time now;
+  if (timeManager.isTimeValid() && rtc.getTime(&now)) {
+    sleepSeconds = wakeScheduler.computeSleepSeconds(now.hours, now.minutes, now.seconds, predictFullRefresh);
+  }
+  rtc.setupWakeupTimer(sleepSeconds);
+  LOG_INFO_F("RTC wakeup timer configured: %u s (wake latency partial %lu ms, full %lu ms)", sleepSeconds,
+             wakeScheduler.getLatencyMs(false), wakeScheduler.getLatencyMs(true));
+  
+  enterDeepSleep();
+}
+
+/**
+ * @brief 按预计刷新完成的时刻计算要显示的时间
+ * 时间无效或尚未学习到唤醒延迟时直接使用当前时间
+ */
+DateTime expectedDisplayTime(const DateTime& currentTime) {
+  uint32_t lookahead = wakeScheduler.getLookaheadSeconds(currentTime.hour, currentTime.minute, currentTime.second, predictFullRefresh);
+  if (!timeManager.isTimeValid() || lookahead == 0) {
+    return currentTime;
+  }
+  return TimeManager::fromEpochSeconds(TimeManager::toEpochSeconds(currentTime) + lookahead);
+}
+
+/**
+ * @brief 预测显示 hour:minute 时屏幕是否全刷（唤醒调度按刷新方式选择提前量）
+ */
+bool predictFullRefresh(uint8_t hour, uint8_t minute) {
+  return epd.predictRefresh(hour, minute) == REFRESH_FULL;
+}
+
+/**
+ * @brief 处于夜间静默时段时显示休眠画面，用 RTC 分钟定时器睡到静默结束
+ * 定时器最长 255 分钟，更长的静默时段中途唤醒后按剩余时间重新设置
+ * （休眠画面已在屏幕上时不再刷新）。不使用闹钟：闹钟标志会一直拉低 INT，
+ * ESP8266 保持在复位状态无法启动
+ * @return 是否进入了静默睡眠（进入时不会返回）
+ */
+bool enterQuietSleepIfDue() {
+  if (!quietHours.isEnabled() || !timeManager.isTimeValid()) {
+    return false;
+  }
+  
+  DateTime now = expectedDisplayTime(timeManager.getCurrentTime());
+  if (!quietHours.isQuiet(now.hour, now.minute)) {
+    return false;
+  }
+  
+  uint8_t endHour = quietHours.getEndHour();
+  uint8_t endMinute = quietHours.getEndMinute();
+  LOG_INFO_F("Quiet hours %s active, sleeping until %02u:%02u", quietHours.format().c_str(), endHour, endMinute);
+  
+  epd.showSleepDisplay(endHour, endMinute);
+  
+  uint16_t sleepMinutes = min(quietHours.minutesUntilEnd(now.hour, now.minute), (uint16_t)255);
+  rtc.setupMinuteWakeupTimer(sleepMinutes);
+  LOG_INFO_F("RTC wakeup timer configured: %u min", sleepMinutes);
+  
+  enterDeepSleep();
+  return true;
+}
+
+/**
+ * @brief 进入深度睡眠
+ * RTC 唤醒定时器必须在调用前设置好
+ */
+void enterDeepSleep() {
+  LOG_INFO_F("I2C transactions this wake: %u (%u failed)", I2CBus::getTransactionCount(), I2CBus::getErrorCount());
+#ifdef UMM_STATS_FULL
+  LOG_INFO_F("Heap calls this wake: %u malloc, %u realloc, %u free",
+             umm_get_malloc_count(), umm_get_realloc_count(), umm_get_free_count());
+#endif
+  LOG_INFO_F("Free heap: %u bytes (largest block %u, fragmentation %u%%)",
+             ESP.getFreeHeap(), ESP.getMaxFreeBlockSize(), ESP.getHeapFragmentation());
+  
+  // 记录本次唤醒的指标（保存在 RTC 内存，配置模式下用 stats 或 /metrics 查看）
+  Metrics::set(METRIC_FREE_HEAP, ESP.getFreeHeap());
+  Metrics::observe(METRIC_WAKE_DURATION, millis());
   
   LOG_INFO("Entering deep sleep...");
-  Serial.flush();
   
-  // 等待串口输出完成
-  delay(100);
+  // 等待串口输出完成；二进制日志在 RAM 中累积，睡眠前一次写入 RTC 内存，无需等待串口
+  if (LogManager::getOutput() == LOG_OUTPUT_SERIAL) {
+    Serial.flush();
+    delay(100);
+  } else {
+    LogRing::flush();
+  }
   
   // 进入深度睡眠，参数 0 表示无限期睡眠直到外部唤醒
   // 实际唤醒由 RTC 定时器触发硬件复位实现
@@ -285,15 +593,8 @@ bool checkConfigMode() {
   delay(10); // 等待引脚状态稳定
   
   // 读取RXD引脚状态，如果被拉低则进入配置模式
-  bool isConfigMode = (digitalRead(RXD_PIN) == LOW);
-  
-  if (isConfigMode) {
-    LOG_INFO("RXD pin is LOW, entering configuration mode");
-  } else {
-    LOG_INFO("RXD pin is HIGH, normal operation mode");
-  }
-  
-  return isConfigMode;
+  // 此时日志尚未初始化，由调用方在选定日志输出后记录结果
+  return digitalRead(RXD_PIN) == LOW;
 }
 
 /**
@@ -311,25 +612,121 @@ void enterConfigMode() {
   
   // 3. 初始化ConfigManager
   configManager.begin();
+  quietHours.begin(DEFAULT_QUIET_HOURS);
+  serialConfigManager.setQuietHours(&quietHours);
+  serialConfigManager.setDeviceSettings(&deviceSettings);
+  webConfigManager.setQuietHours(&quietHours);
+  webConfigManager.setIdleTimeout(&idleTimeout);
+  webConfigManager.setDeviceSettings(&deviceSettings);
   
   // 4. 启动配置服务
   startAPWebConfigService();
+  serialConfigManager.addCommand("frame", "Export the current frame as PBM hex", [](const char*) {
+    frameCapture.captureCurrent(Serial);
+  });
+  serialConfigManager.addCommand("frames", "Render test frames [filter] as PBM hex", [](const char* args) {
+    frameCapture.captureMatrix(Serial, args);
+  });
+  serialConfigManager.addCommand("logs", "Print the RTC log ring [raw|clear]", [](const char* args) {
+    if (strcmp(args, "raw") == 0) {
+      LogRing::dump(Serial);
+    } else if (strcmp(args, "clear") == 0) {
+      LogRing::clear();
+      Serial.println(F("RTC log cleared"));
+    } else {
+      LogRing::print(Serial);
+    }
+  });
+  serialConfigManager.addCommand("framebench", "Compare GFX and fast render paths [iterations]", [](const char* args) {
+    frameCapture.benchmark(Serial, args[0] != '\0' ? atoi(args) : 10);
+  });
+  serialConfigManager.addCommand("bench", "Run microbenchmarks as JSON [filter] [repetitions]", [](const char* args) {
+    // 第一个参数为数字时表示轮数，否则为用例名称过滤
+    char buffer[SERIAL_COMMAND_LINE_SIZE];
+    strlcpy(buffer, args, sizeof(buffer));
+    char* cursor = buffer;
+    char* filter = CommandLine::nextToken(cursor);
+    if (isdigit((unsigned char)filter[0])) {
+      microBench.run(Serial, "", atoi(filter));
+      return;
+    }
+    char* repetitions = CommandLine::nextToken(cursor);
+    microBench.run(Serial, filter, repetitions[0] != '\0' ? atoi(repetitions) : MICROBENCH_DEFAULT_REPETITIONS);
+  });
   serialConfigManager.startConfigService();
   
   // 5. 在屏幕显示配置信息提示（需要先启动服务获取IP）
   showConfigDisplay();
   
   LOG_INFO("Configuration mode services started");
-  // 配置模式下保持运行，不进入深度睡眠
-  while (true) {
+  
+  // 6. 开始空闲计时：串口输入、HTTP 请求（WebConfigManager 记录）或热点上有设备时重新计时
+  idleTimeout.begin(CONFIG_IDLE_TIMEOUT_MINUTES * 60UL);
+  if (idleTimeout.isEnabled()) {
+    LOG_INFO_F("Configuration mode idle timeout: %u min", CONFIG_IDLE_TIMEOUT_MINUTES);
+  }
+  
+  // 配置模式下保持运行，空闲超时后回到正常的深度睡眠周期
+  while (!idleTimeout.isExpired()) {
     // 处理串口命令
-    serialConfigManager.processInput();
+    if (serialConfigManager.processInput()) {
+      idleTimeout.touch();
+    }
     
     // 处理Web请求
     webConfigManager.handleClient();
     
-    delay(100); // 减少延时，提高响应性
+    // 连着热点的设备可能正在查看配置页面
+    if (WiFi.softAPgetStationNum() > 0) {
+      idleTimeout.touch();
+    }
+    
+    waitForConfigEvent();
+  }
+  
+  exitConfigModeOnIdle();
+}
+
+/**
+ * @brief 配置模式事件循环的等待
+ * 有进行中的 HTTP 连接时只让出 1 毫秒，请求的后续数据到达后立即处理；
+ * 否则把 CPU 交给 SDK，串口收到数据时提前返回，最长等待 CONFIG_LOOP_POLL_MS 后检查新连接
+ */
+void waitForConfigEvent() {
+  if (webConfigManager.hasActiveClient()) {
+    delay(1);
+    return;
   }
+  esp_delay(CONFIG_LOOP_POLL_MS, []() { return Serial.available() == 0; }, CONFIG_LOOP_SERIAL_CHECK_MS);
+}
+
+/**
+ * @brief 配置模式空闲超时：关闭热点，显示超时画面，回到正常的深度睡眠周期
+ * 记录超时，RXD 仍被拉低时后续唤醒不再进入配置模式（不会返回）
+ */
+void exitConfigModeOnIdle() {
+  LOG_WARN_F("Configuration mode idle for %u min, shutting down AP", CONFIG_IDLE_TIMEOUT_MINUTES);
+  
+  webConfigManager.stopWebServer();
+  webConfigManager.setConfigMode(false);
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_OFF);
+  
+  epd.showConfigTimeoutDisplay(CONFIG_IDLE_TIMEOUT_MINUTES);
+  
+  if (!deviceSettings.setConfigModeSuppressed(true)) {
+    LOG_ERROR("Failed to save configuration timeout");
+  }
+  
+  // 配置模式下时间可能未同步，按固定周期唤醒，之后由正常流程对齐
+  rtc.setupWakeupTimer(RTC_TIMER_SECONDS);
+  LOG_INFO_F("RTC wakeup timer configured: %u s", RTC_TIMER_SECONDS);
+  
+  // 不经过 enterDeepSleep()：配置模式的停留时间不计入唤醒耗时指标
+  LOG_INFO("Entering deep sleep...");
+  Serial.flush();
+  delay(100);
+  ESP.deepSleep(0);
 }
 
 /**
@@ -342,10 +739,7 @@ void clearRTCWakeupSettings() {
   // 清除定时器设置
   rtc.clearTimer();
   
-  // 禁用定时器中断
-  rtc.enableTimerInterrupt(false);
-  
-  // 清除所有中断标志
+  // 禁用定时器和闹钟中断并清除所有中断标志（一次写入）
   rtc.resetInterrupts();
   
   LOG_INFO("RTC wakeup settings cleared");
@@ -380,7 +774,10 @@ void startAPWebConfigService() {
   const char* apName = "WeWeather";
   const char* apPassword = ""; // 无密码的开放热点
   
+  // 软 AP 必须持续收发信标，ESP8266 在 AP 模式下不能进入 modem sleep 或 light sleep，
+  // 只能降低发射功率
   WiFi.mode(WIFI_AP);
+  WiFi.setOutputPower(CONFIG_AP_TX_POWER_DBM);
   bool apStarted = WiFi.softAP(apName, apPassword);
   
   if (apStarted) {
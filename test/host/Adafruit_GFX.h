@@ -0,0 +1,522 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+// 主机测试用的 Adafruit_GFX 替身：按 Adafruit GFX Library 的算法实现界面用到的绘图函数
+// （自定义字体的 write/drawChar/getTextBounds、直线、矩形、GFXcanvas1 的旋转和 1bpp 缓冲），
+// 成员名称与原库相同，EPaperCanvas 的快速路径和回退路径都能在主机上运行并逐像素比较。
+// 不包含内置 5x7 字体：未设置字体时只移动光标，不绘制
+#include <Arduino.h>
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+#define pgm_read_pointer(addr) ((void*)pgm_read_ptr(addr))
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h) {
+  }
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite() {}
+  virtual void endWrite() {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      std::swap(x0, y0);
+      std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+      std::swap(x0, x1);
+      std::swap(y0, y1);
+    }
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+      if (steep) {
+        writePixel(y0, x0, color);
+      } else {
+        writePixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x, y + h - 1, color);
+    endWrite();
+  }
+
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x + w - 1, y, color);
+    endWrite();
+  }
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    for (int16_t i = x; i < x + w; i++) {
+      writeFastVLine(i, y, h, color);
+    }
+    endWrite();
+  }
+
+  virtual void fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+  }
+
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 == x1) {
+      if (y0 > y1) std::swap(y0, y1);
+      drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if (y0 == y1) {
+      if (x0 > x1) std::swap(x0, x1);
+      drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+      startWrite();
+      writeLine(x0, y0, x1, y1, color);
+      endWrite();
+    }
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+    endWrite();
+  }
+
+  virtual void setRotation(uint8_t r) {
+    rotation = r & 3;
+    if (rotation & 1) {
+      _width = HEIGHT;
+      _height = WIDTH;
+    } else {
+      _width = WIDTH;
+      _height = HEIGHT;
+    }
+  }
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+    drawChar(x, y, c, color, bg, size, size);
+  }
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+    (void)bg;
+    if (!gfxFont) {
+      return;
+    }
+    c -= (uint8_t)pgm_read_byte(&gfxFont->first);
+    const GFXglyph* glyph = ((const GFXglyph*)pgm_read_pointer(&gfxFont->glyph)) + c;
+    const uint8_t* bitmap = (const uint8_t*)pgm_read_pointer(&gfxFont->bitmap);
+
+    uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t w = pgm_read_byte(&glyph->width);
+    uint8_t h = pgm_read_byte(&glyph->height);
+    int8_t xo = pgm_read_byte(&glyph->xOffset);
+    int8_t yo = pgm_read_byte(&glyph->yOffset);
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    int16_t xo16 = 0;
+    int16_t yo16 = 0;
+    if (size_x > 1 || size_y > 1) {
+      xo16 = xo;
+      yo16 = yo;
+    }
+
+    startWrite();
+    for (uint8_t yy = 0; yy < h; yy++) {
+      for (uint8_t xx = 0; xx < w; xx++) {
+        if (!(bit++ & 7)) {
+          bits = pgm_read_byte(&bitmap[bo++]);
+        }
+        if (bits & 0x80) {
+          if (size_x == 1 && size_y == 1) {
+            writePixel(x + xo + xx, y + yo + yy, color);
+          } else {
+            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y, size_x, size_y, color);
+          }
+        }
+        bits <<= 1;
+      }
+    }
+    endWrite();
+  }
+
+  size_t write(uint8_t c) override {
+    if (!gfxFont) {
+      if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      } else if (c != '\r') {
+        if (wrap && (cursor_x + textsize_x * 6) > _width) {
+          cursor_x = 0;
+          cursor_y += textsize_y * 8;
+        }
+        cursor_x += textsize_x * 6;
+      }
+      return 1;
+    }
+
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += (int16_t)textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    } else if (c != '\r') {
+      uint8_t first = pgm_read_byte(&gfxFont->first);
+      if (c >= first && c <= (uint8_t)pgm_read_byte(&gfxFont->last)) {
+        const GFXglyph* glyph = ((const GFXglyph*)pgm_read_pointer(&gfxFont->glyph)) + (c - first);
+        uint8_t w = pgm_read_byte(&glyph->width);
+        uint8_t h = pgm_read_byte(&glyph->height);
+        if (w > 0 && h > 0) {
+          int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+          if (wrap && (cursor_x + textsize_x * (xo + w)) > _width) {
+            cursor_x = 0;
+            cursor_y += (int16_t)textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+          }
+          drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        }
+        cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize_x;
+      }
+    }
+    return 1;
+  }
+  using Print::write;
+
+  void setFont(const GFXfont* f) {
+    if (f) {
+      if (!gfxFont) {
+        cursor_y += 6;
+      }
+    } else if (gfxFont) {
+      cursor_y -= 6;
+    }
+    gfxFont = (GFXfont*)f;
+  }
+
+  void setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+  void setTextSize(uint8_t s) { textsize_x = textsize_y = s > 0 ? s : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+
+  void getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+    uint8_t c;
+    while ((c = *str++)) {
+      charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    }
+    if (maxx >= minx) {
+      *x1 = minx;
+      *w = maxx - minx + 1;
+    }
+    if (maxy >= miny) {
+      *y1 = miny;
+      *h = maxy - miny + 1;
+    }
+  }
+
+  void getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+  }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  uint8_t getRotation() const { return rotation; }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+
+protected:
+  void charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy) {
+    if (!gfxFont) {
+      if (c == '\n') {
+        *x = 0;
+        *y += textsize_y * 8;
+      } else if (c != '\r') {
+        if (wrap && (*x + textsize_x * 6) > _width) {
+          *x = 0;
+          *y += textsize_y * 8;
+        }
+        int x2 = *x + textsize_x * 6 - 1;
+        int y2 = *y + textsize_y * 8 - 1;
+        if (x2 > *maxx) *maxx = x2;
+        if (y2 > *maxy) *maxy = y2;
+        if (*x < *minx) *minx = *x;
+        if (*y < *miny) *miny = *y;
+        *x += textsize_x * 6;
+      }
+      return;
+    }
+
+    if (c == '\n') {
+      *x = 0;
+      *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    } else if (c != '\r') {
+      uint8_t first = pgm_read_byte(&gfxFont->first);
+      uint8_t last = pgm_read_byte(&gfxFont->last);
+      if (c >= first && c <= last) {
+        const GFXglyph* glyph = ((const GFXglyph*)pgm_read_pointer(&gfxFont->glyph)) + (c - first);
+        uint8_t gw = pgm_read_byte(&glyph->width);
+        uint8_t gh = pgm_read_byte(&glyph->height);
+        uint8_t xa = pgm_read_byte(&glyph->xAdvance);
+        int8_t xo = pgm_read_byte(&glyph->xOffset);
+        int8_t yo = pgm_read_byte(&glyph->yOffset);
+        if (wrap && (*x + ((int16_t)xo + gw) * textsize_x) > _width) {
+          *x = 0;
+          *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+        }
+        int16_t x1 = *x + xo * textsize_x;
+        int16_t y1 = *y + yo * textsize_y;
+        int16_t x2 = x1 + gw * textsize_x - 1;
+        int16_t y2 = y1 + gh * textsize_y - 1;
+        if (x1 < *minx) *minx = x1;
+        if (y1 < *miny) *miny = y1;
+        if (x2 > *maxx) *maxx = x2;
+        if (y2 > *maxy) *maxy = y2;
+        *x += xa * textsize_x;
+      }
+    }
+  }
+
+  int16_t WIDTH;
+  int16_t HEIGHT;
+  int16_t _width;
+  int16_t _height;
+  int16_t cursor_x = 0;
+  int16_t cursor_y = 0;
+  uint16_t textcolor = 0xFFFF;
+  uint16_t textbgcolor = 0xFFFF;
+  uint8_t textsize_x = 1;
+  uint8_t textsize_y = 1;
+  uint8_t rotation = 0;
+  bool wrap = true;
+  GFXfont* gfxFont = nullptr;
+};
+
+// 1bpp 画布：原生方向按行存储，每行 (WIDTH + 7) / 8 字节，字节内高位在左，1 = 白色（GxEPD_WHITE）
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h)
+    : Adafruit_GFX(w, h),
+      buffer((uint8_t*)calloc((w + 7) / 8 * h, 1)) {
+  }
+
+  ~GFXcanvas1() {
+    free(buffer);
+  }
+
+  GFXcanvas1(const GFXcanvas1&) = delete;
+  GFXcanvas1& operator=(const GFXcanvas1&) = delete;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (!buffer || x < 0 || y < 0 || x >= _width || y >= _height) {
+      return;
+    }
+    toNative(x, y);
+    uint8_t* ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    if (color) {
+      *ptr |= 0x80 >> (x & 7);
+    } else {
+      *ptr &= ~(0x80 >> (x & 7));
+    }
+  }
+
+  void fillScreen(uint16_t color) override {
+    if (buffer) {
+      memset(buffer, color ? 0xFF : 0x00, (WIDTH + 7) / 8 * HEIGHT);
+    }
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    if (h < 0) {
+      h *= -1;
+      y -= h - 1;
+      if (y < 0) {
+        h += y;
+        y = 0;
+      }
+    }
+    if (x < 0 || x >= width() || y >= height() || (y + h - 1) < 0) {
+      return;
+    }
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+    if (y + h > height()) {
+      h = height() - y;
+    }
+
+    int16_t t;
+    switch (rotation) {
+      case 0:
+        drawFastRawVLine(x, y, h, color);
+        break;
+      case 1:
+        t = x;
+        x = WIDTH - 1 - y;
+        y = t;
+        x -= h - 1;
+        drawFastRawHLine(x, y, h, color);
+        break;
+      case 2:
+        x = WIDTH - 1 - x;
+        y = HEIGHT - 1 - y;
+        y -= h - 1;
+        drawFastRawVLine(x, y, h, color);
+        break;
+      case 3:
+        t = x;
+        x = y;
+        y = HEIGHT - 1 - t;
+        drawFastRawHLine(x, y, h, color);
+        break;
+    }
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    if (w < 0) {
+      w *= -1;
+      x -= w - 1;
+      if (x < 0) {
+        w += x;
+        x = 0;
+      }
+    }
+    if (y < 0 || y >= height() || x >= width() || (x + w - 1) < 0) {
+      return;
+    }
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+    if (x + w >= width()) {
+      w = width() - x;
+    }
+
+    int16_t t;
+    switch (rotation) {
+      case 0:
+        drawFastRawHLine(x, y, w, color);
+        break;
+      case 1:
+        t = x;
+        x = WIDTH - 1 - y;
+        y = t;
+        drawFastRawVLine(x, y, w, color);
+        break;
+      case 2:
+        x = WIDTH - 1 - x;
+        y = HEIGHT - 1 - y;
+        x -= w - 1;
+        drawFastRawHLine(x, y, w, color);
+        break;
+      case 3:
+        t = x;
+        x = y;
+        y = HEIGHT - 1 - t;
+        y -= w - 1;
+        drawFastRawVLine(x, y, w, color);
+        break;
+    }
+  }
+
+  bool getPixel(int16_t x, int16_t y) const {
+    toNative(x, y);
+    return getRawPixel(x, y);
+  }
+
+  uint8_t* getBuffer() const {
+    return buffer;
+  }
+
+protected:
+  bool getRawPixel(int16_t x, int16_t y) const {
+    if (!buffer || x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) {
+      return false;
+    }
+    return (buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7))) != 0;
+  }
+
+  void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t i = 0; i < h; i++) {
+      setRawPixel(x, y + i, color);
+    }
+  }
+
+  void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    for (int16_t i = 0; i < w; i++) {
+      setRawPixel(x + i, y, color);
+    }
+  }
+
+private:
+  void toNative(int16_t& x, int16_t& y) const {
+    int16_t t;
+    switch (rotation) {
+      case 1:
+        t = x;
+        x = WIDTH - 1 - y;
+        y = t;
+        break;
+      case 2:
+        x = WIDTH - 1 - x;
+        y = HEIGHT - 1 - y;
+        break;
+      case 3:
+        t = x;
+        x = y;
+        y = HEIGHT - 1 - t;
+        break;
+    }
+  }
+
+  void setRawPixel(int16_t x, int16_t y, uint16_t color) {
+    uint8_t* ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    if (color) {
+      *ptr |= 0x80 >> (x & 7);
+    } else {
+      *ptr &= ~(0x80 >> (x & 7));
+    }
+  }
+
+  uint8_t* buffer;
+};
+
+#endif // HOST_ADAFRUIT_GFX_H
@@ -0,0 +1,307 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// 主机测试用的 Arduino 核心替身：只提供被测库用到的接口，行为与 ESP8266 Arduino 核心一致
+// （String 的数值格式、Print 的输出、pgm_read_*、RTC 用户内存），网络和外设不模拟
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define DEC 10
+#define HEX 16
+
+// ==================== PROGMEM ====================
+// 主机上常量与普通数据位于同一地址空间，直接解引用
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcpy_P strcpy
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define FPSTR(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+// ==================== 计时 ====================
+// 测试可直接设置 hostMicros 模拟时间流逝，yield() 不做任何事
+inline unsigned long hostMicros = 0;
+
+inline unsigned long micros() {
+  return hostMicros;
+}
+
+inline unsigned long millis() {
+  return hostMicros / 1000;
+}
+
+inline void delay(unsigned long ms) {
+  hostMicros += ms * 1000;
+}
+
+inline void yield() {
+}
+
+// ==================== String ====================
+// 与 ESP8266 核心的 String 一致：数值构造的格式、replace() 替换全部匹配、
+// concat() 返回是否成功（ArduinoJson 的 String 写入依赖该返回值）
+class String {
+public:
+  String() {}
+  String(const char* cstr) : _s(cstr ? cstr : "") {}
+  String(const __FlashStringHelper* str) : _s(str ? (const char*)str : "") {}
+  String(const String& other) = default;
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int value, unsigned char base = 10) : _s(formatInteger(value, base)) {}
+  explicit String(unsigned int value, unsigned char base = 10) : _s(formatInteger(value, base)) {}
+  explicit String(long value, unsigned char base = 10) : _s(formatInteger(value, base)) {}
+  explicit String(unsigned long value, unsigned char base = 10) : _s(formatInteger(value, base)) {}
+  explicit String(float value, unsigned char decimalPlaces = 2) : _s(formatFloat(value, decimalPlaces)) {}
+  explicit String(double value, unsigned char decimalPlaces = 2) : _s(formatFloat(value, decimalPlaces)) {}
+
+  String& operator=(const String& other) = default;
+  String& operator=(const char* cstr) {
+    _s = cstr ? cstr : "";
+    return *this;
+  }
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+  char operator[](unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+  char& operator[](unsigned int index) { return _s[index]; }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+
+  bool concat(const String& str) { _s += str._s; return true; }
+  bool concat(const char* cstr) { if (!cstr) return false; _s += cstr; return true; }
+  bool concat(char c) { _s += c; return true; }
+  bool concat(int value) { return concat(String(value)); }
+  bool concat(unsigned int value) { return concat(String(value)); }
+  bool concat(long value) { return concat(String(value)); }
+  bool concat(unsigned long value) { return concat(String(value)); }
+  bool concat(float value) { return concat(String(value)); }
+  bool concat(double value) { return concat(String(value)); }
+
+  template <typename T>
+  String& operator+=(const T& value) { concat(value); return *this; }
+
+  bool equals(const String& other) const { return _s == other._s; }
+  bool equals(const char* cstr) const { return _s == (cstr ? cstr : ""); }
+  bool operator==(const String& other) const { return equals(other); }
+  bool operator==(const char* cstr) const { return equals(cstr); }
+  bool operator!=(const String& other) const { return !equals(other); }
+  bool operator!=(const char* cstr) const { return !equals(cstr); }
+  bool operator<(const String& other) const { return _s < other._s; }
+
+  bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+  bool endsWith(const String& suffix) const {
+    return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return position(_s.find(c, from)); }
+  int indexOf(const String& str, unsigned int from = 0) const { return position(_s.find(str._s, from)); }
+  int lastIndexOf(char c) const { return position(_s.rfind(c)); }
+
+  String substring(unsigned int left) const { return substring(left, _s.size()); }
+  String substring(unsigned int left, unsigned int right) const {
+    if (left > right) std::swap(left, right);
+    if (left >= _s.size()) return String();
+    return String(_s.substr(left, std::min<size_t>(right, _s.size()) - left).c_str());
+  }
+
+  void replace(const String& find, const String& replacement) {
+    if (find._s.empty()) return;
+    size_t pos = 0;
+    while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+      _s.replace(pos, find._s.size(), replacement._s);
+      pos += replacement._s.size();
+    }
+  }
+
+  void trim() {
+    size_t begin = _s.find_first_not_of(" \t\r\n");
+    size_t end = _s.find_last_not_of(" \t\r\n");
+    _s = begin == std::string::npos ? std::string() : _s.substr(begin, end - begin + 1);
+  }
+
+  void toLowerCase() { for (char& c : _s) c = tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : _s) c = toupper((unsigned char)c); }
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return atof(_s.c_str()); }
+
+private:
+  static int position(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+  template <typename T>
+  static std::string formatInteger(T value, unsigned char base) {
+    char buf[8 * sizeof(T) + 2];
+    if (base == 10) {
+      snprintf(buf, sizeof(buf), "%lld", (long long)value);
+    } else {
+      // 与 itoa/ultoa 一致，非十进制按无符号输出
+      unsigned long long v = (unsigned long long)(typename std::make_unsigned<T>::type)value;
+      char* p = buf + sizeof(buf) - 1;
+      *p = '\0';
+      do {
+        int digit = v % base;
+        *--p = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        v /= base;
+      } while (v);
+      return std::string(p);
+    }
+    return std::string(buf);
+  }
+
+  // ESP8266 核心：String(float, n) = dtostrf(value, n + 2, n, buf)，最小宽度 n + 2，不足时左侧补空格
+  static std::string formatFloat(double value, unsigned char decimalPlaces) {
+    char buf[33];
+    snprintf(buf, sizeof(buf), "%*.*f", decimalPlaces + 2, decimalPlaces, value);
+    return std::string(buf);
+  }
+
+  std::string _s;
+};
+
+// ArduinoJson 按类型识别 String 和 StringSumHelper
+class StringSumHelper : public String {
+public:
+  StringSumHelper(const String& s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& lhs, const String& rhs) {
+  StringSumHelper result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline StringSumHelper operator+(const String& lhs, const char* rhs) {
+  StringSumHelper result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline StringSumHelper operator+(const String& lhs, char rhs) {
+  StringSumHelper result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline bool operator==(const char* lhs, const String& rhs) {
+  return rhs == lhs;
+}
+
+// ==================== Print ====================
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+  size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper* str) { return write((const char*)str); }
+  size_t print(const String& str) { return write(str.c_str()); }
+  size_t print(const char* str) { return write(str); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned int value, int base = DEC) { return print(String(value, base)); }
+  size_t print(long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(double value, int digits = 2) {
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", digits, value);
+    return write(buf);
+  }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(const T& value) { return print(value) + println(); }
+  template <typename T>
+  size_t println(const T& value, int format) { return print(value, format) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return len > 0 ? write((const uint8_t*)buf, std::min<size_t>(len, sizeof(buf) - 1)) : 0;
+  }
+};
+
+// ==================== ESP ====================
+// RTC 用户内存（512 字节，按 4 字节块寻址）用数组模拟，初始为全 0，CRC 校验不通过即视为冷启动；
+// Flash 读取总是失败（配置记录走 EEPROM 副本）
+class EspClass {
+public:
+  bool rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size) {
+    if (offset * 4 + size > sizeof(rtcMemory) || size == 0) {
+      return false;
+    }
+    memcpy(data, (const uint8_t*)rtcMemory + offset * 4, size);
+    return true;
+  }
+
+  bool rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size) {
+    if (offset * 4 + size > sizeof(rtcMemory) || size == 0) {
+      return false;
+    }
+    memcpy((uint8_t*)rtcMemory + offset * 4, data, size);
+    return true;
+  }
+
+  bool flashRead(uint32_t address, uint32_t* data, size_t size) {
+    (void)address;
+    (void)data;
+    (void)size;
+    return false;
+  }
+
+  // 模拟断电：清空 RTC 用户内存
+  void clearRtcMemory() {
+    memset(rtcMemory, 0, sizeof(rtcMemory));
+  }
+
+private:
+  uint32_t rtcMemory[128] = {};
+};
+
+inline EspClass ESP;
+
+#endif // HOST_ARDUINO_H
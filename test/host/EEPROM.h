@@ -0,0 +1,64 @@
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+// 主机测试用的 EEPROM 替身：内存中的字节数组，commit() 总是成功
+#include <Arduino.h>
+
+// 链接脚本中 EEPROM 扇区的起始符号，主机上 Flash 读取总是失败，不会用到该地址
+extern "C" uint32_t _EEPROM_start;
+
+class EEPROMClass {
+public:
+  void begin(size_t size) {
+    _size = min(size, sizeof(_data));
+  }
+
+  uint8_t read(int address) const {
+    return valid(address, 1) ? _data[address] : 0;
+  }
+
+  void write(int address, uint8_t value) {
+    if (valid(address, 1)) {
+      _data[address] = value;
+    }
+  }
+
+  template <typename T>
+  T& get(int address, T& value) const {
+    if (valid(address, sizeof(T))) {
+      memcpy(&value, _data + address, sizeof(T));
+    }
+    return value;
+  }
+
+  template <typename T>
+  const T& put(int address, const T& value) {
+    if (valid(address, sizeof(T))) {
+      memcpy(_data + address, &value, sizeof(T));
+    }
+    return value;
+  }
+
+  bool commit() {
+    return true;
+  }
+
+  void end() {
+  }
+
+  size_t length() const {
+    return _size;
+  }
+
+private:
+  bool valid(int address, size_t length) const {
+    return address >= 0 && (size_t)address + length <= _size;
+  }
+
+  uint8_t _data[4096] = {};
+  size_t _size = 0;
+};
+
+inline EEPROMClass EEPROM;
+
+#endif // HOST_EEPROM_H
@@ -0,0 +1,7 @@
+#ifndef HOST_GXEPD2_3C_H
+#define HOST_GXEPD2_3C_H
+
+// 主机测试用：三色屏未使用，只提供与 GxEPD2 相同的头文件
+#include <GxEPD2_BW.h>
+
+#endif // HOST_GXEPD2_3C_H
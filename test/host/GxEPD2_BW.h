@@ -0,0 +1,172 @@
+#ifndef HOST_GXEPD2_BW_H
+#define HOST_GXEPD2_BW_H
+
+// 主机测试用的 GxEPD2 替身：GDEY029T94 控制器的两块显存（0x24 当前帧、0x26 上一帧）和屏幕上
+// 实际显示的画面用 hostPanel 中的缓冲模拟，写入和刷新按 GxEPD2 的语义在缓冲之间复制，
+// 并统计全刷、局部刷新、初始化和休眠次数。只支持一块屏幕
+#include <Adafruit_GFX.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+// 原生方向 128x296，每行 16 字节，1 = 白色
+#define HOST_PANEL_WIDTH 128
+#define HOST_PANEL_HEIGHT 296
+#define HOST_PANEL_BYTES (HOST_PANEL_WIDTH / 8 * HOST_PANEL_HEIGHT)
+
+struct HostPanel {
+  uint8_t current[HOST_PANEL_BYTES];   // 0x24：下一次刷新显示的内容
+  uint8_t previous[HOST_PANEL_BYTES];  // 0x26：局部刷新比较用的上一帧
+  uint8_t screen[HOST_PANEL_BYTES];    // 屏幕上实际显示的画面
+  int inits;
+  int initialInits;                    // init(initial = true) 的次数，会清空显存
+  int fullRefreshes;
+  int partialRefreshes;
+  int hibernates;
+  int16_t partialX, partialY, partialW, partialH;  // 最近一次局部刷新的窗口（原生坐标，x 已按 8 像素对齐）
+
+  // 模拟上电：显存和屏幕内容未知（此处为全白），计数清零
+  void reset() {
+    memset(this, 0, sizeof(*this));
+    memset(current, 0xFF, sizeof(current));
+    memset(previous, 0xFF, sizeof(previous));
+    memset(screen, 0xFF, sizeof(screen));
+  }
+};
+
+inline HostPanel hostPanel;
+
+class GxEPD2_290_GDEY029T94 {
+public:
+  static const uint16_t WIDTH = HOST_PANEL_WIDTH;
+  static const uint16_t HEIGHT = HOST_PANEL_HEIGHT;
+  static const bool hasColor = false;
+  static const bool hasPartialUpdate = true;
+  static const bool hasFastPartialUpdate = true;
+
+  GxEPD2_290_GDEY029T94(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {
+    (void)cs;
+    (void)dc;
+    (void)rst;
+    (void)busy;
+  }
+
+  void init(bool initial) {
+    hostPanel.inits++;
+    if (initial) {
+      hostPanel.initialInits++;
+      memset(hostPanel.current, 0xFF, HOST_PANEL_BYTES);
+      memset(hostPanel.previous, 0xFF, HOST_PANEL_BYTES);
+    }
+  }
+
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false) {
+    copyWindow(hostPanel.current, bitmap, x, y, w, h, invert, mirror_y, pgm);
+  }
+
+  void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false) {
+    copyWindow(hostPanel.previous, bitmap, x, y, w, h, invert, mirror_y, pgm);
+    copyWindow(hostPanel.current, bitmap, x, y, w, h, invert, mirror_y, pgm);
+  }
+
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false) {
+    copyWindow(hostPanel.previous, bitmap, x, y, w, h, invert, mirror_y, pgm);
+    copyWindow(hostPanel.current, bitmap, x, y, w, h, invert, mirror_y, pgm);
+  }
+
+  // 全刷（partial_update_mode = true 时按整屏局部刷新处理）
+  void refresh(bool partial_update_mode = false) {
+    if (partial_update_mode) {
+      refresh(0, 0, WIDTH, HEIGHT);
+      return;
+    }
+    hostPanel.fullRefreshes++;
+    memcpy(hostPanel.screen, hostPanel.current, HOST_PANEL_BYTES);
+  }
+
+  // 局部刷新：与 GxEPD2 相同，窗口先裁剪到屏幕，x 方向扩展到 8 像素对齐
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x1 = max((int16_t)0, x);
+    int16_t y1 = max((int16_t)0, y);
+    int16_t x2 = min((int16_t)WIDTH, (int16_t)(x + w));
+    int16_t y2 = min((int16_t)HEIGHT, (int16_t)(y + h));
+    if (x1 >= x2 || y1 >= y2) {
+      return;
+    }
+    int16_t firstByte = x1 / 8;
+    int16_t lastByte = (x2 + 7) / 8;
+
+    hostPanel.partialRefreshes++;
+    hostPanel.partialX = firstByte * 8;
+    hostPanel.partialY = y1;
+    hostPanel.partialW = (lastByte - firstByte) * 8;
+    hostPanel.partialH = y2 - y1;
+    for (int16_t row = y1; row < y2; row++) {
+      size_t offset = row * (WIDTH / 8) + firstByte;
+      memcpy(hostPanel.screen + offset, hostPanel.current + offset, lastByte - firstByte);
+    }
+  }
+
+  void hibernate() {
+    hostPanel.hibernates++;
+  }
+
+  void powerOff() {
+  }
+
+private:
+  // 写入显存窗口：x、w 为 8 的倍数，位图每行 w / 8 字节
+  static void copyWindow(uint8_t* ram, const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm) {
+    (void)pgm;
+    int16_t rowBytes = w / 8;
+    for (int16_t row = 0; row < h; row++) {
+      int16_t targetRow = y + row;
+      if (targetRow < 0 || targetRow >= HEIGHT) {
+        continue;
+      }
+      const uint8_t* src = bitmap + (mirror_y ? h - 1 - row : row) * rowBytes;
+      for (int16_t i = 0; i < rowBytes; i++) {
+        int16_t targetByte = x / 8 + i;
+        if (targetByte < 0 || targetByte >= WIDTH / 8) {
+          continue;
+        }
+        ram[targetRow * (WIDTH / 8) + targetByte] = invert ? ~src[i] : src[i];
+      }
+    }
+  }
+};
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+  GxEPD2_Type epd2;
+
+  GxEPD2_BW(GxEPD2_Type epd2_instance)
+    : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT),
+      epd2(epd2_instance) {
+  }
+
+  // 分页缓冲不模拟，直接绘制到 GxEPD2_BW 的内容不会到达显存
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    (void)x;
+    (void)y;
+    (void)color;
+  }
+
+  void init(uint32_t serial_diag_bitrate = 0, bool initial = true, uint16_t reset_duration = 10, bool pulldown_rst_mode = false) {
+    (void)serial_diag_bitrate;
+    (void)reset_duration;
+    (void)pulldown_rst_mode;
+    epd2.init(initial);
+  }
+
+  void hibernate() {
+    epd2.hibernate();
+  }
+
+  void powerOff() {
+    epd2.powerOff();
+  }
+};
+
+#endif // HOST_GXEPD2_BW_H
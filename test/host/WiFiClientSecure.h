@@ -0,0 +1,7 @@
+#ifndef HOST_WIFICLIENTSECURE_H
+#define HOST_WIFICLIENTSECURE_H
+
+// 主机测试用：网络不模拟，只为包含该头文件的库头文件提供同名文件
+#include <Arduino.h>
+
+#endif // HOST_WIFICLIENTSECURE_H
@@ -0,0 +1,23 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+// 主机测试用：没有 I2C 设备，所有事务都失败（endTransmission 返回 2，地址无应答）
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  void begin(int sda, int scl) { (void)sda; (void)scl; }
+  void begin() {}
+  void setClock(uint32_t frequency) { (void)frequency; }
+  void beginTransmission(uint8_t address) { (void)address; }
+  uint8_t endTransmission(bool sendStop = true) { (void)sendStop; return 2; }
+  size_t write(uint8_t data) { (void)data; return 0; }
+  size_t write(const uint8_t* data, size_t length) { (void)data; (void)length; return 0; }
+  uint8_t requestFrom(uint8_t address, uint8_t length, bool sendStop = true) { (void)address; (void)length; (void)sendStop; return 0; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+inline TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,26 @@
+#ifndef HOST_COREDECLS_H
+#define HOST_COREDECLS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 与 ESP8266 核心的 crc32 相同：多项式 0x04C11DB7，高位在前，无最终异或
+inline uint32_t crc32(const void* data, size_t length, uint32_t crc = 0xffffffff) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  while (length--) {
+    uint8_t c = *bytes++;
+    for (uint32_t i = 0x80; i > 0; i >>= 1) {
+      bool bit = crc & 0x80000000;
+      if (c & i) {
+        bit = !bit;
+      }
+      crc <<= 1;
+      if (bit) {
+        crc ^= 0x04c11db7;
+      }
+    }
+  }
+  return crc;
+}
+
+#endif // HOST_COREDECLS_H
@@ -0,0 +1,223 @@
+// CommandLine 状态机的主机单元测试：pio test -e native -f test_command_line
+// 按不同大小的分块输入字节流，模拟串口每次可读字节数不同的情况（逐字输入或一次粘贴整行）
+#include <unity.h>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+// native 环境不编译 lib/ 下的库（其余部分依赖 Arduino），直接编译被测源文件
+#include "../../lib/SerialConfigManager/CommandLine.cpp"
+
+// 统计 operator new 的调用次数，检查解析过程不分配内存
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+  allocationCount++;
+  void* p = malloc(size ? size : 1);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  free(p);
+}
+
+// 收到的完整行（固定缓冲区，收集过程不分配内存）
+#define MAX_LINES 16
+
+struct Lines {
+  char text[MAX_LINES][SERIAL_COMMAND_LINE_SIZE];
+  bool overflow[MAX_LINES];
+  int count;
+};
+
+// 按 chunkSize 分块输入，与 SerialConfigManager::processInput() 每次读取所有可用字节相同
+static void feedStream(CommandLine& commandLine, const char* data, size_t length, size_t chunkSize, Lines& lines) {
+  lines.count = 0;
+  for (size_t offset = 0; offset < length; offset += chunkSize) {
+    size_t end = offset + chunkSize < length ? offset + chunkSize : length;
+    for (size_t i = offset; i < end; i++) {
+      if (commandLine.feed(data[i]) && lines.count < MAX_LINES) {
+        strcpy(lines.text[lines.count], commandLine.line());
+        lines.overflow[lines.count] = commandLine.overflowed();
+        lines.count++;
+      }
+    }
+  }
+}
+
+static void assertLinesForAllChunkSizes(const char* data, size_t length, const char* const* expected, int expectedCount) {
+  for (size_t chunkSize = 1; chunkSize <= length; chunkSize++) {
+    CommandLine commandLine;
+    Lines lines;
+    feedStream(commandLine, data, length, chunkSize, lines);
+    TEST_ASSERT_EQUAL_INT(expectedCount, lines.count);
+    for (int i = 0; i < expectedCount; i++) {
+      TEST_ASSERT_EQUAL_STRING(expected[i], lines.text[i]);
+      TEST_ASSERT_FALSE(lines.overflow[i]);
+    }
+  }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_line_endings_split_across_feeds(void) {
+  // CRLF 只结束一行，CR 与 LF 落在不同分块时也一样；连续的 LF 产生空行
+  static const char data[] = "show\rhelp\nset ssid Home\r\n\r\nreset\n\n";
+  static const char* const expected[] = {"show", "help", "set ssid Home", "", "reset", ""};
+  assertLinesForAllChunkSizes(data, sizeof(data) - 1, expected, 6);
+}
+
+void test_lone_cr_then_text(void) {
+  // CR 之后不是 LF 时正常开始下一行
+  static const char data[] = "a\rb\rc\r";
+  static const char* const expected[] = {"a", "b", "c"};
+  assertLinesForAllChunkSizes(data, sizeof(data) - 1, expected, 3);
+}
+
+void test_backspace_and_delete(void) {
+  // BS 和 DEL 都删除上一个字符，空行上的退格不产生影响
+  static const char data[] = "\b\x7Fshoz\bw\nhelpx\x7F\nab\b\b\bc\n";
+  static const char* const expected[] = {"show", "help", "c"};
+  assertLinesForAllChunkSizes(data, sizeof(data) - 1, expected, 3);
+}
+
+void test_control_characters_ignored(void) {
+  static const char data[] = "sh\x01o\x1Bw\n";
+  static const char* const expected[] = {"show"};
+  assertLinesForAllChunkSizes(data, sizeof(data) - 1, expected, 1);
+}
+
+void test_longest_line_fits(void) {
+  char data[SERIAL_COMMAND_LINE_SIZE + 1];
+  memset(data, 'x', SERIAL_COMMAND_LINE_SIZE - 1);
+  data[SERIAL_COMMAND_LINE_SIZE - 1] = '\n';
+
+  CommandLine commandLine;
+  Lines lines;
+  feedStream(commandLine, data, SERIAL_COMMAND_LINE_SIZE, 7, lines);
+  TEST_ASSERT_EQUAL_INT(1, lines.count);
+  TEST_ASSERT_FALSE(lines.overflow[0]);
+  TEST_ASSERT_EQUAL_size_t(SERIAL_COMMAND_LINE_SIZE - 1, strlen(lines.text[0]));
+}
+
+void test_overflow_then_recovery(void) {
+  // 超长的行整行丢弃（溢出后的退格不能让它变回有效），下一行正常解析
+  char data[SERIAL_COMMAND_LINE_SIZE + 32];
+  size_t length = 0;
+  memset(data, 'x', SERIAL_COMMAND_LINE_SIZE);
+  length += SERIAL_COMMAND_LINE_SIZE;
+  data[length++] = '\b';
+  data[length++] = '\b';
+  data[length++] = '\r';
+  data[length++] = '\n';
+  memcpy(data + length, "show\n", 5);
+  length += 5;
+
+  for (size_t chunkSize = 1; chunkSize <= length; chunkSize++) {
+    CommandLine commandLine;
+    Lines lines;
+    feedStream(commandLine, data, length, chunkSize, lines);
+    TEST_ASSERT_EQUAL_INT(2, lines.count);
+    TEST_ASSERT_TRUE(lines.overflow[0]);
+    TEST_ASSERT_FALSE(lines.overflow[1]);
+    TEST_ASSERT_EQUAL_STRING("show", lines.text[1]);
+  }
+}
+
+void test_tokens_split_in_place(void) {
+  CommandLine commandLine;
+  const char* data = "  set   ssid   My Home Net  \n";
+  bool complete = false;
+  for (const char* p = data; *p != '\0'; p++) {
+    complete = commandLine.feed(*p);
+  }
+  TEST_ASSERT_TRUE(complete);
+
+  // 首尾空白已去除，中间的空白保留
+  char* line = commandLine.line();
+  TEST_ASSERT_EQUAL_STRING("set   ssid   My Home Net", line);
+
+  char* cursor = line;
+  char* command = CommandLine::nextToken(cursor);
+  char* key = CommandLine::nextToken(cursor);
+  char* value = CommandLine::rest(cursor);
+  TEST_ASSERT_EQUAL_STRING("set", command);
+  TEST_ASSERT_EQUAL_STRING("ssid", key);
+  TEST_ASSERT_EQUAL_STRING("My Home Net", value);
+
+  // 切分结果都指向行缓冲区内部，没有拷贝
+  TEST_ASSERT_TRUE(command == line);
+  TEST_ASSERT_TRUE(key > command && key < line + SERIAL_COMMAND_LINE_SIZE);
+  TEST_ASSERT_TRUE(value > key && value < line + SERIAL_COMMAND_LINE_SIZE);
+
+  // 没有更多内容时返回空字符串
+  TEST_ASSERT_EQUAL_STRING("", CommandLine::nextToken(cursor));
+  TEST_ASSERT_EQUAL_STRING("", CommandLine::rest(cursor));
+}
+
+void test_tokens_without_arguments(void) {
+  char buffer[] = "help";
+  char* cursor = buffer;
+  TEST_ASSERT_EQUAL_STRING("help", CommandLine::nextToken(cursor));
+  TEST_ASSERT_EQUAL_STRING("", CommandLine::rest(cursor));
+
+  char spaces[] = "   ";
+  cursor = spaces;
+  TEST_ASSERT_EQUAL_STRING("", CommandLine::nextToken(cursor));
+}
+
+void test_parsing_does_not_allocate(void) {
+  static const char data[] = "show\r\nset apikey 0123456789abcdef\nhe\bxlp\r\n\x7F\nreset\r";
+  CommandLine* commandLine = new CommandLine();
+  Lines lines;
+
+  size_t before = allocationCount;
+  for (size_t chunkSize = 1; chunkSize < sizeof(data); chunkSize++) {
+    feedStream(*commandLine, data, sizeof(data) - 1, chunkSize, lines);
+    for (int i = 0; i < lines.count; i++) {
+      char* cursor = lines.text[i];
+      CommandLine::nextToken(cursor);
+      CommandLine::rest(cursor);
+    }
+  }
+  TEST_ASSERT_EQUAL_size_t(before, allocationCount);
+
+  delete commandLine;
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_line_endings_split_across_feeds);
+  RUN_TEST(test_lone_cr_then_text);
+  RUN_TEST(test_backspace_and_delete);
+  RUN_TEST(test_control_characters_ignored);
+  RUN_TEST(test_longest_line_fits);
+  RUN_TEST(test_overflow_then_recovery);
+  RUN_TEST(test_tokens_split_in_place);
+  RUN_TEST(test_tokens_without_arguments);
+  RUN_TEST(test_parsing_does_not_allocate);
+  return UNITY_END();
+}
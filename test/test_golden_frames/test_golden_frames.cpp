@@ -0,0 +1,159 @@
+// 渲染帧基准的主机测试：pio test -e native -f test_golden_frames
+// 在主机上渲染 FrameCapture 的测试矩阵，检查每帧输出完整，以及帧缓冲快速路径与 GFX 逐像素路径结果一致。
+// 设置环境变量 GOLDEN_FRAMES_LOG 时把与串口 frames 命令相同格式的输出写入该文件，
+// 由 scripts/golden_frames.py --native 与 test/golden 中的基准图像比较。
+// 与 test_render 相同，需要 host_fonts.py 提供 FreeMonoBold9pt7b，找不到时标记为 IGNORE
+#include <unity.h>
+
+#if __has_include(<Fonts/FreeMonoBold9pt7b.h>)
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// native 环境不编译 lib/ 下的库，直接编译渲染路径上的源文件；Arduino 相关头文件由 test/host 中的替身提供
+#include "../../lib/FrameCapture/FrameCapture.cpp"
+#include "../../lib/GDEY029T94/GDEY029T94.cpp"
+#include "../../lib/GDEY029T94/EPaperCanvas.cpp"
+#include "../../lib/GDEY029T94/RefreshScheduler.cpp"
+#include "../../lib/WeatherManager/WeatherFormat.cpp"
+#include "../../lib/WeatherManager/WeatherText.cpp"
+#include "../../lib/TimeManager/TimeFormat.cpp"
+#include "../../lib/TimeManager/Calendar.cpp"
+#include "../../lib/Fonts/subset/DSEG7Modern_Bold28pt7b.h"
+#include "../../lib/Fonts/subset/DSEG7Modern_Bold42pt7b.h"
+#include "../../lib/Fonts/subset/Weather_Symbols_Regular9pt7b.h"
+
+// 帧导出的行数和每行十六进制字符数（逻辑方向 296x128）
+#define FRAME_ROWS LAYOUT_SCREEN_HEIGHT
+#define FRAME_HEX_CHARS ((LAYOUT_SCREEN_WIDTH + 7) / 8 * 2)
+
+// 把输出写入文件，file 为空时只统计
+class FilePrint : public Print {
+public:
+  explicit FilePrint(FILE* file) : _file(file) {}
+  size_t write(uint8_t c) override {
+    return _file != nullptr ? fwrite(&c, 1, 1, _file) : 1;
+  }
+
+private:
+  FILE* _file;
+};
+
+// 按行检查帧导出格式：每帧 FRAME、P4 头、FRAME_ROWS 行固定长度的十六进制串、END
+class FrameCheckPrint : public Print {
+public:
+  int frames = 0;
+  int badFrames = 0;
+
+  size_t write(uint8_t c) override {
+    if (c == '\r') {
+      return 1;
+    }
+    if (c != '\n') {
+      _line += (char)c;
+      return 1;
+    }
+    if (_line.startsWith("FRAME ")) {
+      _rows = -1;
+    } else if (_line.startsWith("P4 ")) {
+      _rows = 0;
+    } else if (_line == "END") {
+      frames++;
+      badFrames += _rows != FRAME_ROWS;
+    } else if (_rows >= 0 && (int)_line.length() == FRAME_HEX_CHARS) {
+      _rows++;
+    }
+    _line = "";
+    return 1;
+  }
+
+private:
+  String _line;
+  int _rows = -1;
+};
+
+// 与 src/main.cpp 和 config.h.example 相同的显示设置（低电量布局阈值 10%），基准图像与设备输出一致
+static void setUpDisplay(GDEY029T94& epd) {
+  epd.begin();
+  epd.setRotation(1);
+  epd.setTimeFont(&DSEG7Modern_Bold28pt7b);
+  epd.setWeatherSymbolFont(&Weather_Symbols_Regular9pt7b);
+  epd.setLargeTimeFont(&DSEG7Modern_Bold42pt7b);
+  epd.setLayout(LAYOUT_STANDARD);
+  epd.setLowBatteryLayout(10);
+}
+
+void setUp(void) {
+  ESP.clearRtcMemory();
+  hostPanel.reset();
+}
+
+void tearDown(void) {
+}
+
+void test_capture_matrix(void) {
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  FrameCapture capture(&epd);
+
+  FrameCheckPrint check;
+  TEST_ASSERT_EQUAL_INT(FrameCapture::getCaseCount(), capture.captureMatrix(check));
+  TEST_ASSERT_EQUAL_INT(FrameCapture::getCaseCount(), check.frames);
+  TEST_ASSERT_EQUAL_INT(0, check.badFrames);
+
+  // 只渲染到帧缓冲，不唤醒屏幕
+  TEST_ASSERT_EQUAL_INT(0, hostPanel.inits);
+}
+
+void test_fast_path_matches_gfx(void) {
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  FrameCapture capture(&epd);
+
+  FilePrint out(nullptr);
+  TEST_ASSERT_TRUE(capture.benchmark(out, 1));
+}
+
+void test_write_golden_log(void) {
+  const char* path = getenv("GOLDEN_FRAMES_LOG");
+  if (path == nullptr || path[0] == '\0') {
+    TEST_IGNORE_MESSAGE("GOLDEN_FRAMES_LOG not set: run scripts/golden_frames.py --native");
+  }
+
+  FILE* file = fopen(path, "w");
+  TEST_ASSERT_NOT_NULL_MESSAGE(file, path);
+
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  FrameCapture capture(&epd);
+  FilePrint out(file);
+  int captured = capture.captureMatrix(out);
+  fclose(file);
+  TEST_ASSERT_EQUAL_INT(FrameCapture::getCaseCount(), captured);
+}
+
+#else
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_golden_frames_require_small_font(void) {
+  TEST_IGNORE_MESSAGE("Fonts/FreeMonoBold9pt7b.h not found: run pio run -e nodemcu once to install Adafruit GFX Library");
+}
+
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if __has_include(<Fonts/FreeMonoBold9pt7b.h>)
+  RUN_TEST(test_capture_matrix);
+  RUN_TEST(test_fast_path_matches_gfx);
+  RUN_TEST(test_write_golden_log);
+#else
+  RUN_TEST(test_golden_frames_require_small_font);
+#endif
+  return UNITY_END();
+}
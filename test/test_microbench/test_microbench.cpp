@@ -0,0 +1,205 @@
+// 热点纯函数的主机测试和微基准：pio test -e native -f test_microbench -v
+// 先检查结果正确，再对每个函数预热、多轮计时，以 JSON 输出每次调用耗时的中位数、p95、最小值和最大值，
+// 格式与设备上的 bench 命令相同（suite 为 native），由 scripts/microbench.py --native 保存并比较
+#include <unity.h>
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// native 环境不编译 lib/ 下的库（其余部分依赖 Arduino），直接编译被测源文件
+#include "../../lib/SHT40/SHT40Crc.cpp"
+#include "../../lib/ConfigManager/ConfigChecksum.h"
+#include "../../lib/TimeManager/Calendar.cpp"
+#include "../../lib/WeatherManager/WeatherText.cpp"
+
+// 与设备上的 MicroBench 相同：预热轮数和计时轮数
+#define BENCH_WARMUP_REPETITIONS 3
+#define BENCH_REPETITIONS 21
+
+// ESP8266 上 sizeof(ConfigData) 为 220 字节
+#define CONFIG_DATA_SIZE 220
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_sht40_crc8(void) {
+  // 数据手册中的示例：0xBEEF 的校验值为 0x92
+  static const uint8_t frame[6] = {0xBE, 0xEF, 0x92, 0x66, 0x66, 0x93};
+  TEST_ASSERT_EQUAL_HEX8(0x92, SHT40Crc::compute(&frame[0], 2));
+  TEST_ASSERT_EQUAL_HEX8(0x93, SHT40Crc::compute(&frame[3], 2));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, SHT40Crc::compute(frame, 0));
+
+  // 校验值附在数据后面时整体 CRC 为 0
+  TEST_ASSERT_EQUAL_HEX8(0x00, SHT40Crc::compute(&frame[0], 3));
+}
+
+void test_config_checksum(void) {
+  uint8_t data[CONFIG_DATA_SIZE];
+  memset(data, 0, sizeof(data));
+  TEST_ASSERT_EQUAL_HEX8(0x00, ConfigChecksum::compute(data, sizeof(data)));
+
+  data[0] = 0x5A;
+  data[CONFIG_DATA_SIZE - 1] = 0x0F;
+  TEST_ASSERT_EQUAL_HEX8(0x55, ConfigChecksum::compute(data, sizeof(data)));
+
+  // 相同的两个字节相互抵消
+  data[100] = 0x33;
+  data[101] = 0x33;
+  TEST_ASSERT_EQUAL_HEX8(0x55, ConfigChecksum::compute(data, sizeof(data)));
+}
+
+void test_day_of_week_known_dates(void) {
+  TEST_ASSERT_EQUAL_STRING("Saturday", Calendar::dayOfWeekName(2000, 1, 1));
+  TEST_ASSERT_EQUAL_STRING("Wednesday", Calendar::dayOfWeekName(2000, 3, 1));
+  TEST_ASSERT_EQUAL_STRING("Thursday", Calendar::dayOfWeekName(2024, 2, 29));
+  TEST_ASSERT_EQUAL_STRING("Sunday", Calendar::dayOfWeekName(2025, 6, 15));
+  TEST_ASSERT_EQUAL_STRING("Thursday", Calendar::dayOfWeekName(2099, 12, 31));
+}
+
+void test_day_of_week_all_days(void) {
+  // 从 2000-01-01（周六）起逐日推算，覆盖 RTC 两位数年份的全部范围
+  static const char* const DAYS[] = {"Saturday", "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+  static const int DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  int index = 0;
+  for (int year = 2000; year <= 2099; year++) {
+    for (int month = 1; month <= 12; month++) {
+      int days = DAYS_IN_MONTH[month - 1] + (month == 2 && year % 4 == 0 ? 1 : 0);
+      for (int day = 1; day <= days; day++) {
+        TEST_ASSERT_EQUAL_STRING(DAYS[index], Calendar::dayOfWeekName(year, month, day));
+        index = (index + 1) % 7;
+      }
+    }
+  }
+}
+
+void test_weather_symbols(void) {
+  struct SymbolCase {
+    const char* weather;
+    char symbol;
+  };
+  static const SymbolCase CASES[] = {
+    {"晴", 'n'}, {"少云", 'p'}, {"晴间多云", 'n'}, {"多云", 'o'}, {"阴", 'c'},
+    {"雷阵雨", 'k'}, {"强雷阵雨", 'k'}, {"小雨", 'm'}, {"冻雨", 'm'}, {"雨夹雪", 'd'},
+    {"大雪", 'd'}, {"雷", 'a'}, {"雾", 'l'}, {"浓雾", 'l'}, {"有风", 'f'},
+    {"冷", 'e'}, {"热", 'h'}, {"霾", 'n'}, {"未知", 'n'}, {"", 'n'},
+  };
+  for (size_t i = 0; i < sizeof(CASES) / sizeof(CASES[0]); i++) {
+    TEST_ASSERT_EQUAL_INT_MESSAGE(CASES[i].symbol, WeatherText::toSymbol(CASES[i].weather), CASES[i].weather);
+  }
+}
+
+void test_wind_directions(void) {
+  TEST_ASSERT_EQUAL_STRING("East", WeatherText::windDirectionToEnglish("东"));
+  TEST_ASSERT_EQUAL_STRING("North", WeatherText::windDirectionToEnglish("北"));
+  TEST_ASSERT_EQUAL_STRING("Northwest", WeatherText::windDirectionToEnglish("西北"));
+  TEST_ASSERT_EQUAL_STRING("Southwest", WeatherText::windDirectionToEnglish("西南"));
+
+  // 无法识别时由 WeatherManager 返回原始值
+  TEST_ASSERT_NULL(WeatherText::windDirectionToEnglish("东北风"));
+  TEST_ASSERT_NULL(WeatherText::windDirectionToEnglish("无风向"));
+  TEST_ASSERT_NULL(WeatherText::windDirectionToEnglish(""));
+}
+
+// 基准输入，计时前准备好；每次调用的结果累加到 volatile 变量，避免被编译器优化掉
+static const char* const BENCH_WEATHER_NAMES[] = {"晴", "多云", "中雨", "雷阵雨", "霾", "未知"};
+static const char* const BENCH_WIND_DIRECTIONS[] = {"西北", "东", "东北风"};
+static uint8_t configData[CONFIG_DATA_SIZE];
+static uint8_t sensorFrame[6] = {0xBE, 0xEF, 0x92, 0x66, 0x66, 0x93};
+static uint32_t benchCounter = 0;
+static volatile uint32_t benchSink = 0;
+
+static void benchWeatherSymbol() {
+  benchSink += WeatherText::toSymbol(BENCH_WEATHER_NAMES[benchCounter++ % 6]);
+}
+
+static void benchWindDirection() {
+  const char* english = WeatherText::windDirectionToEnglish(BENCH_WIND_DIRECTIONS[benchCounter++ % 3]);
+  benchSink += english != nullptr ? english[0] : 0;
+}
+
+static void benchConfigChecksum() {
+  configData[0] = (uint8_t)benchCounter++;
+  benchSink += ConfigChecksum::compute(configData, sizeof(configData));
+}
+
+static void benchDayOfWeek() {
+  benchSink += Calendar::dayOfWeekName(2000 + benchCounter++ % 100, 6, 15)[0];
+}
+
+static void benchSht40Crc8() {
+  sensorFrame[1] = (uint8_t)benchCounter++;
+  benchSink += SHT40Crc::compute(&sensorFrame[0], 2) + SHT40Crc::compute(&sensorFrame[3], 2);
+}
+
+// 用例名称与设备上被包装的函数对应，每轮连续调用 iterations 次
+struct BenchCase {
+  const char* name;
+  uint32_t iterations;
+  void (*function)();
+};
+
+static const BenchCase BENCH_CASES[] = {
+  {"weather.mapWeatherToSymbol",     20000, benchWeatherSymbol},
+  {"weather.translateWindDirection", 20000, benchWindDirection},
+  {"config.calculateChecksum",       20000, benchConfigChecksum},
+  {"time.getDayOfWeek",              20000, benchDayOfWeek},
+  {"sht40.crc8",                     20000, benchSht40Crc8},
+};
+
+#define BENCH_CASE_COUNT (sizeof(BENCH_CASES) / sizeof(BENCH_CASES[0]))
+
+void test_microbench_report(void) {
+  for (size_t i = 0; i < sizeof(configData); i++) {
+    configData[i] = (uint8_t)(i * 31 + 7);
+  }
+
+  printf("BENCH BEGIN\n");
+  printf("{\"suite\":\"native\",\"compiler\":\"%s\",\"warmup\":%d,\"repetitions\":%d,\"results\":[\n",
+         __VERSION__, BENCH_WARMUP_REPETITIONS, BENCH_REPETITIONS);
+
+  for (size_t i = 0; i < BENCH_CASE_COUNT; i++) {
+    const BenchCase& bench = BENCH_CASES[i];
+    double samples[BENCH_REPETITIONS];
+    for (int rep = 0; rep < BENCH_WARMUP_REPETITIONS + BENCH_REPETITIONS; rep++) {
+      auto start = std::chrono::steady_clock::now();
+      for (uint32_t n = 0; n < bench.iterations; n++) {
+        bench.function();
+      }
+      std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+      if (rep >= BENCH_WARMUP_REPETITIONS) {
+        samples[rep - BENCH_WARMUP_REPETITIONS] = elapsed.count() / bench.iterations;
+      }
+    }
+
+    // 中位数和 p95（最近秩），与设备上的计算方法相同
+    std::sort(samples, samples + BENCH_REPETITIONS);
+    double median = samples[BENCH_REPETITIONS / 2];
+    double p95 = samples[(BENCH_REPETITIONS * 95 + 99) / 100 - 1];
+    TEST_ASSERT_TRUE(samples[0] > 0);
+
+    // 主机上单次调用只有几纳秒，保留一位小数
+    printf("%s{\"name\":\"%s\",\"iterations\":%u,\"median_ns\":%.1f,\"p95_ns\":%.1f,\"min_ns\":%.1f,\"max_ns\":%.1f}\n",
+           i > 0 ? "," : "", bench.name, (unsigned)bench.iterations, median, p95, samples[0], samples[BENCH_REPETITIONS - 1]);
+  }
+
+  printf("]}\n");
+  printf("BENCH END\n");
+  fflush(stdout);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_sht40_crc8);
+  RUN_TEST(test_config_checksum);
+  RUN_TEST(test_day_of_week_known_dates);
+  RUN_TEST(test_day_of_week_all_days);
+  RUN_TEST(test_weather_symbols);
+  RUN_TEST(test_wind_directions);
+  RUN_TEST(test_microbench_report);
+  return UNITY_END();
+}
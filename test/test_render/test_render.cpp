@@ -0,0 +1,235 @@
+// 时间界面渲染和刷新的主机测试：pio test -e native -f test_render
+// 在主机上运行完整的 showTimeDisplay()：EPaperCanvas 绘制帧缓冲，RefreshScheduler 选择刷新方式，
+// GxEPD2 替身（test/host/GxEPD2_BW.h）把写入的显存按全刷或局部刷新窗口复制到模拟的屏幕。
+// 检查每次刷新后屏幕与帧缓冲一致（局部刷新窗口覆盖了所有变化的像素）、画面不变时不唤醒屏幕，
+// 以及刷新状态经 RTC 内存跨深度睡眠保留。
+// 小字体 FreeMonoBold9pt7b 来自 Adafruit GFX Library，由 scripts/host_fonts.py 从 nodemcu 环境的
+// libdeps 复制到构建目录；找不到时（未执行过 pio run -e nodemcu）测试标记为 IGNORE
+#include <unity.h>
+
+#if __has_include(<Fonts/FreeMonoBold9pt7b.h>)
+
+// native 环境不编译 lib/ 下的库，直接编译渲染路径上的源文件；Arduino 相关头文件由 test/host 中的替身提供
+#include "../../lib/GDEY029T94/GDEY029T94.cpp"
+#include "../../lib/GDEY029T94/EPaperCanvas.cpp"
+#include "../../lib/GDEY029T94/RefreshScheduler.cpp"
+#include "../../lib/WeatherManager/WeatherFormat.cpp"
+#include "../../lib/WeatherManager/WeatherText.cpp"
+#include "../../lib/TimeManager/TimeFormat.cpp"
+#include "../../lib/TimeManager/Calendar.cpp"
+#include "../../lib/Fonts/subset/DSEG7Modern_Bold28pt7b.h"
+#include "../../lib/Fonts/subset/DSEG7Modern_Bold42pt7b.h"
+#include "../../lib/Fonts/subset/Weather_Symbols_Regular9pt7b.h"
+
+// 与 src/main.cpp 相同的显示设置（引脚在替身中不使用）
+static void setUpDisplay(GDEY029T94& epd) {
+  epd.begin();
+  epd.setRotation(1);
+  epd.setTimeFont(&DSEG7Modern_Bold28pt7b);
+  epd.setWeatherSymbolFont(&Weather_Symbols_Regular9pt7b);
+  epd.setLargeTimeFont(&DSEG7Modern_Bold42pt7b);
+  epd.setLayout(LAYOUT_STANDARD);
+}
+
+static WeatherInfo sampleWeather() {
+  WeatherInfo weather;
+  weather.Temperature = 26.0f;
+  weather.Humidity = 45;
+  weather.Symbol = 'n';
+  weather.WindDirection = "东北";
+  weather.WindSpeed = "≤3";
+  weather.Weather = "晴";
+  return weather;
+}
+
+// 平缓上升的24小时温度曲线
+static ClimateSeries sampleSeries() {
+  ClimateSeries series;
+  series.columns = SPARKLINE_WIDTH;
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) {
+    series.minValue[i] = 2000 + i * 10;
+    series.maxValue[i] = 2020 + i * 10;
+  }
+  return series;
+}
+
+// 屏幕上逻辑坐标 (x, y) 处是否为黑色（旋转 1：逻辑 (x, y) 对应原生 (WIDTH - 1 - y, x)）
+static bool screenBlack(int x, int y) {
+  int nativeX = HOST_PANEL_WIDTH - 1 - y;
+  int nativeY = x;
+  return !(hostPanel.screen[nativeY * (HOST_PANEL_WIDTH / 8) + nativeX / 8] & (0x80 >> (nativeX & 7)));
+}
+
+static int countBlack(const LayoutRect& rect) {
+  int count = 0;
+  for (int y = rect.y; y < rect.bottom(); y++) {
+    for (int x = rect.x; x < rect.right(); x++) {
+      count += screenBlack(x, y);
+    }
+  }
+  return count;
+}
+
+// 屏幕显示的画面与帧缓冲一致
+static void assertScreenMatchesFrame(GDEY029T94& epd) {
+  TEST_ASSERT_EQUAL_HEX32(epd.getFrameChecksum(), crc32(hostPanel.screen, HOST_PANEL_BYTES));
+}
+
+void setUp(void) {
+  // 冷启动：RTC 内存无效，屏幕内容未知
+  ESP.clearRtcMemory();
+  hostPanel.reset();
+}
+
+void tearDown(void) {
+}
+
+void test_cold_start_full_refresh(void) {
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  WeatherInfo weather = sampleWeather();
+  ClimateSeries series = sampleSeries();
+
+  TEST_ASSERT_TRUE(epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 23.4f, 45.0f, 87.0f, &series));
+  TEST_ASSERT_EQUAL_INT(REFRESH_FULL, epd.getLastRefreshMode());
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.initialInits);
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.fullRefreshes);
+  TEST_ASSERT_EQUAL_INT(0, hostPanel.partialRefreshes);
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.hibernates);
+  assertScreenMatchesFrame(epd);
+
+  // 分隔线和各区域都画在屏幕上
+  const DisplayLayout& layout = DISPLAY_LAYOUTS[LAYOUT_STANDARD];
+  for (int x = LAYOUT_MARGIN; x <= LAYOUT_SCREEN_WIDTH - LAYOUT_MARGIN; x++) {
+    TEST_ASSERT_TRUE(screenBlack(x, layout.topLineY));
+    TEST_ASSERT_TRUE(screenBlack(x, layout.bottomLineY));
+  }
+  for (int y = layout.topLineY; y <= layout.bottomLineY; y++) {
+    TEST_ASSERT_TRUE(screenBlack(layout.dividerX, y));
+  }
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.weather.rect));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.symbol));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.time));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.date.rect));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.temperature.rect));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.humidity.rect));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.battery));
+  TEST_ASSERT_GREATER_THAN(0, countBlack(layout.sparkline));
+}
+
+void test_unchanged_input_skips_panel(void) {
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  WeatherInfo weather = sampleWeather();
+
+  TEST_ASSERT_TRUE(epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 23.4f, 45.0f, 87.0f));
+  uint8_t shown[HOST_PANEL_BYTES];
+  memcpy(shown, hostPanel.screen, sizeof(shown));
+
+  // 秒数不参与显示，输入相同时不绘制、不初始化控制器也不刷新
+  TEST_ASSERT_FALSE(epd.showTimeDisplay({25, 6, 15, 12, 34, 30}, weather, 23.4f, 45.0f, 87.0f));
+  TEST_ASSERT_EQUAL_INT(REFRESH_NONE, epd.getLastRefreshMode());
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.inits);
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.fullRefreshes);
+  TEST_ASSERT_EQUAL_INT(0, hostPanel.partialRefreshes);
+  TEST_ASSERT_EQUAL_MEMORY(shown, hostPanel.screen, HOST_PANEL_BYTES);
+}
+
+void test_minute_change_partial_refresh(void) {
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  WeatherInfo weather = sampleWeather();
+  ClimateSeries series = sampleSeries();
+
+  epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 23.4f, 45.0f, 87.0f, &series);
+  TEST_ASSERT_TRUE(epd.showTimeDisplay({25, 6, 15, 12, 35, 0}, weather, 23.4f, 45.0f, 87.0f, &series));
+  TEST_ASSERT_EQUAL_INT(REFRESH_PARTIAL, epd.getLastRefreshMode());
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.fullRefreshes);
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.partialRefreshes);
+
+  // 局部刷新窗口只覆盖时间区域（原生 y 为逻辑 x），且刷新后屏幕与帧缓冲完全一致
+  const LayoutRect& time = DISPLAY_LAYOUTS[LAYOUT_STANDARD].time;
+  TEST_ASSERT_TRUE(hostPanel.partialY >= time.x);
+  TEST_ASSERT_TRUE(hostPanel.partialY + hostPanel.partialH <= time.right());
+  TEST_ASSERT_TRUE(HOST_PANEL_WIDTH - hostPanel.partialX - hostPanel.partialW <= time.y);
+  assertScreenMatchesFrame(epd);
+}
+
+void test_climate_change_partial_refresh(void) {
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  WeatherInfo weather = sampleWeather();
+  ClimateSeries series = sampleSeries();
+
+  epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 23.4f, 45.0f, 87.0f, &series);
+  uint8_t before[HOST_PANEL_BYTES];
+  memcpy(before, hostPanel.screen, sizeof(before));
+
+  // 同一分钟内温湿度变化、趋势图消失
+  TEST_ASSERT_TRUE(epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 19.0f, 62.0f, 87.0f));
+  TEST_ASSERT_EQUAL_INT(REFRESH_PARTIAL, epd.getLastRefreshMode());
+  assertScreenMatchesFrame(epd);
+  TEST_ASSERT_EQUAL_INT(0, countBlack(DISPLAY_LAYOUTS[LAYOUT_STANDARD].sparkline));
+
+  // 变化只出现在温湿度栏（竖线右侧）
+  for (int y = 0; y < LAYOUT_SCREEN_HEIGHT; y++) {
+    for (int x = 0; x <= DISPLAY_LAYOUTS[LAYOUT_STANDARD].dividerX; x++) {
+      int nativeX = HOST_PANEL_WIDTH - 1 - y;
+      int index = x * (HOST_PANEL_WIDTH / 8) + nativeX / 8;
+      uint8_t mask = 0x80 >> (nativeX & 7);
+      TEST_ASSERT_EQUAL_UINT8(before[index] & mask, hostPanel.screen[index] & mask);
+    }
+  }
+}
+
+void test_state_survives_deep_sleep(void) {
+  WeatherInfo weather = sampleWeather();
+  {
+    GDEY029T94 epd(15, 4, 5, 16);
+    setUpDisplay(epd);
+    epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 23.4f, 45.0f, 87.0f);
+  }
+
+  // 深度睡眠后重新启动：RTC 内存和控制器显存保留，屏幕对象重新创建
+  GDEY029T94 epd(15, 4, 5, 16);
+  setUpDisplay(epd);
+  TEST_ASSERT_FALSE(epd.showTimeDisplay({25, 6, 15, 12, 34, 0}, weather, 23.4f, 45.0f, 87.0f));
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.inits);
+
+  TEST_ASSERT_EQUAL_INT(REFRESH_PARTIAL, epd.predictRefresh(12, 35));
+  TEST_ASSERT_TRUE(epd.showTimeDisplay({25, 6, 15, 12, 35, 0}, weather, 23.4f, 45.0f, 87.0f));
+  TEST_ASSERT_EQUAL_INT(REFRESH_PARTIAL, epd.getLastRefreshMode());
+
+  // 控制器以 initial = false 初始化，保留上一帧作为局部刷新的基础
+  TEST_ASSERT_EQUAL_INT(2, hostPanel.inits);
+  TEST_ASSERT_EQUAL_INT(1, hostPanel.initialInits);
+  assertScreenMatchesFrame(epd);
+}
+
+#else
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_render_requires_small_font(void) {
+  TEST_IGNORE_MESSAGE("Fonts/FreeMonoBold9pt7b.h not found: run pio run -e nodemcu once to install Adafruit GFX Library");
+}
+
+#endif
+
+int main() {
+  UNITY_BEGIN();
+#if __has_include(<Fonts/FreeMonoBold9pt7b.h>)
+  RUN_TEST(test_cold_start_full_refresh);
+  RUN_TEST(test_unchanged_input_skips_panel);
+  RUN_TEST(test_minute_change_partial_refresh);
+  RUN_TEST(test_climate_change_partial_refresh);
+  RUN_TEST(test_state_survives_deep_sleep);
+#else
+  RUN_TEST(test_render_requires_small_font);
+#endif
+  return UNITY_END();
+}
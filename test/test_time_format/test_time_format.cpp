@@ -0,0 +1,82 @@
+// 时间格式化和换算的主机单元测试：pio test -e native -f test_time_format
+// 检查屏幕上显示的日期、时间字符串，以及 ClimateHistory 和唤醒调度使用的秒数换算
+#include <unity.h>
+
+// TimeManager.h 依赖的 Arduino 头文件由 test/host 中的替身提供
+#include "../../lib/TimeManager/TimeFormat.cpp"
+#include "../../lib/TimeManager/Calendar.cpp"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_formatted_date(void) {
+  // DateTime.year 为两位数年份
+  TEST_ASSERT_EQUAL_STRING("2025/06/15 Sunday", TimeManager::getFormattedDate({25, 6, 15, 12, 34, 0}).c_str());
+  TEST_ASSERT_EQUAL_STRING("2000/01/01 Saturday", TimeManager::getFormattedDate({0, 1, 1, 0, 0, 0}).c_str());
+  TEST_ASSERT_EQUAL_STRING("2024/02/29 Thursday", TimeManager::getFormattedDate({24, 2, 29, 8, 0, 0}).c_str());
+  TEST_ASSERT_EQUAL_STRING("2026/12/31 Thursday", TimeManager::getFormattedDate({26, 12, 31, 23, 59, 59}).c_str());
+}
+
+void test_longest_date_fits_layout(void) {
+  // 星期名称最长的日期，DisplayLayout.h 按 11 + CALENDAR_DAY_NAME_MAX_LENGTH 个字符计算日期区域宽度
+  String date = TimeManager::getFormattedDate({25, 10, 15, 0, 0, 0});
+  TEST_ASSERT_EQUAL_STRING("2025/10/15 Wednesday", date.c_str());
+  TEST_ASSERT_EQUAL_UINT(11 + CALENDAR_DAY_NAME_MAX_LENGTH, date.length());
+}
+
+void test_formatted_time(void) {
+  TEST_ASSERT_EQUAL_STRING("00:05", TimeManager::getFormattedTime({25, 6, 15, 0, 5, 0}).c_str());
+  TEST_ASSERT_EQUAL_STRING("23:59", TimeManager::getFormattedTime({25, 6, 15, 23, 59, 59}).c_str());
+  TEST_ASSERT_EQUAL_STRING("Monday", TimeManager::getDayOfWeek(2025, 6, 16).c_str());
+}
+
+void test_epoch_seconds(void) {
+  TEST_ASSERT_EQUAL_UINT32(0, TimeManager::toEpochSeconds({0, 1, 1, 0, 0, 0}));
+  // 2000 年为闰年：1 月 31 天 + 2 月 29 天
+  TEST_ASSERT_EQUAL_UINT32(60UL * 86400, TimeManager::toEpochSeconds({0, 3, 1, 0, 0, 0}));
+  TEST_ASSERT_EQUAL_UINT32(366UL * 86400 + 3661, TimeManager::toEpochSeconds({1, 1, 1, 1, 1, 1}));
+  // 无效月份
+  TEST_ASSERT_EQUAL_UINT32(0, TimeManager::toEpochSeconds({25, 13, 1, 0, 0, 0}));
+}
+
+void test_epoch_round_trip(void) {
+  // 2000-2099 每天的正午换算后再换算回来应与原值相同，且相邻两天相差 86400 秒
+  static const int DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  uint32_t previous = 0;
+  bool first = true;
+  for (int year = 0; year < 100; year++) {
+    for (int month = 1; month <= 12; month++) {
+      int days = DAYS_IN_MONTH[month - 1] + ((month == 2 && year % 4 == 0) ? 1 : 0);
+      for (int day = 1; day <= days; day++) {
+        DateTime dt = {year, month, day, 12, 30, 15};
+        uint32_t seconds = TimeManager::toEpochSeconds(dt);
+        if (!first) {
+          TEST_ASSERT_EQUAL_UINT32(previous + 86400, seconds);
+        }
+        first = false;
+        previous = seconds;
+
+        DateTime back = TimeManager::fromEpochSeconds(seconds);
+        TEST_ASSERT_EQUAL_INT(year, back.year);
+        TEST_ASSERT_EQUAL_INT(month, back.month);
+        TEST_ASSERT_EQUAL_INT(day, back.day);
+        TEST_ASSERT_EQUAL_INT(12, back.hour);
+        TEST_ASSERT_EQUAL_INT(30, back.minute);
+        TEST_ASSERT_EQUAL_INT(15, back.second);
+      }
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_formatted_date);
+  RUN_TEST(test_longest_date_fits_layout);
+  RUN_TEST(test_formatted_time);
+  RUN_TEST(test_epoch_seconds);
+  RUN_TEST(test_epoch_round_trip);
+  return UNITY_END();
+}
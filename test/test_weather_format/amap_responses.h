@@ -0,0 +1,27 @@
+#ifndef AMAP_RESPONSES_H
+#define AMAP_RESPONSES_H
+
+// 高德天气 API（/v3/weather/weatherInfo，extensions=base）的响应样例，字段和取值形式
+// 按接口文档整理（数值均为字符串，风力为 "≤3" 这类带比较符号的等级），不是设备录制的数据。
+// 需要补充实际响应时，用 curl 请求后原样粘贴为新的常量：
+//   curl "https://restapi.amap.com/v3/weather/weatherInfo?city=<城市编码>&key=<API Key>"
+
+// 晴，东北风
+static const char AMAP_SUNNY[] = R"({"status":"1","count":"1","info":"OK","infocode":"10000","lives":[{"province":"北京","city":"东城区","adcode":"110101","weather":"晴","temperature":"26","winddirection":"东北","windpower":"≤3","humidity":"45","reporttime":"2025-06-15 12:30:00","temperature_float":"26.0","humidity_float":"45.0"}]})";
+
+// 雷阵雨（同时包含“雷”和“雨”）
+static const char AMAP_THUNDERSHOWER[] = R"({"status":"1","count":"1","info":"OK","infocode":"10000","lives":[{"province":"广东","city":"天河区","adcode":"440106","weather":"雷阵雨","temperature":"31","winddirection":"南","windpower":"4","humidity":"78","reporttime":"2025-06-15 16:00:00","temperature_float":"31.0","humidity_float":"78.0"}]})";
+
+// 零下，小雪
+static const char AMAP_SNOW_BELOW_ZERO[] = R"({"status":"1","count":"1","info":"OK","infocode":"10000","lives":[{"province":"黑龙江","city":"南岗区","adcode":"230103","weather":"小雪","temperature":"-3","winddirection":"西北","windpower":"5","humidity":"66","reporttime":"2025-01-10 08:00:00","temperature_float":"-3.0","humidity_float":"66.0"}]})";
+
+// 无法映射的天气（霾）和风向（无风向），风力带“≥”
+static const char AMAP_HAZE_NO_WIND_DIRECTION[] = R"({"status":"1","count":"1","info":"OK","infocode":"10000","lives":[{"province":"河北","city":"长安区","adcode":"130102","weather":"霾","temperature":"18","winddirection":"无风向","windpower":"≥10","humidity":"62","reporttime":"2025-11-20 09:00:00","temperature_float":"18.0","humidity_float":"62.0"}]})";
+
+// API Key 无效
+static const char AMAP_INVALID_KEY[] = R"({"status":"0","info":"INVALID_USER_KEY","infocode":"10001"})";
+
+// 城市编码不存在：status 为 1，但 lives 为空
+static const char AMAP_UNKNOWN_CITY[] = R"({"status":"1","count":"0","info":"OK","infocode":"10000","lives":[]})";
+
+#endif // AMAP_RESPONSES_H
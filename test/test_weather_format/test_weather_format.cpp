@@ -0,0 +1,135 @@
+// 天气数据解析和格式化的主机单元测试：pio test -e native -f test_weather_format
+// 用高德天气 API 的响应样例（amap_responses.h）经 ArduinoJson 解析，检查 WeatherInfo 的各字段、
+// 天气符号，以及屏幕顶部显示的天气信息字符串
+#include <unity.h>
+
+// WeatherManager.h 依赖的 Arduino 头文件由 test/host 中的替身提供，ArduinoJson 来自 native 环境的 lib_deps
+#include "../../lib/WeatherManager/WeatherFormat.cpp"
+#include "../../lib/WeatherManager/WeatherText.cpp"
+#include "amap_responses.h"
+
+// 解析失败时不应修改的初始内容
+static WeatherInfo untouchedWeather() {
+  WeatherInfo weather;
+  weather.Temperature = 12.0f;
+  weather.Humidity = 34;
+  weather.Symbol = 'c';
+  weather.WindDirection = "西";
+  weather.WindSpeed = "2";
+  weather.Weather = "阴";
+  return weather;
+}
+
+static void assertUntouched(const WeatherInfo& weather) {
+  TEST_ASSERT_EQUAL_FLOAT(12.0f, weather.Temperature);
+  TEST_ASSERT_EQUAL_INT(34, weather.Humidity);
+  TEST_ASSERT_EQUAL_CHAR('c', weather.Symbol);
+  TEST_ASSERT_EQUAL_STRING("西", weather.WindDirection.c_str());
+  TEST_ASSERT_EQUAL_STRING("2", weather.WindSpeed.c_str());
+  TEST_ASSERT_EQUAL_STRING("阴", weather.Weather.c_str());
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_parse_sunny(void) {
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_TRUE(WeatherManager::parseWeatherResponse(AMAP_SUNNY, weather));
+
+  // 温度和湿度在响应中是字符串，由 ArduinoJson 转换为数值
+  TEST_ASSERT_EQUAL_FLOAT(26.0f, weather.Temperature);
+  TEST_ASSERT_EQUAL_INT(45, weather.Humidity);
+  TEST_ASSERT_EQUAL_STRING("东北", weather.WindDirection.c_str());
+  TEST_ASSERT_EQUAL_STRING("≤3", weather.WindSpeed.c_str());
+  TEST_ASSERT_EQUAL_STRING("晴", weather.Weather.c_str());
+  TEST_ASSERT_EQUAL_CHAR('n', weather.Symbol);
+  TEST_ASSERT_EQUAL_STRING("26C 45% Northeast <=3", WeatherManager::getWeatherInfo(weather).c_str());
+}
+
+void test_parse_thundershower(void) {
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_TRUE(WeatherManager::parseWeatherResponse(AMAP_THUNDERSHOWER, weather));
+
+  TEST_ASSERT_EQUAL_CHAR('k', weather.Symbol);
+  TEST_ASSERT_EQUAL_STRING("31C 78% South 4", WeatherManager::getWeatherInfo(weather).c_str());
+}
+
+void test_parse_snow_below_zero(void) {
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_TRUE(WeatherManager::parseWeatherResponse(AMAP_SNOW_BELOW_ZERO, weather));
+
+  TEST_ASSERT_EQUAL_FLOAT(-3.0f, weather.Temperature);
+  TEST_ASSERT_EQUAL_CHAR('d', weather.Symbol);
+  TEST_ASSERT_EQUAL_STRING("-3C 66% Northwest 5", WeatherManager::getWeatherInfo(weather).c_str());
+}
+
+void test_parse_unmapped_weather_and_direction(void) {
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_TRUE(WeatherManager::parseWeatherResponse(AMAP_HAZE_NO_WIND_DIRECTION, weather));
+
+  // 无法识别的天气使用默认符号，无法识别的风向原样显示
+  TEST_ASSERT_EQUAL_CHAR(WEATHER_SYMBOL_DEFAULT, weather.Symbol);
+  TEST_ASSERT_EQUAL_STRING("18C 62% 无风向 >=10", WeatherManager::getWeatherInfo(weather).c_str());
+}
+
+void test_parse_error_status(void) {
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_FALSE(WeatherManager::parseWeatherResponse(AMAP_INVALID_KEY, weather));
+  assertUntouched(weather);
+}
+
+void test_parse_empty_lives(void) {
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_FALSE(WeatherManager::parseWeatherResponse(AMAP_UNKNOWN_CITY, weather));
+  assertUntouched(weather);
+}
+
+void test_parse_truncated_payload(void) {
+  // 连接中断时收到的不完整响应
+  String truncated = String(AMAP_SUNNY).substring(0, 80);
+  WeatherInfo weather = untouchedWeather();
+  TEST_ASSERT_FALSE(WeatherManager::parseWeatherResponse(truncated, weather));
+  assertUntouched(weather);
+
+  TEST_ASSERT_FALSE(WeatherManager::parseWeatherResponse("", weather));
+  assertUntouched(weather);
+}
+
+void test_weather_info_rounding(void) {
+  WeatherInfo weather = untouchedWeather();
+  weather.Temperature = 23.6f;
+  weather.Humidity = 100;
+  weather.WindDirection = "东南";
+  weather.WindSpeed = "≤3";
+  TEST_ASSERT_EQUAL_STRING("24C 100% Southeast <=3", WeatherManager::getWeatherInfo(weather).c_str());
+
+  weather.Temperature = -12.4f;
+  TEST_ASSERT_EQUAL_STRING("-12C 100% Southeast <=3", WeatherManager::getWeatherInfo(weather).c_str());
+}
+
+void test_wind_text(void) {
+  TEST_ASSERT_EQUAL_STRING("West", WeatherManager::translateWindDirection("西").c_str());
+  TEST_ASSERT_EQUAL_STRING("旋转不定", WeatherManager::translateWindDirection("旋转不定").c_str());
+
+  // 风力等级中的“≤”“≥”全部替换（小字体只有 ASCII 字形）
+  TEST_ASSERT_EQUAL_STRING("<=3", WeatherManager::formatWindSpeed("≤3").c_str());
+  TEST_ASSERT_EQUAL_STRING(">=10", WeatherManager::formatWindSpeed("≥10").c_str());
+  TEST_ASSERT_EQUAL_STRING("4-5", WeatherManager::formatWindSpeed("4-5").c_str());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_sunny);
+  RUN_TEST(test_parse_thundershower);
+  RUN_TEST(test_parse_snow_below_zero);
+  RUN_TEST(test_parse_unmapped_weather_and_direction);
+  RUN_TEST(test_parse_error_status);
+  RUN_TEST(test_parse_empty_lives);
+  RUN_TEST(test_parse_truncated_payload);
+  RUN_TEST(test_weather_info_rounding);
+  RUN_TEST(test_wind_text);
+  return UNITY_END();
+}